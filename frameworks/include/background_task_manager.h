@@ -17,6 +17,7 @@
 #define FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_FRAMEWORKS_INCLUDE_BACKGROUND_TASK_MANAGER_H
 
 #include "background_task_subscriber.h"
+#include "continuous_task_operation.h"
 #include "continuous_task_request.h"
 #include "expired_callback.h"
 #include "ibackground_task_mgr.h"
@@ -388,8 +389,53 @@ public:
      * @return ERR_OK if success, else fail.
      */
     ErrCode RequestUpdateDataTransferProgress(const DataTransferProgress &progressInfo);
+
+    /**
+     * @brief Request stop continuous tasks in batch.
+     * @param operations uid, pid, taskType and key of each continuous task.
+     * @param results result of each operation, ERR_OK if success, else failure.
+     * @return Returns ERR_OK if the batch is handled, else failure.
+     */
+    ErrCode StopContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+        std::vector<int32_t> &results);
+
+    /**
+     * @brief Request suspend continuous tasks in batch.
+     * @param operations uid, pid, reason, key and isStandby of each continuous task.
+     * @param results result of each operation, ERR_OK if success, else failure.
+     * @return Returns ERR_OK if the batch is handled, else failure.
+     */
+    ErrCode SuspendContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+        std::vector<int32_t> &results);
+
+    /**
+     * @brief Request active continuous tasks in batch.
+     * @param operations uid, pid, key and isStandby of each continuous task.
+     * @param results result of each operation, ERR_OK if success, else failure.
+     * @return Returns ERR_OK if the batch is handled, else failure.
+     */
+    ErrCode ActiveContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+        std::vector<int32_t> &results);
+
+    /**
+     * @brief Pause transient task time of multiple apps.
+     * @param uids app uids.
+     * @param results result of each uid, ERR_OK if success, else failure.
+     * @return Returns ERR_OK if the batch is handled, else failure.
+     */
+    ErrCode PauseTransientTaskTimesForInner(const std::vector<int32_t> &uids, std::vector<int32_t> &results);
+
+    /**
+     * @brief Request get continuous tasks of multiple apps.
+     * @param uids app uids.
+     * @param list continuous tasks of all requested uids.
+     * @return Returns ERR_OK if success, else failure.
+     */
+    ErrCode RequestGetContinuousTasksByUidsForInner(const std::vector<int32_t> &uids,
+        std::vector<std::shared_ptr<ContinuousTaskInfo>> &list);
+
 private:
-    bool GetBackgroundTaskManagerProxy();
+    sptr<BackgroundTaskMgr::IBackgroundTaskMgr> GetBackgroundTaskManagerProxy();
 
 private:
     class BgTaskMgrDeathRecipient : public IRemoteObject::DeathRecipient {
@@ -405,6 +451,7 @@ private:
     };
 
 private:
+    // 仅保护 proxy_/recipient_ 的读取与替换，IPC 调用不持锁
     std::mutex mutex_;
     sptr<BackgroundTaskMgr::IBackgroundTaskMgr> proxy_;
     sptr<BgTaskMgrDeathRecipient> recipient_;
@@ -29,10 +29,11 @@ BackgroundTaskManager::BackgroundTaskManager() {}
 
 BackgroundTaskManager::~BackgroundTaskManager() {}
 
-#define GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN              \
-    if (!GetBackgroundTaskManagerProxy()) {                    \
-        BGTASK_LOGE("GetBackgroundTaskManager Proxy failed."); \
-        return ERR_BGTASK_SERVICE_NOT_CONNECTED;               \
+#define GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN                       \
+    sptr<IBackgroundTaskMgr> proxy = GetBackgroundTaskManagerProxy(); \
+    if (proxy == nullptr) {                                           \
+        BGTASK_LOGE("GetBackgroundTaskManager Proxy failed.");        \
+        return ERR_BGTASK_SERVICE_NOT_CONNECTED;                      \
     }
 
 ErrCode BackgroundTaskManager::CancelSuspendDelay(int32_t requestId)
@@ -40,10 +41,9 @@ ErrCode BackgroundTaskManager::CancelSuspendDelay(int32_t requestId)
     HitraceScoped traceScoped(HITRACE_TAG_OHOS,
         "BackgroundTaskManager::TransientTask::Mgr::CancelSuspendDelay");
 
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->CancelSuspendDelay(requestId);
+    return proxy->CancelSuspendDelay(requestId);
 }
 
 ErrCode BackgroundTaskManager::RequestSuspendDelay(const std::u16string &reasonU16,
@@ -52,7 +52,6 @@ ErrCode BackgroundTaskManager::RequestSuspendDelay(const std::u16string &reasonU
     HitraceScoped traceScoped(HITRACE_TAG_OHOS,
         "BackgroundTaskManager::TransientTask::Mgr::RequestSuspendDelay");
 
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
     sptr<ExpiredCallback::ExpiredCallbackImpl> callbackSptr = callback.GetImpl();
@@ -66,7 +65,7 @@ ErrCode BackgroundTaskManager::RequestSuspendDelay(const std::u16string &reasonU
         return ERR_CALLBACK_NULL_OR_TYPE_ERR;
     }
     std::string reason = Str16ToStr8(reasonU16);
-    return proxy_->RequestSuspendDelay(reason, callbackSptr, *delayInfo.get());
+    return proxy->RequestSuspendDelay(reason, callbackSptr, *delayInfo.get());
 }
 
 ErrCode BackgroundTaskManager::GetRemainingDelayTime(int32_t requestId, int32_t &delayTime)
@@ -74,10 +73,9 @@ ErrCode BackgroundTaskManager::GetRemainingDelayTime(int32_t requestId, int32_t
     HitraceScoped traceScoped(HITRACE_TAG_OHOS,
         "BackgroundTaskManager::TransientTask::Mgr::GetRemainingDelayTime");
 
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->GetRemainingDelayTime(requestId, delayTime);
+    return proxy->GetRemainingDelayTime(requestId, delayTime);
 }
 
 ErrCode BackgroundTaskManager::GetAllTransientTasks(int32_t &remainingQuota,
@@ -86,13 +84,13 @@ ErrCode BackgroundTaskManager::GetAllTransientTasks(int32_t &remainingQuota,
     HitraceScoped traceScoped(HITRACE_TAG_OHOS,
         "BackgroundTaskManager::ContinuousTask::Mgr::GetAllTransientTasks");
 
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (!GetBackgroundTaskManagerProxy()) {
+    sptr<IBackgroundTaskMgr> proxy = GetBackgroundTaskManagerProxy();
+    if (proxy == nullptr) {
         BGTASK_LOGE("GetBackgroundTaskManager Proxy failed.");
         return ERR_BGTASK_TRANSIENT_SERVICE_NOT_CONNECTED;
     }
 
-    return proxy_->GetAllTransientTasks(remainingQuota, list);
+    return proxy->GetAllTransientTasks(remainingQuota, list);
 }
 
 ErrCode BackgroundTaskManager::RequestStartBackgroundRunning(ContinuousTaskParam &taskParam)
@@ -100,7 +98,6 @@ ErrCode BackgroundTaskManager::RequestStartBackgroundRunning(ContinuousTaskParam
     HitraceScoped traceScoped(HITRACE_TAG_OHOS,
         "BackgroundTaskManager::ContinuousTask::Mgr::RequestStartBackgroundRunning");
 
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
     sptr<ContinuousTaskParam> taskParamPtr = new (std::nothrow) ContinuousTaskParam(taskParam);
@@ -115,7 +112,7 @@ ErrCode BackgroundTaskManager::RequestStartBackgroundRunning(ContinuousTaskParam
         taskParamPtr->abilityId_);
     int32_t notificationId = taskParamPtr->notificationId_;
     int32_t continuousTaskId = taskParamPtr->continuousTaskId_;
-    ErrCode res = proxy_->StartBackgroundRunning(*taskParamPtr.GetRefPtr(), notificationId, continuousTaskId);
+    ErrCode res = proxy->StartBackgroundRunning(*taskParamPtr.GetRefPtr(), notificationId, continuousTaskId);
     taskParam.notificationId_ = notificationId;
     taskParam.continuousTaskId_ = continuousTaskId;
     return res;
@@ -126,7 +123,6 @@ ErrCode BackgroundTaskManager::RequestUpdateBackgroundRunning(ContinuousTaskPara
     HitraceScoped traceScoped(HITRACE_TAG_OHOS,
         "BackgroundTaskManager::ContinuousTask::Mgr::RequestUpdateBackgroundRunning");
 
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
     sptr<ContinuousTaskParam> taskParamPtr = new (std::nothrow) ContinuousTaskParam(taskParam);
@@ -141,7 +137,7 @@ ErrCode BackgroundTaskManager::RequestUpdateBackgroundRunning(ContinuousTaskPara
         taskParamPtr->abilityId_);
     int32_t notificationId = taskParamPtr->notificationId_;
     int32_t continuousTaskId = taskParamPtr->continuousTaskId_;
-    ErrCode ret = proxy_->UpdateBackgroundRunning(*taskParamPtr.GetRefPtr(), notificationId, continuousTaskId);
+    ErrCode ret = proxy->UpdateBackgroundRunning(*taskParamPtr.GetRefPtr(), notificationId, continuousTaskId);
     taskParam.notificationId_ = notificationId;
     taskParam.continuousTaskId_ = continuousTaskId;
     return ret;
@@ -152,7 +148,6 @@ ErrCode BackgroundTaskManager::RequestBackgroundRunningForInner(const Continuous
     HitraceScoped traceScoped(HITRACE_TAG_OHOS,
         "BackgroundTaskManager::ContinuousTask::Mgr::RequestBackgroundRunningForInner");
 
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
     sptr<ContinuousTaskParamForInner> taskParamPtr = new (std::nothrow) ContinuousTaskParamForInner(taskParam);
@@ -161,7 +156,7 @@ ErrCode BackgroundTaskManager::RequestBackgroundRunningForInner(const Continuous
         return ERR_BGTASK_NO_MEMORY;
     }
 
-    return proxy_->RequestBackgroundRunningForInner(*taskParamPtr.GetRefPtr());
+    return proxy->RequestBackgroundRunningForInner(*taskParamPtr.GetRefPtr());
 }
 
 ErrCode BackgroundTaskManager::RequestGetContinuousTasksByUidForInner(int32_t uid,
@@ -170,7 +165,6 @@ ErrCode BackgroundTaskManager::RequestGetContinuousTasksByUidForInner(int32_t ui
     HitraceScoped traceScoped(HITRACE_TAG_OHOS,
         "BackgroundTaskManager::ContinuousTask::Mgr::RequestGetContinuousTasksByUidForInner");
 
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
     if (uid < 0) {
@@ -179,7 +173,7 @@ ErrCode BackgroundTaskManager::RequestGetContinuousTasksByUidForInner(int32_t ui
     }
 
     std::vector<ContinuousTaskInfo> tasksList;
-    ErrCode result = proxy_->RequestGetContinuousTasksByUidForInner(uid, tasksList);
+    ErrCode result = proxy->RequestGetContinuousTasksByUidForInner(uid, tasksList);
     if (result == ERR_OK) {
         list.clear();
         for (const auto& item : tasksList) {
@@ -195,11 +189,10 @@ ErrCode BackgroundTaskManager::RequestStopBackgroundRunning(const std::string &a
     HitraceScoped traceScoped(HITRACE_TAG_OHOS,
         "BackgroundTaskManager::ContinuousTask::Mgr::RequestStopBackgroundRunning");
 
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
     BGTASK_LOGI("requestStopBackgroundRunning abilityName: %{public}s, abilityId: %{public}d, "\
         "continuousTaskId: %{public}d.", abilityName.c_str(), abilityId, continuousTaskId);
-    return proxy_->StopBackgroundRunning(abilityName, abilityToken, abilityId, continuousTaskId);
+    return proxy->StopBackgroundRunning(abilityName, abilityToken, abilityId, continuousTaskId);
 }
 
 ErrCode BackgroundTaskManager::RequestGetAllContinuousTasks(std::vector<std::shared_ptr<ContinuousTaskInfo>> &list)
@@ -207,11 +200,10 @@ ErrCode BackgroundTaskManager::RequestGetAllContinuousTasks(std::vector<std::sha
     HitraceScoped traceScoped(HITRACE_TAG_OHOS,
         "BackgroundTaskManager::ContinuousTask::Mgr::RequestGetAllContinuousTasks");
 
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
     std::vector<ContinuousTaskInfo> tasksList;
-    ErrCode result = proxy_->GetAllContinuousTasks(tasksList);
+    ErrCode result = proxy->GetAllContinuousTasks(tasksList);
     if (result == ERR_OK) {
         list.clear();
         for (const auto& item : tasksList) {
@@ -227,16 +219,14 @@ ErrCode BackgroundTaskManager::RequestGetAllContinuousTasks(
     HitraceScoped traceScoped(HITRACE_TAG_OHOS,
         "BackgroundTaskManager::ContinuousTask::Mgr::GetAllContinuousTasksIncludeSuspended");
 
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->GetAllContinuousTasks(list, includeSuspended);
+    return proxy->GetAllContinuousTasks(list, includeSuspended);
 }
 
 __attribute__((no_sanitize("cfi"))) ErrCode BackgroundTaskManager::SubscribeBackgroundTask(
     const BackgroundTaskSubscriber &subscriber)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
     sptr<BackgroundTaskSubscriber::BackgroundTaskSubscriberImpl> subscriberSptr = subscriber.GetImpl();
@@ -244,12 +234,11 @@ __attribute__((no_sanitize("cfi"))) ErrCode BackgroundTaskManager::SubscribeBack
         BGTASK_LOGE("subscriberSptr is nullptr");
         return ERR_BGTASK_INVALID_PARAM;
     }
-    return proxy_->SubscribeBackgroundTask(subscriberSptr, subscriber.currentCallBackType_);
+    return proxy->SubscribeBackgroundTask(subscriberSptr, subscriber.currentCallBackType_);
 }
 
 ErrCode BackgroundTaskManager::UnsubscribeBackgroundTask(const BackgroundTaskSubscriber &subscriber)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
     sptr<BackgroundTaskSubscriber::BackgroundTaskSubscriberImpl> subscriberSptr = subscriber.GetImpl();
@@ -257,16 +246,15 @@ ErrCode BackgroundTaskManager::UnsubscribeBackgroundTask(const BackgroundTaskSub
         BGTASK_LOGE("subscriberSptr is nullptr");
         return ERR_BGTASK_INVALID_PARAM;
     }
-    return proxy_->UnsubscribeBackgroundTask(subscriberSptr, subscriber.currentCallBackType_);
+    return proxy->UnsubscribeBackgroundTask(subscriberSptr, subscriber.currentCallBackType_);
 }
 
 ErrCode BackgroundTaskManager::GetTransientTaskApps(std::vector<std::shared_ptr<TransientTaskAppInfo>> &list)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
     std::vector<TransientTaskAppInfo> TaskAppsList;
-    ErrCode result = proxy_->GetTransientTaskApps(TaskAppsList);
+    ErrCode result = proxy->GetTransientTaskApps(TaskAppsList);
     if (result == ERR_OK) {
         list.clear();
         for (const auto& item : TaskAppsList) {
@@ -279,18 +267,16 @@ ErrCode BackgroundTaskManager::GetTransientTaskApps(std::vector<std::shared_ptr<
 
 ErrCode BackgroundTaskManager::PauseTransientTaskTimeForInner(int32_t uid)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->PauseTransientTaskTimeForInner(uid);
+    return proxy->PauseTransientTaskTimeForInner(uid);
 }
 
 ErrCode BackgroundTaskManager::StartTransientTaskTimeForInner(int32_t uid)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->StartTransientTaskTimeForInner(uid);
+    return proxy->StartTransientTaskTimeForInner(uid);
 }
 
 ErrCode BackgroundTaskManager::ApplyEfficiencyResources(const EfficiencyResourceInfo &resourceInfo)
@@ -298,7 +284,6 @@ ErrCode BackgroundTaskManager::ApplyEfficiencyResources(const EfficiencyResource
     HitraceScoped traceScoped(HITRACE_TAG_OHOS,
         "BackgroundTaskManager::EfficiencyResource::Mgr::ApplyEfficiencyResources");
 
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
     sptr<EfficiencyResourceInfo> resourceInfoPtr = new (std::nothrow) EfficiencyResourceInfo(resourceInfo);
@@ -306,7 +291,7 @@ ErrCode BackgroundTaskManager::ApplyEfficiencyResources(const EfficiencyResource
         BGTASK_LOGE("Failed to create efficiency resource info");
         return ERR_BGTASK_NO_MEMORY;
     }
-    return proxy_->ApplyEfficiencyResources(*resourceInfoPtr.GetRefPtr());
+    return proxy->ApplyEfficiencyResources(*resourceInfoPtr.GetRefPtr());
 }
 
 ErrCode BackgroundTaskManager::ResetAllEfficiencyResources()
@@ -314,10 +299,9 @@ ErrCode BackgroundTaskManager::ResetAllEfficiencyResources()
     HitraceScoped traceScoped(HITRACE_TAG_OHOS,
         "BackgroundTaskManager::EfficiencyResource::Mgr::ResetAllEfficiencyResources");
 
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->ResetAllEfficiencyResources();
+    return proxy->ResetAllEfficiencyResources();
 }
 
 ErrCode BackgroundTaskManager::GetAllEfficiencyResources(
@@ -326,14 +310,14 @@ ErrCode BackgroundTaskManager::GetAllEfficiencyResources(
     HitraceScoped traceScoped(HITRACE_TAG_OHOS,
         "BackgroundTaskManager::EfficiencyResource::Mgr::GetAllEfficiencyResources");
 
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (!GetBackgroundTaskManagerProxy()) {
+    sptr<IBackgroundTaskMgr> proxy = GetBackgroundTaskManagerProxy();
+    if (proxy == nullptr) {
         BGTASK_LOGE("GetBackgroundTaskManager Proxy failed.");
         return ERR_BGTASK_RESOURCES_SERVICE_NOT_CONNECTED;
     }
 
     std::vector<EfficiencyResourceInfo> list;
-    ErrCode result = proxy_->GetAllEfficiencyResources(list);
+    ErrCode result = proxy->GetAllEfficiencyResources(list);
     if (result == ERR_OK) {
         resourceInfoList.clear();
         for (const auto& item : list) {
@@ -346,12 +330,11 @@ ErrCode BackgroundTaskManager::GetAllEfficiencyResources(
 ErrCode BackgroundTaskManager::GetEfficiencyResourcesInfos(std::vector<std::shared_ptr<ResourceCallbackInfo>> &appList,
     std::vector<std::shared_ptr<ResourceCallbackInfo>> &procList)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
     std::vector<ResourceCallbackInfo> resourceAppList;
     std::vector<ResourceCallbackInfo> resourceProcList;
-    ErrCode result = proxy_->GetEfficiencyResourcesInfos(resourceAppList, resourceProcList);
+    ErrCode result = proxy->GetEfficiencyResourcesInfos(resourceAppList, resourceProcList);
     if (result == ERR_OK) {
         appList.clear();
         procList.clear();
@@ -366,46 +349,56 @@ ErrCode BackgroundTaskManager::GetEfficiencyResourcesInfos(std::vector<std::shar
     return result;
 }
 
-bool BackgroundTaskManager::GetBackgroundTaskManagerProxy()
+sptr<IBackgroundTaskMgr> BackgroundTaskManager::GetBackgroundTaskManagerProxy()
 {
-    if (proxy_ != nullptr) {
-        return true;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (proxy_ != nullptr) {
+            return proxy_;
+        }
     }
     sptr<ISystemAbilityManager> systemAbilityManager =
         SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
     if (systemAbilityManager == nullptr) {
         BGTASK_LOGE("GetBackgroundTaskManagerProxy GetSystemAbilityManager failed.");
-        return false;
+        return nullptr;
     }
 
     sptr<IRemoteObject> remoteObject =
         systemAbilityManager->GetSystemAbility(BACKGROUND_TASK_MANAGER_SERVICE_ID);
     if (remoteObject == nullptr) {
         BGTASK_LOGE("GetBackgroundTaskManagerProxy GetSystemAbility failed.");
-        return false;
+        return nullptr;
     }
 
-    proxy_ = iface_cast<BackgroundTaskMgr::IBackgroundTaskMgr>(remoteObject);
-    if ((proxy_ == nullptr) || (proxy_->AsObject() == nullptr)) {
+    sptr<IBackgroundTaskMgr> proxy = iface_cast<BackgroundTaskMgr::IBackgroundTaskMgr>(remoteObject);
+    if ((proxy == nullptr) || (proxy->AsObject() == nullptr)) {
         BGTASK_LOGE("GetBackgroundTaskManagerProxy iface_cast remoteObject failed.");
-        return false;
+        return nullptr;
     }
 
-    recipient_ = new (std::nothrow) BgTaskMgrDeathRecipient(*this);
+    std::lock_guard<std::mutex> lock(mutex_);
+    // 并发连接时以先发布的代理为准，锁内只做指针交换，IPC 均在锁外进行
+    if (proxy_ != nullptr) {
+        return proxy_;
+    }
     if (recipient_ == nullptr) {
-        return false;
+        recipient_ = new (std::nothrow) BgTaskMgrDeathRecipient(*this);
+        if (recipient_ == nullptr) {
+            return nullptr;
+        }
     }
-    proxy_->AsObject()->AddDeathRecipient(recipient_);
-    return true;
+    proxy->AsObject()->AddDeathRecipient(recipient_);
+    proxy_ = proxy;
+    return proxy_;
 }
 
 ErrCode BackgroundTaskManager::GetContinuousTaskApps(std::vector<std::shared_ptr<ContinuousTaskCallbackInfo>> &list)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
     std::vector<ContinuousTaskCallbackInfo> TaskAppsList;
-    ErrCode result = proxy_->GetContinuousTaskApps(TaskAppsList);
+    ErrCode result = proxy->GetContinuousTaskApps(TaskAppsList);
     if (result == ERR_OK) {
         list.clear();
         for (const auto& item : TaskAppsList) {
@@ -418,90 +411,86 @@ ErrCode BackgroundTaskManager::GetContinuousTaskApps(std::vector<std::shared_ptr
 
 ErrCode BackgroundTaskManager::StopContinuousTask(int32_t uid, int32_t pid, uint32_t taskType, const std::string &key)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->StopContinuousTask(uid, pid, taskType, key);
+    return proxy->StopContinuousTask(uid, pid, taskType, key);
 }
 
 ErrCode BackgroundTaskManager::SuspendContinuousTask(
     int32_t uid, int32_t pid, int32_t reason, const std::string &key, bool isStandby)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->SuspendContinuousTask(uid, pid, reason, key, isStandby);
+    return proxy->SuspendContinuousTask(uid, pid, reason, key, isStandby);
 }
 
 ErrCode BackgroundTaskManager::ActiveContinuousTask(int32_t uid, int32_t pid, const std::string &key, bool isStandby)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->ActiveContinuousTask(uid, pid, key, isStandby);
+    return proxy->ActiveContinuousTask(uid, pid, key, isStandby);
 }
 
 ErrCode BackgroundTaskManager::AVSessionNotifyUpdateNotification(int32_t uid, int32_t pid, bool isPublish)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->AVSessionNotifyUpdateNotification(uid, pid, isPublish);
+    return proxy->AVSessionNotifyUpdateNotification(uid, pid, isPublish);
 }
 
 void BackgroundTaskManager::ResetBackgroundTaskManagerProxy()
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if ((proxy_ != nullptr) && (proxy_->AsObject() != nullptr)) {
-        proxy_->AsObject()->RemoveDeathRecipient(recipient_);
+    sptr<IBackgroundTaskMgr> proxy;
+    sptr<BgTaskMgrDeathRecipient> recipient;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        proxy = proxy_;
+        recipient = recipient_;
+        proxy_ = nullptr;
+    }
+    if ((proxy != nullptr) && (proxy->AsObject() != nullptr)) {
+        proxy->AsObject()->RemoveDeathRecipient(recipient);
     }
-    proxy_ = nullptr;
 }
 
 ErrCode BackgroundTaskManager::SetBgTaskConfig(const std::string &configData, int32_t sourceType)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->SetBgTaskConfig(configData, sourceType);
+    return proxy->SetBgTaskConfig(configData, sourceType);
 }
 
 ErrCode BackgroundTaskManager::SuspendContinuousAudioTask(int32_t uid)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->SuspendContinuousAudioTask(uid);
+    return proxy->SuspendContinuousAudioTask(uid);
 }
 
 ErrCode BackgroundTaskManager::IsModeSupported(ContinuousTaskParam &taskParam)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->IsModeSupported(taskParam);
+    return proxy->IsModeSupported(taskParam);
 }
 
 ErrCode BackgroundTaskManager::SetSupportedTaskKeepingProcesses(const std::set<std::string> &processSet)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->SetSupportedTaskKeepingProcesses(processSet);
+    return proxy->SetSupportedTaskKeepingProcesses(processSet);
 }
 
 ErrCode BackgroundTaskManager::SetMaliciousAppConfig(const std::set<std::string> &maliciousAppSet)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->SetMaliciousAppConfig(maliciousAppSet);
+    return proxy->SetMaliciousAppConfig(maliciousAppSet);
 }
 
 ErrCode BackgroundTaskManager::RequestAuthFromUser(const ContinuousTaskParam &taskParam,
     const ExpiredCallback &callback, int32_t &notificationId)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
     sptr<ExpiredCallback::ExpiredCallbackImpl> callbackSptr = callback.GetImpl();
@@ -510,54 +499,49 @@ ErrCode BackgroundTaskManager::RequestAuthFromUser(const ContinuousTaskParam &ta
         return ERR_BGTASK_CONTINUOUS_CALLBACK_NULL_OR_TYPE_ERR;
     }
 
-    return proxy_->RequestAuthFromUser(taskParam, callbackSptr, notificationId);
+    return proxy->RequestAuthFromUser(taskParam, callbackSptr, notificationId);
 }
 
 ErrCode BackgroundTaskManager::CheckSpecialScenarioAuth(int32_t appIndex, uint32_t &authResult, int32_t apiVersion)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->CheckSpecialScenarioAuth(appIndex, authResult, apiVersion);
+    return proxy->CheckSpecialScenarioAuth(appIndex, authResult, apiVersion);
 }
 
 ErrCode BackgroundTaskManager::CheckTaskAuthResult(const std::string &bundleName, int32_t userId, int32_t appIndex)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->CheckTaskAuthResult(bundleName, userId, appIndex);
+    return proxy->CheckTaskAuthResult(bundleName, userId, appIndex);
 }
 
 ErrCode BackgroundTaskManager::EnableContinuousTaskRequest(int32_t uid, bool isEnable)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->EnableContinuousTaskRequest(uid, isEnable);
+    return proxy->EnableContinuousTaskRequest(uid, isEnable);
 }
 
 ErrCode BackgroundTaskManager::SetBackgroundTaskState(std::shared_ptr<BackgroundTaskStateInfo> taskParam)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
     if (!taskParam) {
         return ERR_BGTASK_CHECK_TASK_PARAM;
     }
-    return proxy_->SetBackgroundTaskState(*taskParam.get());
+    return proxy->SetBackgroundTaskState(*taskParam.get());
 }
 
 ErrCode BackgroundTaskManager::GetBackgroundTaskState(std::shared_ptr<BackgroundTaskStateInfo> taskParam)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
     if (!taskParam) {
         return ERR_BGTASK_CHECK_TASK_PARAM;
     }
     uint32_t authResult = 0;
-    ErrCode ret = proxy_->GetBackgroundTaskState(*taskParam.get(), authResult);
+    ErrCode ret = proxy->GetBackgroundTaskState(*taskParam.get(), authResult);
     if (ret != ERR_OK) {
         return ret;
     }
@@ -570,29 +554,26 @@ ErrCode BackgroundTaskManager::GetAllContinuousTasksBySystem(std::vector<std::sh
     HitraceScoped traceScoped(HITRACE_TAG_OHOS,
         "BackgroundTaskManager::ContinuousTask::Mgr::GetAllContinuousTasksBySystem");
 
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    ErrCode result = proxy_->GetAllContinuousTasksBySystem(list);
+    ErrCode result = proxy->GetAllContinuousTasksBySystem(list);
     return result;
 }
 
 ErrCode BackgroundTaskManager::SetSpecialExemptedProcess(const std::set<std::string> &bundleNameSet)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->SetSpecialExemptedProcess(bundleNameSet);
+    return proxy->SetSpecialExemptedProcess(bundleNameSet);
 }
 
 ErrCode BackgroundTaskManager::GetAllContinuousTaskApps(
     std::vector<std::shared_ptr<ContinuousTaskCallbackInfo>> &list)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
     std::vector<ContinuousTaskCallbackInfo> TaskAppsList;
-    ErrCode result = proxy_->GetAllContinuousTaskApps(TaskAppsList);
+    ErrCode result = proxy->GetAllContinuousTaskApps(TaskAppsList);
     if (result == ERR_OK) {
         list.clear();
         for (const auto& item : TaskAppsList) {
@@ -604,18 +585,16 @@ ErrCode BackgroundTaskManager::GetAllContinuousTaskApps(
 
 ErrCode BackgroundTaskManager::SendNotificationByDeteTask(const std::set<std::string> &taskKeys)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->SendNotificationByDeteTask(taskKeys);
+    return proxy->SendNotificationByDeteTask(taskKeys);
 }
 
 ErrCode BackgroundTaskManager::RemoveAuthRecord(const ContinuousTaskParam &taskParam)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->RemoveAuthRecord(taskParam);
+    return proxy->RemoveAuthRecord(taskParam);
 }
 
 ErrCode BackgroundTaskManager::RequestUpdateDataTransferProgress(const DataTransferProgress &progressInfo)
@@ -623,10 +602,57 @@ ErrCode BackgroundTaskManager::RequestUpdateDataTransferProgress(const DataTrans
     HitraceScoped traceScoped(HITRACE_TAG_OHOS,
         "BackgroundTaskManager::ContinuousTask::Mgr::RequestUpdateDataTransferProgress");
 
-    std::lock_guard<std::mutex> lock(mutex_);
     GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
 
-    return proxy_->UpdateDataTransferProgress(progressInfo);
+    return proxy->UpdateDataTransferProgress(progressInfo);
+}
+
+ErrCode BackgroundTaskManager::StopContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+    std::vector<int32_t> &results)
+{
+    GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
+
+    return proxy->StopContinuousTasks(operations, results);
+}
+
+ErrCode BackgroundTaskManager::SuspendContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+    std::vector<int32_t> &results)
+{
+    GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
+
+    return proxy->SuspendContinuousTasks(operations, results);
+}
+
+ErrCode BackgroundTaskManager::ActiveContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+    std::vector<int32_t> &results)
+{
+    GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
+
+    return proxy->ActiveContinuousTasks(operations, results);
+}
+
+ErrCode BackgroundTaskManager::PauseTransientTaskTimesForInner(const std::vector<int32_t> &uids,
+    std::vector<int32_t> &results)
+{
+    GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
+
+    return proxy->PauseTransientTaskTimesForInner(uids, results);
+}
+
+ErrCode BackgroundTaskManager::RequestGetContinuousTasksByUidsForInner(const std::vector<int32_t> &uids,
+    std::vector<std::shared_ptr<ContinuousTaskInfo>> &list)
+{
+    GET_BACK_GROUND_TASK_MANAGER_PROXY_RETURN
+
+    std::vector<ContinuousTaskInfo> tasksList;
+    ErrCode result = proxy->RequestGetContinuousTasksByUidsForInner(uids, tasksList);
+    if (result == ERR_OK) {
+        list.clear();
+        for (const auto& item : tasksList) {
+            list.push_back(std::make_shared<ContinuousTaskInfo>(item));
+        }
+    }
+    return result;
 }
 
 BackgroundTaskManager::BgTaskMgrDeathRecipient::BgTaskMgrDeathRecipient(BackgroundTaskManager &backgroundTaskManager)
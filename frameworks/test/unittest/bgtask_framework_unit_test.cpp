@@ -12,6 +12,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <atomic>
 #include <functional>
 #include <chrono>
 #include <thread>
@@ -57,6 +58,8 @@ constexpr uint32_t ON_APP_TRANSIENT_TASK_END = 6;
 constexpr uint32_t ON_CONTINUOUS_TASK_START = 7;
 constexpr uint32_t ON_CONTINUOUS_TASK_STOP = 8;
 constexpr uint32_t ON_APP_CONTINUOUS_TASK_STOP = 9;
+constexpr int32_t CONCURRENT_THREAD_NUM = 8;
+constexpr int32_t CONCURRENT_LOOP_NUM = 200;
 }
 class BgTaskFrameworkUnitTest : public testing::Test {
 public:
@@ -1165,5 +1168,72 @@ HWTEST_F(BgTaskFrameworkUnitTest, RequestUpdateDataTransferProgress_001, TestSiz
     EXPECT_EQ(DelayedSingleton<BackgroundTaskManager>::GetInstance()->RequestUpdateDataTransferProgress(progressInfo),
         ERR_BGTASK_SERVICE_NOT_CONNECTED);
 }
+
+/**
+ * @tc.name: BatchOperation_001
+ * @tc.desc: test batched continuous and transient task APIs when service is not connected.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskFrameworkUnitTest, BatchOperation_001, TestSize.Level1)
+{
+    auto manager = DelayedSingleton<BackgroundTaskManager>::GetInstance();
+    manager->proxy_ = nullptr;
+    SystemAbilityManagerClient::GetInstance().action_ = "set_null";
+    std::vector<ContinuousTaskOperation> operations;
+    operations.emplace_back(1, 1, "key");
+    std::vector<int32_t> results;
+    EXPECT_EQ(manager->StopContinuousTasks(operations, results), ERR_BGTASK_SERVICE_NOT_CONNECTED);
+    EXPECT_EQ(manager->SuspendContinuousTasks(operations, results), ERR_BGTASK_SERVICE_NOT_CONNECTED);
+    EXPECT_EQ(manager->ActiveContinuousTasks(operations, results), ERR_BGTASK_SERVICE_NOT_CONNECTED);
+    std::vector<int32_t> uids = {1};
+    EXPECT_EQ(manager->PauseTransientTaskTimesForInner(uids, results), ERR_BGTASK_SERVICE_NOT_CONNECTED);
+    std::vector<std::shared_ptr<ContinuousTaskInfo>> list;
+    EXPECT_EQ(manager->RequestGetContinuousTasksByUidsForInner(uids, list), ERR_BGTASK_SERVICE_NOT_CONNECTED);
+    SystemAbilityManagerClient::GetInstance().action_ = "";
+}
+
+/**
+ * @tc.name: ConcurrentProxyAccess_001
+ * @tc.desc: test concurrent client calls do not serialize on a global lock while proxy is reset.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskFrameworkUnitTest, ConcurrentProxyAccess_001, TestSize.Level1)
+{
+    auto manager = DelayedSingleton<BackgroundTaskManager>::GetInstance();
+    manager->proxy_ = nullptr;
+    SystemAbilityManagerClient::GetInstance().action_ = "";
+    std::atomic<int32_t> finishedCalls {0};
+    std::atomic<bool> running {true};
+    std::thread resetThread([&manager, &running]() {
+        while (running.load()) {
+            manager->ResetBackgroundTaskManagerProxy();
+            std::this_thread::yield();
+        }
+    });
+    auto begin = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int32_t i = 0; i < CONCURRENT_THREAD_NUM; i++) {
+        workers.emplace_back([&manager, &finishedCalls]() {
+            int32_t delayTime = 0;
+            for (int32_t j = 0; j < CONCURRENT_LOOP_NUM; j++) {
+                manager->GetRemainingDelayTime(-1, delayTime);
+                finishedCalls++;
+            }
+        });
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    auto costMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+    running.store(false);
+    resetThread.join();
+    GTEST_LOG_(INFO) << "ConcurrentProxyAccess_001 calls: " << finishedCalls.load() << ", cost ms: " << costMs;
+    EXPECT_EQ(finishedCalls.load(), CONCURRENT_THREAD_NUM * CONCURRENT_LOOP_NUM);
+    manager->GetBackgroundTaskManagerProxy();
+    EXPECT_NE(manager->proxy_, nullptr);
+    manager->ResetBackgroundTaskManagerProxy();
+    EXPECT_EQ(manager->proxy_, nullptr);
+}
 }
 }
@@ -19,6 +19,7 @@
 #include "background_task_subscriber.h"
 #include "efficiency_resource_info.h"
 #include "bgtaskmgr_inner_errors.h"
+#include "continuous_task_operation.h"
 #include "continuous_task_request.h"
 #include "background_task_state_info.h"
 #include "background_common.h"
@@ -315,6 +316,50 @@ public:
      * @return ERR_OK if success, else fail.
      */
     static ErrCode RequestUpdateDataTransferProgress(const DataTransferProgress &progressInfo);
+
+    /**
+     * @brief Request stop continuous tasks in batch.
+     * @param operations uid, pid, taskType and key of each continuous task.
+     * @param results result of each operation, ERR_OK if success, else failure.
+     * @return Returns ERR_OK if the batch is handled, else failure.
+     */
+    static ErrCode StopContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+        std::vector<int32_t> &results);
+
+    /**
+     * @brief Request suspend continuous tasks in batch.
+     * @param operations uid, pid, reason, key and isStandby of each continuous task.
+     * @param results result of each operation, ERR_OK if success, else failure.
+     * @return Returns ERR_OK if the batch is handled, else failure.
+     */
+    static ErrCode SuspendContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+        std::vector<int32_t> &results);
+
+    /**
+     * @brief Request active continuous tasks in batch.
+     * @param operations uid, pid, key and isStandby of each continuous task.
+     * @param results result of each operation, ERR_OK if success, else failure.
+     * @return Returns ERR_OK if the batch is handled, else failure.
+     */
+    static ErrCode ActiveContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+        std::vector<int32_t> &results);
+
+    /**
+     * @brief Pause transient task time of multiple apps.
+     * @param uids app uids.
+     * @param results result of each uid, ERR_OK if success, else failure.
+     * @return Returns ERR_OK if the batch is handled, else failure.
+     */
+    static ErrCode PauseTransientTaskTimesForInner(const std::vector<int32_t> &uids, std::vector<int32_t> &results);
+
+    /**
+     * @brief Request get continuous tasks of multiple apps.
+     * @param uids app uids.
+     * @param list continuous tasks of all requested uids.
+     * @return Returns ERR_OK if success, else failure.
+     */
+    static ErrCode RequestGetContinuousTasksByUidsForInner(const std::vector<int32_t> &uids,
+        std::vector<std::shared_ptr<ContinuousTaskInfo>> &list);
 };
 }  // namespace BackgroundTaskMgr
 }  // namespace OHOS
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_INTERFACES_INNERKITS_INCLUDE_CONTINUOUS_TASK_OPERATION_H
+#define FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_INTERFACES_INNERKITS_INCLUDE_CONTINUOUS_TASK_OPERATION_H
+
+#include <cstdint>
+#include <string>
+
+#include "parcel.h"
+
+namespace OHOS {
+namespace BackgroundTaskMgr {
+class ContinuousTaskOperation : public Parcelable {
+public:
+    ContinuousTaskOperation() = default;
+    ContinuousTaskOperation(int32_t uid, int32_t pid, const std::string &key, bool isStandby = false)
+        : uid_(uid), pid_(pid), key_(key), isStandby_(isStandby) {}
+
+    /**
+     * @brief Marshals a purpose into a parcel.
+     *
+     * @param parcel Indicates the parcel object for marshalling.
+     * @return True if success, else false.
+     */
+    bool Marshalling(Parcel& out) const override;
+
+    /**
+     * @brief Unmarshals a purpose from a Parcel.
+     *
+     * @param parcel Indicates the Parcel object for unmarshalling.
+     * @return Operation of continuous task.
+     */
+    static ContinuousTaskOperation* Unmarshalling(Parcel& in);
+
+    /**
+     * @brief Read data from a parcel.
+     *
+     * @param in Indicates the Parcel object.
+     * @return True if success, else false.
+     */
+    bool ReadFromParcel(Parcel& in);
+
+    /**
+     * @brief Get the uid.
+     *
+     * @return The uid of app.
+     */
+    inline int32_t GetUid() const
+    {
+        return uid_;
+    }
+
+    /**
+     * @brief Get the pid.
+     *
+     * @return The pid of app.
+     */
+    inline int32_t GetPid() const
+    {
+        return pid_;
+    }
+
+    /**
+     * @brief Get the task key.
+     *
+     * @return The key of continuous task.
+     */
+    inline const std::string &GetKey() const
+    {
+        return key_;
+    }
+
+    /**
+     * @brief Get the task type, only used by stop operation.
+     *
+     * @return The background mode of continuous task.
+     */
+    inline uint32_t GetTaskType() const
+    {
+        return taskType_;
+    }
+
+    /**
+     * @brief Set the task type, only used by stop operation.
+     *
+     * @param taskType The background mode of continuous task.
+     */
+    inline void SetTaskType(uint32_t taskType)
+    {
+        taskType_ = taskType;
+    }
+
+    /**
+     * @brief Get the suspend reason, only used by suspend operation.
+     *
+     * @return The suspend reason.
+     */
+    inline int32_t GetReason() const
+    {
+        return reason_;
+    }
+
+    /**
+     * @brief Set the suspend reason, only used by suspend operation.
+     *
+     * @param reason The suspend reason.
+     */
+    inline void SetReason(int32_t reason)
+    {
+        reason_ = reason;
+    }
+
+    /**
+     * @brief Whether the operation is triggered by standby.
+     *
+     * @return True if triggered by standby, else false.
+     */
+    inline bool IsStandby() const
+    {
+        return isStandby_;
+    }
+
+private:
+    int32_t uid_ {0};
+    int32_t pid_ {0};
+    std::string key_ {""};
+    bool isStandby_ {false};
+    uint32_t taskType_ {0};
+    int32_t reason_ {0};
+};
+}  // namespace BackgroundTaskMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_INTERFACES_INNERKITS_INCLUDE_CONTINUOUS_TASK_OPERATION_H
@@ -88,6 +88,7 @@ struct ProgressInfo : public Parcelable {
     bool Marshalling(Parcel& out) const override;
     static ProgressInfo* Unmarshalling(Parcel& in);
 
+    void ParseToJson(nlohmann::json &root) const;
     std::string ParseToJsonStr() const;
     bool ParseFromJson(const nlohmann::json &value);
 
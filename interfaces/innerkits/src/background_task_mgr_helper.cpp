@@ -208,5 +208,36 @@ ErrCode BackgroundTaskMgrHelper::RequestUpdateDataTransferProgress(const DataTra
 {
     return DelayedSingleton<BackgroundTaskManager>::GetInstance()->RequestUpdateDataTransferProgress(progressInfo);
 }
+
+ErrCode BackgroundTaskMgrHelper::StopContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+    std::vector<int32_t> &results)
+{
+    return DelayedSingleton<BackgroundTaskManager>::GetInstance()->StopContinuousTasks(operations, results);
+}
+
+ErrCode BackgroundTaskMgrHelper::SuspendContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+    std::vector<int32_t> &results)
+{
+    return DelayedSingleton<BackgroundTaskManager>::GetInstance()->SuspendContinuousTasks(operations, results);
+}
+
+ErrCode BackgroundTaskMgrHelper::ActiveContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+    std::vector<int32_t> &results)
+{
+    return DelayedSingleton<BackgroundTaskManager>::GetInstance()->ActiveContinuousTasks(operations, results);
+}
+
+ErrCode BackgroundTaskMgrHelper::PauseTransientTaskTimesForInner(const std::vector<int32_t> &uids,
+    std::vector<int32_t> &results)
+{
+    return DelayedSingleton<BackgroundTaskManager>::GetInstance()->PauseTransientTaskTimesForInner(uids, results);
+}
+
+ErrCode BackgroundTaskMgrHelper::RequestGetContinuousTasksByUidsForInner(const std::vector<int32_t> &uids,
+    std::vector<std::shared_ptr<ContinuousTaskInfo>> &list)
+{
+    return DelayedSingleton<BackgroundTaskManager>::GetInstance()->RequestGetContinuousTasksByUidsForInner(
+        uids, list);
+}
 }  // namespace BackgroundTaskMgr
 }  // namespace OHOS
\ No newline at end of file
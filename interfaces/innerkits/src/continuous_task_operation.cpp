@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "continuous_task_operation.h"
+
+#include "ipc_util.h"
+
+namespace OHOS {
+namespace BackgroundTaskMgr {
+bool ContinuousTaskOperation::Marshalling(Parcel& out) const
+{
+    WRITE_PARCEL_WITH_RET(out, Int32, uid_, false);
+    WRITE_PARCEL_WITH_RET(out, Int32, pid_, false);
+    WRITE_PARCEL_WITH_RET(out, String, key_, false);
+    WRITE_PARCEL_WITH_RET(out, Bool, isStandby_, false);
+    WRITE_PARCEL_WITH_RET(out, Uint32, taskType_, false);
+    WRITE_PARCEL_WITH_RET(out, Int32, reason_, false);
+    return true;
+}
+
+bool ContinuousTaskOperation::ReadFromParcel(Parcel& in)
+{
+    READ_PARCEL_WITH_RET(in, Int32, uid_, false);
+    READ_PARCEL_WITH_RET(in, Int32, pid_, false);
+    READ_PARCEL_WITH_RET(in, String, key_, false);
+    READ_PARCEL_WITH_RET(in, Bool, isStandby_, false);
+    READ_PARCEL_WITH_RET(in, Uint32, taskType_, false);
+    READ_PARCEL_WITH_RET(in, Int32, reason_, false);
+    return true;
+}
+
+ContinuousTaskOperation* ContinuousTaskOperation::Unmarshalling(Parcel& in)
+{
+    ContinuousTaskOperation* operation = new (std::nothrow) ContinuousTaskOperation();
+    if (operation && !operation->ReadFromParcel(in)) {
+        BGTASK_LOGE("read ContinuousTaskOperation from parcel failed");
+        delete operation;
+        operation = nullptr;
+    }
+    return operation;
+}
+}  // namespace BackgroundTaskMgr
+}  // namespace OHOS
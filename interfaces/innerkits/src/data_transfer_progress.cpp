@@ -123,10 +123,7 @@ std::string DataTransferProgress::ParseToJsonStr() const
     nlohmann::json root;
     root["continuousTaskId"] = continuousTaskId_;
     if (progressInfo_ != nullptr) {
-        nlohmann::json progressJson = nlohmann::json::parse(progressInfo_->ParseToJsonStr(), nullptr, false);
-        if (!progressJson.is_discarded()) {
-            root["progressInfo"] = progressJson;
-        }
+        progressInfo_->ParseToJson(root["progressInfo"]);
     }
     return root.dump(jsonFormat_, ' ', false, nlohmann::json::error_handler_t::replace);
 }
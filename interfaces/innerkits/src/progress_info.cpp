@@ -120,13 +120,18 @@ bool ProgressInfo::ReadFromParcel(Parcel& in)
     return true;
 }
 
-std::string ProgressInfo::ParseToJsonStr() const
+void ProgressInfo::ParseToJson(nlohmann::json &root) const
 {
-    nlohmann::json root;
     root["title"] = title_;
     root["fileName"] = fileName_;
     root["progressValue"] = progressValue_;
     root["isMute"] = isMute_;
+}
+
+std::string ProgressInfo::ParseToJsonStr() const
+{
+    nlohmann::json root;
+    ParseToJson(root);
     return root.dump(jsonFormat_, ' ', false, nlohmann::json::error_handler_t::replace);
 }
 
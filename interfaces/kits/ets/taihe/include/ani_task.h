@@ -27,9 +27,16 @@ public:
     AniTask();
     ~AniTask();
     static ani_status AniSendEvent(const std::function<void()> task);
+    // 在工作线程执行 execute，完成后在发起调用的 ETS 线程执行 complete，投递失败时在工作线程执行 complete
+    static ani_status AniSendAsyncWork(const std::function<void()> execute, const std::function<void()> complete);
  
 private:
+    static std::shared_ptr<OHOS::AppExecFwk::EventHandler> GetMainHandler();
+    static std::shared_ptr<OHOS::AppExecFwk::EventHandler> GetCurrentHandler();
+    static std::shared_ptr<OHOS::AppExecFwk::EventHandler> GetWorkHandler();
+
     static std::shared_ptr<OHOS::AppExecFwk::EventHandler> mainHandler_;
+    static std::shared_ptr<OHOS::AppExecFwk::EventHandler> workHandler_;
 };
 } // namespace BackgroundTaskMgr
 } // namespace OHOS
@@ -23,7 +23,10 @@
 namespace OHOS {
 namespace BackgroundTaskMgr {
 std::shared_ptr<OHOS::AppExecFwk::EventHandler> AniTask::mainHandler_ = nullptr;
+std::shared_ptr<OHOS::AppExecFwk::EventHandler> AniTask::workHandler_ = nullptr;
 std::mutex mainHandlerMutex_;
+std::mutex workHandlerMutex_;
+static constexpr char ANI_ASYNC_WORK_RUNNER[] = "BgTaskAniAsync";
 
 AniTask::AniTask()
 {
@@ -36,27 +39,93 @@ AniTask::~AniTask()
     mainHandler_ = nullptr;
     BGTASK_LOGD("~AniTask()");
 }
-ani_status AniTask::AniSendEvent(const std::function<void()> task)
+std::shared_ptr<OHOS::AppExecFwk::EventHandler> AniTask::GetMainHandler()
 {
-    BGTASK_LOGD("AniSendEvent");
-    if (task == nullptr) {
-        BGTASK_LOGE("null task");
-        return ani_status::ANI_INVALID_ARGS;
-    }
     std::lock_guard<std::mutex> lock(mainHandlerMutex_);
     if (!mainHandler_) {
         std::shared_ptr<OHOS::AppExecFwk::EventRunner> runner = OHOS::AppExecFwk::EventRunner::GetMainEventRunner();
         if (!runner) {
             BGTASK_LOGE("null EventRunner");
-            return ani_status::ANI_NOT_FOUND;
+            return nullptr;
         }
         mainHandler_ = std::make_shared<OHOS::AppExecFwk::EventHandler>(runner);
     }
-    if (mainHandler_ == nullptr) {
+    return mainHandler_;
+}
+
+std::shared_ptr<OHOS::AppExecFwk::EventHandler> AniTask::GetCurrentHandler()
+{
+    std::shared_ptr<OHOS::AppExecFwk::EventRunner> runner = OHOS::AppExecFwk::EventRunner::Current();
+    if (!runner) {
+        BGTASK_LOGE("null current EventRunner");
+        return nullptr;
+    }
+    if (runner == OHOS::AppExecFwk::EventRunner::GetMainEventRunner()) {
+        return GetMainHandler();
+    }
+    return std::make_shared<OHOS::AppExecFwk::EventHandler>(runner);
+}
+
+std::shared_ptr<OHOS::AppExecFwk::EventHandler> AniTask::GetWorkHandler()
+{
+    std::lock_guard<std::mutex> lock(workHandlerMutex_);
+    if (!workHandler_) {
+        // 单线程顺序执行，保证同一应用先后发起的请求按序到达服务端
+        std::shared_ptr<OHOS::AppExecFwk::EventRunner> runner =
+            OHOS::AppExecFwk::EventRunner::Create(ANI_ASYNC_WORK_RUNNER);
+        if (!runner) {
+            BGTASK_LOGE("create async work runner failed");
+            return nullptr;
+        }
+        workHandler_ = std::make_shared<OHOS::AppExecFwk::EventHandler>(runner);
+    }
+    return workHandler_;
+}
+
+ani_status AniTask::AniSendEvent(const std::function<void()> task)
+{
+    BGTASK_LOGD("AniSendEvent");
+    if (task == nullptr) {
+        BGTASK_LOGE("null task");
+        return ani_status::ANI_INVALID_ARGS;
+    }
+    auto mainHandler = GetMainHandler();
+    if (mainHandler == nullptr) {
         BGTASK_LOGE("null mainHandler");
         return ani_status::ANI_NOT_FOUND;
     }
-    mainHandler_->PostTask(std::move(task));
+    mainHandler->PostTask(std::move(task));
+    return ani_status::ANI_OK;
+}
+
+ani_status AniTask::AniSendAsyncWork(const std::function<void()> execute, const std::function<void()> complete)
+{
+    if (execute == nullptr || complete == nullptr) {
+        BGTASK_LOGE("null async work");
+        return ani_status::ANI_INVALID_ARGS;
+    }
+    // complete 需回到发起调用的 ETS 线程执行，该线程无事件循环时结果无法回传，由调用方同步执行
+    auto completeHandler = GetCurrentHandler();
+    if (completeHandler == nullptr) {
+        BGTASK_LOGE("null completeHandler");
+        return ani_status::ANI_NOT_FOUND;
+    }
+    auto workHandler = GetWorkHandler();
+    if (workHandler == nullptr) {
+        return ani_status::ANI_NOT_FOUND;
+    }
+    auto task = [execute, complete, completeHandler]() {
+        execute();
+        if (!completeHandler->PostTask(complete)) {
+            // 发起线程的事件循环已退出，在工作线程结束调用，避免 promise 永不完成且全局引用泄漏
+            BGTASK_LOGE("Failed to send async work complete, complete in work thread");
+            complete();
+        }
+    };
+    if (!workHandler->PostTask(task)) {
+        BGTASK_LOGE("post async work failed");
+        return ani_status::ANI_ERROR;
+    }
     return ani_status::ANI_OK;
 }
 } // namespace BackgroundTaskMgr
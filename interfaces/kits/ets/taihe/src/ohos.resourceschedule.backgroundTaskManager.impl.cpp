@@ -28,6 +28,7 @@
 #include "ani_common_want_agent.h"
 #include "common.h"
 #include "ani_backgroundtask_subscriber.h"
+#include "ani_task.h"
 #include "background_mode.h"
 #include "background_sub_mode.h"
 #include "background_task_submode.h"
@@ -100,6 +101,167 @@ static std::vector<std::string> g_backgroundModes = {
     "taskKeeping"
 };
 
+// 异步接口上下文，IPC 在工作线程执行，结果在发起调用的 ETS 线程通过 promise 或 callback 返回
+struct AniAsyncContext {
+    ani_vm *vm {nullptr};
+    ani_resolver deferred {nullptr};
+    ani_ref callbackRef {nullptr};
+    bool hasResult {false};
+    int32_t result {0}; // out
+    ErrCode errCode {ERR_OK}; // out
+};
+
+using AniAsyncExecute = std::function<ErrCode(int32_t &result)>;
+
+ani_object CreateBusinessError(ani_env *env, ErrCode errCode)
+{
+    ani_class cls {};
+    if (env->FindClass("@ohos.base.BusinessError", &cls) != ANI_OK) {
+        BGTASK_LOGE("find BusinessError class failed");
+        return nullptr;
+    }
+    ani_method ctor {};
+    if (env->Class_FindMethod(cls, "<ctor>", ":", &ctor) != ANI_OK) {
+        BGTASK_LOGE("find BusinessError ctor failed");
+        return nullptr;
+    }
+    ani_object error {};
+    if (env->Object_New(cls, ctor, &error) != ANI_OK) {
+        BGTASK_LOGE("new BusinessError failed");
+        return nullptr;
+    }
+    std::string errMsg = Common::FindErrMsg(errCode);
+    ani_string message {};
+    if (env->String_NewUTF8(errMsg.c_str(), errMsg.size(), &message) != ANI_OK ||
+        env->Object_SetPropertyByName_Ref(error, "message", message) != ANI_OK ||
+        env->Object_SetPropertyByName_Int(error, "code", Common::FindErrCode(errCode)) != ANI_OK) {
+        BGTASK_LOGE("set BusinessError property failed");
+    }
+    return error;
+}
+
+// 失败时必须以错误结束异步调用，BusinessError 创建失败则退化为通用 Error，均失败时使用 undefined
+ani_ref CreateAsyncError(ani_env *env, ErrCode errCode)
+{
+    ani_object error = CreateBusinessError(env, errCode);
+    if (error != nullptr) {
+        return error;
+    }
+    ani_class cls {};
+    ani_method ctor {};
+    if (env->FindClass("std.core.Error", &cls) == ANI_OK &&
+        env->Class_FindMethod(cls, "<ctor>", ":", &ctor) == ANI_OK && env->Object_New(cls, ctor, &error) == ANI_OK) {
+        return error;
+    }
+    BGTASK_LOGE("create fallback error failed");
+    ani_ref undefinedRef {};
+    env->GetUndefined(&undefinedRef);
+    return undefinedRef;
+}
+
+ani_ref CreateAsyncResult(ani_env *env, const std::shared_ptr<AniAsyncContext> &asyncContext)
+{
+    ani_ref undefinedRef {};
+    env->GetUndefined(&undefinedRef);
+    if (!asyncContext->hasResult) {
+        return undefinedRef;
+    }
+    ani_class cls {};
+    ani_method ctor {};
+    ani_object result {};
+    if (env->FindClass("std.core.Int", &cls) != ANI_OK || env->Class_FindMethod(cls, "<ctor>", "i:", &ctor) != ANI_OK ||
+        env->Object_New(cls, ctor, &result, static_cast<ani_int>(asyncContext->result)) != ANI_OK) {
+        BGTASK_LOGE("create int result failed");
+        return undefinedRef;
+    }
+    return result;
+}
+
+void SettleAsyncWork(ani_env *env, const std::shared_ptr<AniAsyncContext> &asyncContext)
+{
+    bool isFailed = asyncContext->errCode != ERR_OK;
+    ani_ref error = nullptr;
+    if (isFailed) {
+        BGTASK_LOGE("async work fail errCode: %{public}d", Common::FindErrCode(asyncContext->errCode));
+        error = CreateAsyncError(env, asyncContext->errCode);
+    }
+    ani_ref result = CreateAsyncResult(env, asyncContext);
+    if (asyncContext->deferred != nullptr) {
+        if (isFailed) {
+            env->PromiseResolver_Reject(asyncContext->deferred, static_cast<ani_error>(error));
+        } else {
+            env->PromiseResolver_Resolve(asyncContext->deferred, result);
+        }
+        return;
+    }
+    if (asyncContext->callbackRef == nullptr) {
+        return;
+    }
+    ani_ref errorRef = error;
+    if (!isFailed) {
+        env->GetNull(&errorRef);
+    }
+    std::vector<ani_ref> args = {errorRef, result};
+    ani_ref callResult {};
+    if (env->FunctionalObject_Call(static_cast<ani_fn_object>(asyncContext->callbackRef), args.size(), args.data(),
+        &callResult) != ANI_OK) {
+        BGTASK_LOGE("call async callback failed");
+    }
+    env->GlobalReference_Delete(asyncContext->callbackRef);
+    asyncContext->callbackRef = nullptr;
+}
+
+void CompleteAsyncWork(const std::shared_ptr<AniAsyncContext> &asyncContext)
+{
+    if (asyncContext->vm == nullptr) {
+        BGTASK_LOGE("null vm");
+        return;
+    }
+    ani_env *env = nullptr;
+    if (asyncContext->vm->GetEnv(ANI_VERSION_1, &env) == ANI_OK && env != nullptr) {
+        SettleAsyncWork(env, asyncContext);
+        return;
+    }
+    // 发起线程已无法回传结果时在工作线程完成，需临时关联虚拟机
+    if (asyncContext->vm->AttachCurrentThread(nullptr, ANI_VERSION_1, &env) != ANI_OK || env == nullptr) {
+        BGTASK_LOGE("attach current thread failed");
+        return;
+    }
+    SettleAsyncWork(env, asyncContext);
+    asyncContext->vm->DetachCurrentThread();
+}
+
+// callback 为 0 时返回 promise，否则通过 callback 返回结果
+uintptr_t StartAsyncWork(ani_env *env, uintptr_t callback, bool hasResult, const AniAsyncExecute &execute)
+{
+    auto asyncContext = std::make_shared<AniAsyncContext>();
+    asyncContext->hasResult = hasResult;
+    ani_object promise = nullptr;
+    ani_status status = env->GetVM(&asyncContext->vm);
+    if (status == ANI_OK && callback != 0) {
+        status = env->GlobalReference_Create(reinterpret_cast<ani_ref>(callback), &asyncContext->callbackRef);
+    } else if (status == ANI_OK) {
+        status = env->Promise_New(&asyncContext->deferred, &promise);
+    }
+    if (status != ANI_OK) {
+        BGTASK_LOGE("create async context failed, status: %{public}d", static_cast<int32_t>(status));
+        set_business_error(Common::FindErrCode(ERR_BGTASK_SYS_NOT_READY), Common::FindErrMsg(ERR_BGTASK_SYS_NOT_READY));
+        return 0;
+    }
+    auto executeTask = [asyncContext, execute]() {
+        asyncContext->errCode = execute(asyncContext->result);
+    };
+    auto completeTask = [asyncContext]() {
+        CompleteAsyncWork(asyncContext);
+    };
+    if (AniTask::AniSendAsyncWork(executeTask, completeTask) != ANI_OK) {
+        BGTASK_LOGW("send async work failed, execute in current thread");
+        executeTask();
+        completeTask();
+    }
+    return reinterpret_cast<uintptr_t>(promise);
+}
+
 ani_status GetAbilityContext(ani_env *env, const ani_object &value,
     std::shared_ptr<AbilityRuntime::AbilityContext> &abilityContext)
 {
@@ -606,6 +768,24 @@ int32_t GetRemainingDelayTimeSync(int32_t requestId)
     return callbackInfo.delayTime;
 }
 
+uintptr_t GetRemainingDelayTimeInner(int32_t requestId, uintptr_t callback)
+{
+    auto execute = [requestId](int32_t &delayTime) {
+        return DelayedSingleton<BackgroundTaskManager>::GetInstance()->GetRemainingDelayTime(requestId, delayTime);
+    };
+    return StartAsyncWork(taihe::get_env(), callback, true, execute);
+}
+
+void GetRemainingDelayTimeAsync(int32_t requestId, uintptr_t callback)
+{
+    GetRemainingDelayTimeInner(requestId, callback);
+}
+
+uintptr_t GetRemainingDelayTimePromise(int32_t requestId)
+{
+    return GetRemainingDelayTimeInner(requestId, 0);
+}
+
 ::ohos::resourceschedule::backgroundTaskManager::DelaySuspendInfo RequestSuspendDelay(
     string_view reason, callback_view<void(UndefinedType const&)> callback)
 {
@@ -730,6 +910,33 @@ void SetBackgroundTaskState(::ohos::resourceschedule::backgroundTaskManager::Bac
     return authResult;
 }
 
+uintptr_t StopBackgroundRunningInner(uintptr_t context, uintptr_t callback)
+{
+    auto env = taihe::get_env();
+    std::unique_ptr<ContinuousTaskCallbackInfo> asyncCallbackInfo = std::make_unique<ContinuousTaskCallbackInfo>();
+    if (!CheckParam(env, asyncCallbackInfo.get(), context)) {
+        BGTASK_LOGE("check param failed");
+        return 0;
+    }
+    std::string abilityName = asyncCallbackInfo->abilityContext->GetAbilityInfo()->name;
+    sptr<IRemoteObject> token = asyncCallbackInfo->abilityContext->GetToken();
+    int32_t abilityId = asyncCallbackInfo->abilityContext->GetAbilityRecordId();
+    auto execute = [abilityName, token, abilityId](int32_t &) {
+        return BackgroundTaskMgrHelper::RequestStopBackgroundRunning(abilityName, token, abilityId);
+    };
+    return StartAsyncWork(env, callback, false, execute);
+}
+
+void StopBackgroundRunningAsync(uintptr_t context, uintptr_t callback)
+{
+    StopBackgroundRunningInner(context, callback);
+}
+
+uintptr_t StopBackgroundRunningPromise(uintptr_t context)
+{
+    return StopBackgroundRunningInner(context, 0);
+}
+
 void StopBackgroundRunningSync(uintptr_t context)
 {
     auto env = taihe::get_env();
@@ -750,21 +957,20 @@ void StopBackgroundRunningSync(uintptr_t context)
     }
 }
 
-void StartBackgroundRunningSync(uintptr_t context,
-    ::ohos::resourceschedule::backgroundTaskManager::BackgroundMode bgMode, uintptr_t wantAgent)
+std::shared_ptr<ContinuousTaskParam> GetStartBackgroundRunningParam(ani_env *env, uintptr_t context,
+    ::ohos::resourceschedule::backgroundTaskManager::BackgroundMode bgMode, uintptr_t wantAgent,
+    ContinuousTaskCallbackInfo *asyncCallbackInfo)
 {
-    auto env = taihe::get_env();
-    std::unique_ptr<ContinuousTaskCallbackInfo> asyncCallbackInfo = std::make_unique<ContinuousTaskCallbackInfo>();
-    if (!CheckParam(env, asyncCallbackInfo.get(), context)) {
+    if (!CheckParam(env, asyncCallbackInfo, context)) {
         BGTASK_LOGE("check param failed");
-        return;
+        return nullptr;
     }
     if (GetWantAgent(env, reinterpret_cast<ani_object>(wantAgent), asyncCallbackInfo->wantAgent) != ANI_OK) {
         BGTASK_LOGE("Get ability failed");
         asyncCallbackInfo->errCode = ERR_WANTAGENT_NULL_OR_TYPE_ERR;
         set_business_error(
             Common::FindErrCode(asyncCallbackInfo->errCode), Common::FindErrMsg(asyncCallbackInfo->errCode));
-        return;
+        return nullptr;
     }
     sptr<IRemoteObject> token = asyncCallbackInfo->abilityContext->GetToken();
     const std::shared_ptr<AppExecFwk::AbilityInfo> info = asyncCallbackInfo->abilityContext->GetAbilityInfo();
@@ -772,13 +978,56 @@ void StartBackgroundRunningSync(uintptr_t context,
 
     asyncCallbackInfo->isBatchApi = false;
     asyncCallbackInfo->bgMode = static_cast<uint32_t>(bgMode);
-    if (!CheckBackgroundMode(env, asyncCallbackInfo.get())) {
+    if (!CheckBackgroundMode(env, asyncCallbackInfo)) {
         BGTASK_LOGE("check backgroundMode failed");
-        return;
+        return nullptr;
     }
-    ContinuousTaskParam taskParam = ContinuousTaskParam(true, asyncCallbackInfo->bgMode,
+    auto taskParam = std::make_shared<ContinuousTaskParam>(true, asyncCallbackInfo->bgMode,
         asyncCallbackInfo->wantAgent, info->name, token, "", false, asyncCallbackInfo->bgModes, abilityId);
-    taskParam.appIndex_ = info->appIndex;
+    taskParam->appIndex_ = info->appIndex;
+    return taskParam;
+}
+
+uintptr_t StartBackgroundRunningInner(uintptr_t context,
+    ::ohos::resourceschedule::backgroundTaskManager::BackgroundMode bgMode, uintptr_t wantAgent, uintptr_t callback)
+{
+    auto env = taihe::get_env();
+    std::unique_ptr<ContinuousTaskCallbackInfo> asyncCallbackInfo = std::make_unique<ContinuousTaskCallbackInfo>();
+    auto taskParam = GetStartBackgroundRunningParam(env, context, bgMode, wantAgent, asyncCallbackInfo.get());
+    if (taskParam == nullptr) {
+        return 0;
+    }
+    auto execute = [taskParam](int32_t &) {
+        ErrCode errCode = BackgroundTaskMgrHelper::RequestStartBackgroundRunning(*taskParam);
+        BGTASK_LOGI("notification %{public}d, continuousTaskId %{public}d", taskParam->notificationId_,
+            taskParam->continuousTaskId_);
+        return errCode;
+    };
+    return StartAsyncWork(env, callback, false, execute);
+}
+
+void StartBackgroundRunningAsync(uintptr_t context,
+    ::ohos::resourceschedule::backgroundTaskManager::BackgroundMode bgMode, uintptr_t wantAgent, uintptr_t callback)
+{
+    StartBackgroundRunningInner(context, bgMode, wantAgent, callback);
+}
+
+uintptr_t StartBackgroundRunningPromise(uintptr_t context,
+    ::ohos::resourceschedule::backgroundTaskManager::BackgroundMode bgMode, uintptr_t wantAgent)
+{
+    return StartBackgroundRunningInner(context, bgMode, wantAgent, 0);
+}
+
+void StartBackgroundRunningSync(uintptr_t context,
+    ::ohos::resourceschedule::backgroundTaskManager::BackgroundMode bgMode, uintptr_t wantAgent)
+{
+    auto env = taihe::get_env();
+    std::unique_ptr<ContinuousTaskCallbackInfo> asyncCallbackInfo = std::make_unique<ContinuousTaskCallbackInfo>();
+    auto taskParamPtr = GetStartBackgroundRunningParam(env, context, bgMode, wantAgent, asyncCallbackInfo.get());
+    if (taskParamPtr == nullptr) {
+        return;
+    }
+    ContinuousTaskParam &taskParam = *taskParamPtr;
     asyncCallbackInfo->errCode = BackgroundTaskMgrHelper::RequestStartBackgroundRunning(taskParam);
     asyncCallbackInfo->notificationId = taskParam.notificationId_;
     asyncCallbackInfo->continuousTaskId = taskParam.continuousTaskId_;
@@ -1603,15 +1852,15 @@ void UpdateDataTransferProgress(
 // Since these macros are auto-generate, lint will cause false positive.
 // NOLINTBEGIN
 TH_EXPORT_CPP_API_CancelSuspendDelay(CancelSuspendDelay);
-TH_EXPORT_CPP_API_GetRemainingDelayTimeAsync(GetRemainingDelayTimeSync);
-TH_EXPORT_CPP_API_GetRemainingDelayTimePromise(GetRemainingDelayTimeSync);
+TH_EXPORT_CPP_API_GetRemainingDelayTimeAsync(GetRemainingDelayTimeAsync);
+TH_EXPORT_CPP_API_GetRemainingDelayTimePromise(GetRemainingDelayTimePromise);
 TH_EXPORT_CPP_API_GetRemainingDelayTimeSync(GetRemainingDelayTimeSync);
 TH_EXPORT_CPP_API_RequestSuspendDelay(RequestSuspendDelay);
-TH_EXPORT_CPP_API_StartBackgroundRunningAsync(StartBackgroundRunningSync);
-TH_EXPORT_CPP_API_StartBackgroundRunningPromise(StartBackgroundRunningSync);
+TH_EXPORT_CPP_API_StartBackgroundRunningAsync(StartBackgroundRunningAsync);
+TH_EXPORT_CPP_API_StartBackgroundRunningPromise(StartBackgroundRunningPromise);
 TH_EXPORT_CPP_API_StartBackgroundRunningSync(StartBackgroundRunningSync);
-TH_EXPORT_CPP_API_StopBackgroundRunningAsync(StopBackgroundRunningSync);
-TH_EXPORT_CPP_API_StopBackgroundRunningPromise(StopBackgroundRunningSync);
+TH_EXPORT_CPP_API_StopBackgroundRunningAsync(StopBackgroundRunningAsync);
+TH_EXPORT_CPP_API_StopBackgroundRunningPromise(StopBackgroundRunningPromise);
 TH_EXPORT_CPP_API_StopBackgroundRunningSync(StopBackgroundRunningSync);
 TH_EXPORT_CPP_API_ApplyEfficiencyResources(ApplyEfficiencyResources);
 TH_EXPORT_CPP_API_ResetAllEfficiencyResources(ResetAllEfficiencyResources);
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_COMMON_INCLUDE_BG_MODE_SET_H
+#define FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_COMMON_INCLUDE_BG_MODE_SET_H
+
+#include <cstdint>
+#include <vector>
+
+namespace OHOS {
+namespace BackgroundTaskMgr {
+/**
+ * 长时任务模式集合，以定长位图表示，集合运算为单条位运算且不分配堆内存。
+ * 模式 id 超出位图范围时记为不可表示，调用方需回退到按 vector 比较。
+ */
+class BgModeSet {
+public:
+    static constexpr uint32_t MAX_MODE_ID = 63;
+
+    constexpr BgModeSet() = default;
+    explicit BgModeSet(const std::vector<uint32_t> &modeIds)
+    {
+        for (uint32_t modeId : modeIds) {
+            Add(modeId);
+        }
+    }
+
+    static constexpr BgModeSet FromBits(uint64_t bits)
+    {
+        BgModeSet modeSet;
+        modeSet.bits_ = bits;
+        return modeSet;
+    }
+
+    constexpr void Add(uint32_t modeId)
+    {
+        if (modeId > MAX_MODE_ID) {
+            overflow_ = true;
+            return;
+        }
+        bits_ |= ModeBit(modeId);
+    }
+
+    constexpr void Remove(uint32_t modeId)
+    {
+        bits_ &= ~ModeBit(modeId);
+    }
+
+    constexpr bool Contains(uint32_t modeId) const
+    {
+        return (bits_ & ModeBit(modeId)) != 0;
+    }
+
+    constexpr bool ContainsAll(const BgModeSet &other) const
+    {
+        return (other.bits_ & ~bits_) == 0;
+    }
+
+    constexpr bool Intersects(const BgModeSet &other) const
+    {
+        return (bits_ & other.bits_) != 0;
+    }
+
+    constexpr bool IsEmpty() const
+    {
+        return bits_ == 0 && !overflow_;
+    }
+
+    constexpr bool IsRepresentable() const
+    {
+        return !overflow_;
+    }
+
+    constexpr uint64_t GetBits() const
+    {
+        return bits_;
+    }
+
+    uint32_t Size() const
+    {
+        return static_cast<uint32_t>(__builtin_popcountll(bits_));
+    }
+
+    std::vector<uint32_t> ToVector() const
+    {
+        std::vector<uint32_t> modeIds;
+        modeIds.reserve(Size());
+        for (uint64_t bits = bits_; bits != 0; bits &= bits - 1) {
+            modeIds.push_back(static_cast<uint32_t>(__builtin_ctzll(bits)));
+        }
+        return modeIds;
+    }
+
+    constexpr bool operator==(const BgModeSet &other) const
+    {
+        return bits_ == other.bits_ && overflow_ == other.overflow_;
+    }
+
+    constexpr bool operator!=(const BgModeSet &other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    static constexpr uint64_t ModeBit(uint32_t modeId)
+    {
+        return modeId > MAX_MODE_ID ? 0 : (static_cast<uint64_t>(1) << modeId);
+    }
+
+    uint64_t bits_ {0};
+    bool overflow_ {false};
+};
+}  // namespace BackgroundTaskMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_COMMON_INCLUDE_BG_MODE_SET_H
@@ -15,6 +15,7 @@
 
 #ifndef FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_COMMON_BGTASK_CONFIG_H
 #define FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_COMMON_BGTASK_CONFIG_H
+#include <atomic>
 #include <string>
 #include <set>
 #include <mutex>
@@ -30,9 +31,17 @@ class BgtaskConfig : public DelayedSingleton<BgtaskConfig> {
 public:
     void Init();
     bool IsTransientTaskExemptedQuatoApp(const std::string &bundleName);
+    bool IsTransientTaskExemptedQuatoListed(const std::string &bundleName);
+    bool CheckSignature(const std::string &bundlename) const;
     bool IsTaskKeepingExemptedQuatoApp(const std::string &bundleName);
     bool IsMaliciousAppConfig(const std::string &bundleName);
     int32_t GetTransientTaskExemptedQuato();
+    int32_t GetTransientTaskStateMaxSize();
+    int64_t GetTransientTaskStateIdleTime();
+    inline uint64_t GetTransientConfigVersion() const
+    {
+        return transientConfigVersion_.load(std::memory_order_acquire);
+    }
     bool AddExemptedQuatoData(const std::string &configData, int32_t sourceType);
     void SetSupportedTaskKeepingProcesses(const std::set<std::string> &processSet);
     void SetMaliciousAppConfig(const std::set<std::string> &maliciousAppSet);
@@ -50,11 +59,11 @@ private:
     void LoadConfigFile();
     void ParseTransientTaskExemptedQuatoList(const nlohmann::json &jsonObj);
     void ParseTransientTaskExemptedQuato(const nlohmann::json &jsonObj);
+    void ParseTransientTaskStateEviction(const nlohmann::json &jsonObj);
     bool SetCloudConfigParam(const nlohmann::json &jsonObj);
     void SetTransientTaskParam(const nlohmann::json &jsonObj);
     void SetContinuousTaskParam(const nlohmann::json &jsonObj);
     void ParseBundleSignature(const nlohmann::json &jsonObj);
-    bool CheckSignature(const std::string &bundlename) const;
 
     void LoadBgTaskConfigFile();
     void ParseCpuEfficiencyResourceApplyBundleInfos(const nlohmann::json &jsonObj);
@@ -67,7 +76,12 @@ private:
     std::set<std::string> maliciousAppBlocklist_ {};
     std::set<std::string> specialExemptedQuatoList_ = {};
     int32_t transientTaskExemptedQuato_ = 10 * 1000; // 10s
+    // 短时任务应用状态缓存上限及空闲淘汰时间
+    int32_t transientTaskStateMaxSize_ = 512;
+    int64_t transientTaskStateIdleTime_ = 60 * 60 * 1000; // 1h
     std::mutex configMutex_;
+    // 短时任务豁免配置版本号，配置变化时递增，供调用方判断缓存是否失效
+    std::atomic<uint64_t> transientConfigVersion_ {0};
 
     BgTaskConfigFileInfo bgTaskConfigFileInfo_ {};
 };
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_COMMON_INCLUDE_BUNDLE_NAME_CACHE_H
+#define FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_COMMON_INCLUDE_BUNDLE_NAME_CACHE_H
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "singleton.h"
+
+namespace OHOS {
+namespace BackgroundTaskMgr {
+/**
+ * uid 到包名的 LRU 缓存，未命中时才跨进程查询 BMS，
+ * 应用安装、更新、卸载时按 uid 失效。
+ */
+class BundleNameCache {
+    DECLARE_DELAYED_SINGLETON(BundleNameCache);
+public:
+    bool GetBundleName(int32_t uid, std::string &bundleName);
+    void Invalidate(int32_t uid);
+    void Clear();
+    void ShellDump(std::vector<std::string> &dumpInfo);
+
+private:
+    struct CacheEntry {
+        std::string bundleName_ {""};
+        int32_t userId_ {0};
+        std::list<int32_t>::iterator lruIter_;
+    };
+
+    bool QueryBundleName(int32_t uid, std::string &bundleName);
+    bool FindLocked(int32_t uid, std::string &bundleName);
+    void PutLocked(int32_t uid, const std::string &bundleName);
+    bool FillLocked(int32_t uid, const std::string &bundleName, uint64_t generation);
+
+private:
+    std::mutex cacheMutex_;
+    std::list<int32_t> lruList_ {};
+    std::unordered_map<int32_t, CacheEntry> entries_ {};
+    uint64_t hitCount_ {0};
+    uint64_t missCount_ {0};
+    uint64_t invalidateCount_ {0};
+    // 每次失效递增，查询 BMS 期间发生过失效时丢弃查询结果，不回填缓存
+    uint64_t generation_ {0};
+    uint64_t staleFillCount_ {0};
+};
+}  // namespace BackgroundTaskMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_COMMON_INCLUDE_BUNDLE_NAME_CACHE_H
@@ -20,6 +20,7 @@
 #include <set>
 #include "nlohmann/json.hpp"
 #include "background_mode.h"
+#include "bg_mode_set.h"
 
 namespace OHOS {
 namespace BackgroundTaskMgr {
@@ -61,6 +62,11 @@ public:
         const std::set<uint32_t> &liveViewTypes);
     static bool CheckStrToNum(const std::string &value);
     static void SortMode(std::vector<uint32_t> &bgModeIds);
+    // 以下重载直接使用已缓存的模式集合，仅当集合可表示(IsRepresentable)时结果与 vector 版本一致
+    static bool CheckModesSame(const BgModeSet &oldModes, const BgModeSet &newModes);
+    static bool CheckApplyMode(const BgModeSet &applyModes, const BgModeSet &checkModes);
+    static bool CheckExistOtherMode(const BgModeSet &modes, uint32_t bgMode, const std::set<uint32_t> &liveViewTypes);
+    static void SortMode(std::vector<uint32_t> &bgModeIds, const BgModeSet &modes);
 
 public:
     static constexpr int32_t jsonFormat_ = 4;
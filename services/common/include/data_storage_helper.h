@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,8 +16,12 @@
 #ifndef FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_DATA_STORAGE_HELPER_H
 #define FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_DATA_STORAGE_HELPER_H
 
+#include <atomic>
+#include <map>
+#include <mutex>
 #include <unique_fd.h>
 
+#include "event_handler.h"
 #include "singleton.h"
 #include "nlohmann/json.hpp"
 
@@ -30,6 +34,8 @@ class DataStorageHelper : public DelayedSingleton<BgContinuousTaskMgr> {
 using ResourceRecordMap = std::unordered_map<int32_t, std::shared_ptr<ResourceApplicationRecord>>;
 public:
     ErrCode RefreshTaskRecord(const std::unordered_map<std::string, std::shared_ptr<ContinuousTaskRecord>> &allRecord);
+    ErrCode RefreshTaskRecord(const std::string &key,
+        const std::unordered_map<std::string, std::shared_ptr<ContinuousTaskRecord>> &allRecord);
     ErrCode RestoreTaskRecord(std::unordered_map<std::string, std::shared_ptr<ContinuousTaskRecord>> &allRecord);
     ErrCode RefreshResourceRecord(const ResourceRecordMap &appRecord, const ResourceRecordMap &processRecord);
     ErrCode RestoreResourceRecord(ResourceRecordMap &appRecord, ResourceRecordMap &processRecord);
@@ -42,12 +48,13 @@ public:
     ErrCode OnBackup(MessageParcel& data, MessageParcel& reply);
     ErrCode OnRestore(MessageParcel& data, MessageParcel& reply,
         std::unordered_map<std::string, std::shared_ptr<BannerNotificationRecord>>& allRecord);
+    void DumpPersistenceData(std::vector<std::string> &dumpInfo);
+    void FlushPersistenceData();
 
 private:
-    int32_t SaveJsonValueToFile(const std::string &value, const std::string &filePath);
     bool ConvertFullPath(const std::string &partialPath, std::string &fullPath);
-    void ConvertMapToString(const ResourceRecordMap &appRecord,
-        const ResourceRecordMap &processRecord, std::string &recordString);
+    void ConvertMapsToJson(const ResourceRecordMap &appRecord,
+        const ResourceRecordMap &processRecord, nlohmann::json &root);
     void ConvertMapToJson(const ResourceRecordMap &appRecord, nlohmann::json &root);
     void DivideJsonToMap(nlohmann::json &root,
         ResourceRecordMap &appRecord, ResourceRecordMap &processRecord);
@@ -58,6 +65,29 @@ private:
     DECLARE_DELAYED_SINGLETON(DataStorageHelper);
     std::string SetReplyCode(int32_t replyCode);
     bool GetAuthRecord(UniqueFd &fd);
+    ErrCode SaveSnapshotToFile(const nlohmann::json &root, const std::string &filePath);
+    int32_t ParseSnapshotFromFile(nlohmann::json &value, const std::string &filePath);
+    ErrCode ExportSnapshotToJson(const std::string &filePath, std::string &jsonStr);
+    ErrCode ExportJsonToFile(const std::string &srcPath, const std::string &destPath);
+    std::string DumpCompactJson(const nlohmann::json &root);
+    ErrCode AppendTaskJournal(const std::vector<nlohmann::json> &entries);
+    void MarkSnapshotDirty(const std::string &filePath, nlohmann::json &&root);
+    void SchedulePersistFlush();
+    void RequeueTaskSnapshot(nlohmann::json &&snapshot, std::vector<nlohmann::json> &taskJournal);
+    ErrCode ClearTaskJournal();
+    bool ReplayTaskJournal(std::unordered_map<std::string, std::shared_ptr<ContinuousTaskRecord>> &allRecord);
+
+    // 上次全量落盘后追加的增量记录条数，长时任务线程与落盘线程共同访问
+    std::atomic<uint32_t> taskJournalCount_ {0};
+    std::atomic<bool> needCompactTaskJournal_ {false};
+    // 待落盘数据由独立线程合并写入，writeMutex_保证同一时刻只有一个线程写文件
+    std::mutex pendingMutex_;
+    std::mutex writeMutex_;
+    std::map<std::string, nlohmann::json> pendingSnapshots_;
+    std::vector<nlohmann::json> pendingTaskJournal_;
+    bool pendingClearTaskJournal_ {false};
+    bool persistFlushScheduled_ {false};
+    std::shared_ptr<AppExecFwk::EventHandler> persistHandler_ {nullptr};
 };
 }  // namespace BackgroundTaskMgr
 }  // namespace OHOS
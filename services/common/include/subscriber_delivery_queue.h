@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_COMMON_INCLUDE_SUBSCRIBER_DELIVERY_QUEUE_H
+#define FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_COMMON_INCLUDE_SUBSCRIBER_DELIVERY_QUEUE_H
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "event_handler.h"
+#include "ibackground_task_subscriber.h"
+#include "iremote_object.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace BackgroundTaskMgr {
+enum class DeliveryModule : uint32_t {
+    CONTINUOUS_TASK = 0,
+    TRANSIENT_TASK,
+    EFFICIENCY_RESOURCES,
+};
+
+/**
+ * 订阅者回调投递队列。每个模块的每个远端订阅者拥有独立队列，由少量工作线程批量取出回调，
+ * 看门狗发现单次回调超过时延预算时立即将该订阅者降级到独占线程，避免拖慢其他订阅者。
+ * 队列超过软上限时仅合并同一键的状态更新回调，超过硬上限时丢弃积压并摘除该订阅者。
+ */
+class SubscriberDeliveryQueue {
+    DECLARE_DELAYED_SINGLETON(SubscriberDeliveryQueue);
+public:
+    using DeliveryTask = std::function<void(const sptr<IBackgroundTaskSubscriber> &)>;
+
+    /**
+     * @brief 投递回调.
+     *
+     * @param coalesceKey 非空时表示可合并的状态更新回调，队列超限时替换同键的未投递回调.
+     */
+    void Deliver(DeliveryModule module, const sptr<IBackgroundTaskSubscriber> &subscriber,
+        const DeliveryTask &task, const std::string &coalesceKey = "");
+    void RemoveSubscriber(DeliveryModule module, const wptr<IRemoteObject> &remote);
+    void ShellDump(std::vector<std::string> &dumpInfo);
+
+private:
+    struct PendingTask {
+        std::string coalesceKey_ {""};
+        DeliveryTask task_ {nullptr};
+    };
+
+    struct SubscriberQueue {
+        sptr<IBackgroundTaskSubscriber> subscriber_ {nullptr};
+        std::deque<PendingTask> tasks_ {};
+        uint64_t id_ {0};
+        uint32_t workerIndex_ {0};
+        std::shared_ptr<AppExecFwk::EventHandler> dedicatedWorker_ {nullptr};
+        bool scheduled_ {false};
+        bool removed_ {false};
+        bool demoted_ {false};
+        bool detached_ {false};
+        bool inFlight_ {false};
+        uint64_t callSeq_ {0};
+        uint32_t fastTimes_ {0};
+        uint64_t deliveredCount_ {0};
+        uint64_t batchCount_ {0};
+        uint64_t overflowCount_ {0};
+        uint64_t coalescedCount_ {0};
+        int64_t maxLatency_ {0};
+    };
+
+    bool CoalesceLocked(const std::shared_ptr<SubscriberQueue> &queue, const std::string &coalesceKey,
+        const DeliveryTask &task);
+    void ScheduleDrainLocked(const std::shared_ptr<SubscriberQueue> &queue);
+    void DrainQueue(const std::shared_ptr<SubscriberQueue> &queue);
+    void BeginCallLocked(const std::shared_ptr<SubscriberQueue> &queue);
+    void EndCallLocked(const std::shared_ptr<SubscriberQueue> &queue, int64_t latency);
+    void CheckInFlightCall(const std::shared_ptr<SubscriberQueue> &queue, uint64_t callSeq);
+    void DemoteLocked(const std::shared_ptr<SubscriberQueue> &queue);
+    void RestoreLocked(const std::shared_ptr<SubscriberQueue> &queue);
+    void DetachLocked(const std::shared_ptr<SubscriberQueue> &queue);
+    void ReleaseDedicatedWorkerLocked(const std::shared_ptr<SubscriberQueue> &queue);
+    std::shared_ptr<AppExecFwk::EventHandler> GetQueueWorkerLocked(const std::shared_ptr<SubscriberQueue> &queue);
+    std::shared_ptr<AppExecFwk::EventHandler> GetWorkerLocked(uint32_t index);
+    std::shared_ptr<AppExecFwk::EventHandler> AcquireIdleWorkerLocked();
+    std::shared_ptr<AppExecFwk::EventHandler> GetMonitorLocked();
+
+private:
+    std::mutex queueMutex_;
+    std::map<std::pair<DeliveryModule, IRemoteObject *>, std::shared_ptr<SubscriberQueue>> queues_ {};
+    std::vector<std::shared_ptr<AppExecFwk::EventHandler>> workers_ {};
+    std::vector<std::shared_ptr<AppExecFwk::EventHandler>> idleWorkers_ {};
+    std::shared_ptr<AppExecFwk::EventHandler> monitor_ {nullptr};
+    uint32_t nextWorkerIndex_ {0};
+    uint32_t createdWorkerNum_ {0};
+    uint32_t dedicatedWorkerNum_ {0};
+    uint64_t nextQueueId_ {0};
+    uint64_t totalDelivered_ {0};
+    uint64_t totalDropped_ {0};
+    uint64_t totalCoalesced_ {0};
+    uint64_t totalDemoted_ {0};
+    uint64_t totalDetached_ {0};
+};
+}  // namespace BackgroundTaskMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_COMMON_INCLUDE_SUBSCRIBER_DELIVERY_QUEUE_H
@@ -38,6 +38,7 @@ public:
 private:
     void OnReceiveEventContinuousTask(const EventFwk::CommonEventData &eventData);
     void OnReceiveEventEfficiencyRes(const EventFwk::CommonEventData &eventData);
+    void InvalidateBundleNameCache(const EventFwk::CommonEventData &eventData);
 
 private:
     std::weak_ptr<AppExecFwk::EventHandler> handler_;
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_COMMON_INCLUDE_TIMER_WHEEL_H
+#define FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_COMMON_INCLUDE_TIMER_WHEEL_H
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "event_handler.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace BackgroundTaskMgr {
+enum class TimerWheelModule : uint32_t {
+    TRANSIENT_TASK_EXPIRED = 0,
+    TRANSIENT_TASK_WATCHDOG,
+    EFFICIENCY_APP_TIMEOUT,
+    EFFICIENCY_PROC_TIMEOUT,
+};
+
+/**
+ * 分层时间轮，统一管理短时任务超时、看门狗和能效资源超时定时器。
+ * 定时器以 (模块, id) 为键，插入、取消、重新设置均为 O(1)，同一刻度内到期的定时器合并为一次唤醒。
+ */
+class TimerWheel {
+    DECLARE_DELAYED_SINGLETON(TimerWheel);
+public:
+    using TimerCallback = std::function<void()>;
+
+    /**
+     * @brief 添加定时器，键已存在时重新设置到期时间.
+     *
+     * @param handler 到期回调投递的线程，为空时在时间轮线程直接执行.
+     */
+    bool AddTimer(TimerWheelModule module, int32_t id, int64_t delayTime, const TimerCallback &callback,
+        const std::shared_ptr<AppExecFwk::EventHandler> &handler);
+    void RemoveTimer(TimerWheelModule module, int32_t id);
+    bool HasTimer(TimerWheelModule module, int32_t id);
+    void ShellDump(std::vector<std::string> &dumpInfo);
+
+private:
+    struct TimerNode {
+        uint64_t key_ {0};
+        uint64_t expireTick_ {0};
+        uint64_t seq_ {0};
+        TimerCallback callback_ {nullptr};
+        std::weak_ptr<AppExecFwk::EventHandler> handler_ {};
+        bool hasHandler_ {false};
+    };
+    using TimerSlot = std::list<TimerNode>;
+    struct TimerLocation {
+        uint32_t level_ {0};
+        uint32_t slot_ {0};
+        TimerSlot::iterator iter_;
+    };
+
+    static uint64_t MakeKey(TimerWheelModule module, int32_t id);
+    static uint64_t GetNowTick();
+    void InsertLocked(TimerNode &&node);
+    void EraseLocked(const TimerLocation &location);
+    void AdvanceLocked(uint64_t targetTick, std::vector<TimerNode> &expired);
+    void StepLocked(std::vector<TimerNode> &expired);
+    void CascadeLocked(uint32_t level, uint32_t slot);
+    bool GetNextExpireTickLocked(uint64_t &nextTick);
+    void ScheduleWakeup();
+    void OnTick(uint64_t tick);
+    void Dispatch(std::vector<TimerNode> &expired);
+    bool ConsumeDispatched(uint64_t key, uint64_t seq);
+    std::shared_ptr<AppExecFwk::EventHandler> GetHandlerLocked();
+
+private:
+    static constexpr uint32_t WHEEL_LEVELS = 4;
+    static constexpr uint32_t WHEEL_BITS = 6;
+    static constexpr uint32_t WHEEL_SLOTS = 1 << WHEEL_BITS;
+
+    std::mutex wheelMutex_;
+    TimerSlot wheel_[WHEEL_LEVELS][WHEEL_SLOTS] {};
+    // 每层非空槽位的位图，用于快速跳过空闲刻度
+    uint64_t occupied_[WHEEL_LEVELS] {};
+    std::unordered_map<uint64_t, TimerLocation> timers_ {};
+    // 已到期但回调尚未执行的定时器，取消或重新设置时删除，回调执行前据此再次确认
+    std::unordered_map<uint64_t, uint64_t> dispatched_ {};
+    uint64_t nextSeq_ {0};
+    std::set<uint64_t> pendingWakeups_ {};
+    std::shared_ptr<AppExecFwk::EventHandler> handler_ {nullptr};
+    uint64_t currentTick_ {0};
+    // 仅在时间轮线程访问，防止同步投递的事件处理器重入
+    bool inTick_ {false};
+    uint64_t wakeupCount_ {0};
+    uint64_t expiredCount_ {0};
+    uint64_t coalescedCount_ {0};
+    uint64_t rescheduleCount_ {0};
+    uint64_t cancelCount_ {0};
+};
+}  // namespace BackgroundTaskMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_COMMON_INCLUDE_TIMER_WHEEL_H
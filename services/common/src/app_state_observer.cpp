@@ -98,7 +98,10 @@ void AppStateObserver::OnAppCacheStateChanged(const AppExecFwk::AppStateData &ap
     auto task = [uid, pid, bundleName]() {
         DelayedSingleton<BgTransientTaskMgr>::GetInstance()->OnAppCacheStateChanged(uid, pid, bundleName);
     };
-    handler_->PostTask(task, TASK_ON_APP_CACHE_STATE_CHANGED);
+    // 短时任务在自己的线程处理，不排在长时任务事件之后
+    auto transientHandler = DelayedSingleton<BgTransientTaskMgr>::GetInstance()->GetHandler();
+    auto handler = transientHandler != nullptr ? transientHandler : handler_;
+    handler->PostTask(task, TASK_ON_APP_CACHE_STATE_CHANGED);
 }
 
 void AppStateObserver::OnProcessCreated(const AppExecFwk::ProcessData &processData)
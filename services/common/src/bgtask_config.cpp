@@ -14,6 +14,9 @@
  */
 
 #include "bgtask_config.h"
+
+#include <cinttypes>
+
 #include "data_storage_helper.h"
 #include "res_sched_signature_validator.h"
 #include "bgtaskmgr_log_wrapper.h"
@@ -36,6 +39,8 @@ const std::string CONTINUOUS_TASK_KEEPING_EXEMPTED_LIST = "continuous_task_keepi
 const std::string CONTINUOUS_TASK_SPECIAL_EXEMPTED_LIST = "special_exempted_list";
 const std::string MALICIOUS_APP_BLOCKLIST = "malicious_app_blocklist";
 const std::string TRANSIENT_EXEMPTED_QUOTA = "transient_exempted_quota";
+const std::string TRANSIENT_STATE_MAX_SIZE = "transient_state_max_size";
+const std::string TRANSIENT_STATE_IDLE_TIME = "transient_state_idle_time";
 const std::string TRANSIENT_ERR_DELAYED_FROZEN_TIME = "transient_err_delayed_frozen_time";
 const std::string CONTINUOUS_SPECIAL_EXEMPTED_LIST = "special_exempted_list";
 const std::string BUNDLE_SIGNATURE = "bundle_signature";
@@ -70,6 +75,7 @@ void BgtaskConfig::LoadConfigFile()
     }
     ParseTransientTaskExemptedQuatoList(jsonObj);
     ParseTransientTaskExemptedQuato(jsonObj);
+    ParseTransientTaskStateEviction(jsonObj);
 }
 
 void BgtaskConfig::ParseTransientTaskExemptedQuatoList(const nlohmann::json &jsonObj)
@@ -92,6 +98,7 @@ void BgtaskConfig::ParseTransientTaskExemptedQuatoList(const nlohmann::json &jso
     for (const auto &app : transientTaskExemptedQuatoList_) {
         BGTASK_LOGI("ParseTransientTaskExemptedQuatoList: %{public}s.", app.c_str());
     }
+    transientConfigVersion_.fetch_add(1, std::memory_order_acq_rel);
 }
 
 bool BgtaskConfig::AddExemptedQuatoData(const std::string &configData, int32_t sourceType)
@@ -135,6 +142,7 @@ bool BgtaskConfig::AddExemptedQuatoData(const std::string &configData, int32_t s
         transientTaskExemptedQuato_ = jsonObj[TRANSIENT_ERR_DELAYED_FROZEN_TIME].get<int>();
         BGTASK_LOGI("suspend config transientTaskExemptedQuato: %{public}d", transientTaskExemptedQuato_);
     }
+    transientConfigVersion_.fetch_add(1, std::memory_order_acq_rel);
     return true;
 }
 
@@ -151,6 +159,7 @@ bool BgtaskConfig::SetCloudConfigParam(const nlohmann::json &jsonObj)
         SetContinuousTaskParam(params);
     }
     ParseBundleSignature(params);
+    transientConfigVersion_.fetch_add(1, std::memory_order_acq_rel);
     return true;
 }
 
@@ -277,20 +286,40 @@ void BgtaskConfig::ParseTransientTaskExemptedQuato(const nlohmann::json &jsonObj
     std::lock_guard<std::mutex> lock(configMutex_);
     transientTaskExemptedQuato_ = jsonObj[TRANSIENT_EXEMPTED_QUOTA].get<int32_t>();
     BGTASK_LOGI("transientTaskExemptedQuato_ %{public}d", transientTaskExemptedQuato_);
+    transientConfigVersion_.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void BgtaskConfig::ParseTransientTaskStateEviction(const nlohmann::json &jsonObj)
+{
+    if (jsonObj.is_null() || jsonObj.empty()) {
+        BGTASK_LOGE("jsonObj null");
+        return;
+    }
+    std::lock_guard<std::mutex> lock(configMutex_);
+    if (jsonObj.contains(TRANSIENT_STATE_MAX_SIZE) && jsonObj[TRANSIENT_STATE_MAX_SIZE].is_number_integer() &&
+        jsonObj[TRANSIENT_STATE_MAX_SIZE].get<int32_t>() > 0) {
+        transientTaskStateMaxSize_ = jsonObj[TRANSIENT_STATE_MAX_SIZE].get<int32_t>();
+    }
+    if (jsonObj.contains(TRANSIENT_STATE_IDLE_TIME) && jsonObj[TRANSIENT_STATE_IDLE_TIME].is_number_integer() &&
+        jsonObj[TRANSIENT_STATE_IDLE_TIME].get<int64_t>() > 0) {
+        transientTaskStateIdleTime_ = jsonObj[TRANSIENT_STATE_IDLE_TIME].get<int64_t>();
+    }
+    BGTASK_LOGI("transient state max size: %{public}d, idle time: %{public}" PRId64,
+        transientTaskStateMaxSize_, transientTaskStateIdleTime_);
 }
 
 bool BgtaskConfig::IsTransientTaskExemptedQuatoApp(const std::string &bundleName)
 {
-    bool isExempt = false;
-    {
-        std::lock_guard<std::mutex> lock(configMutex_);
-        if (transientTaskCloudExemptedQuatoList_.size() > 0) {
-            isExempt = transientTaskCloudExemptedQuatoList_.count(bundleName) > 0;
-        } else {
-            isExempt = transientTaskExemptedQuatoList_.count(bundleName) > 0;
-        }
+    return IsTransientTaskExemptedQuatoListed(bundleName) && CheckSignature(bundleName);
+}
+
+bool BgtaskConfig::IsTransientTaskExemptedQuatoListed(const std::string &bundleName)
+{
+    std::lock_guard<std::mutex> lock(configMutex_);
+    if (transientTaskCloudExemptedQuatoList_.size() > 0) {
+        return transientTaskCloudExemptedQuatoList_.count(bundleName) > 0;
     }
-    return isExempt && CheckSignature(bundleName);
+    return transientTaskExemptedQuatoList_.count(bundleName) > 0;
 }
 
 bool BgtaskConfig::IsTaskKeepingExemptedQuatoApp(const std::string &bundleName)
@@ -310,6 +339,18 @@ int32_t BgtaskConfig::GetTransientTaskExemptedQuato()
     return transientTaskExemptedQuato_;
 }
 
+int32_t BgtaskConfig::GetTransientTaskStateMaxSize()
+{
+    std::lock_guard<std::mutex> lock(configMutex_);
+    return transientTaskStateMaxSize_;
+}
+
+int64_t BgtaskConfig::GetTransientTaskStateIdleTime()
+{
+    std::lock_guard<std::mutex> lock(configMutex_);
+    return transientTaskStateIdleTime_;
+}
+
 void BgtaskConfig::SetSupportedTaskKeepingProcesses(const std::set<std::string> &processSet)
 {
     std::lock_guard<std::mutex> lock(configMutex_);
@@ -20,6 +20,7 @@
 #include "system_ability_definition.h"
 #include "tokenid_kit.h"
 
+#include "bundle_name_cache.h"
 #include "continuous_task_log.h"
 
 namespace OHOS {
@@ -47,11 +48,7 @@ BundleManagerHelper::~BundleManagerHelper()
 std::string BundleManagerHelper::GetClientBundleName(int32_t uid)
 {
     std::string bundle {""};
-    std::lock_guard<std::mutex> lock(connectionMutex_);
-    Connect();
-    if (bundleMgr_ != nullptr) {
-        bundleMgr_->GetNameForUid(uid, bundle);
-    }
+    DelayedSingleton<BundleNameCache>::GetInstance()->GetBundleName(uid, bundle);
     BGTASK_LOGD("get client Bundle Name: %{public}s", bundle.c_str());
     return bundle;
 }
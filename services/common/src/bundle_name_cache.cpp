@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bundle_name_cache.h"
+
+#include <sstream>
+
+#include "bgtaskmgr_log_wrapper.h"
+#include "bundle_mgr_interface.h"
+#include "iservice_registry.h"
+#include "system_ability_definition.h"
+
+namespace OHOS {
+namespace BackgroundTaskMgr {
+namespace {
+static constexpr size_t MAX_CACHE_SIZE = 512;
+static constexpr int32_t UID_TRANSFORM_DIVISOR = 200000;
+}
+
+BundleNameCache::BundleNameCache() {}
+
+BundleNameCache::~BundleNameCache() {}
+
+bool BundleNameCache::GetBundleName(int32_t uid, std::string &bundleName)
+{
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        if (FindLocked(uid, bundleName)) {
+            hitCount_++;
+            return true;
+        }
+        missCount_++;
+        generation = generation_;
+    }
+    // 跨进程查询不持锁，避免阻塞其他 uid 的命中
+    if (!QueryBundleName(uid, bundleName)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    FillLocked(uid, bundleName, generation);
+    return true;
+}
+
+bool BundleNameCache::QueryBundleName(int32_t uid, std::string &bundleName)
+{
+    sptr<ISystemAbilityManager> systemMgr = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
+    if (systemMgr == nullptr) {
+        BGTASK_LOGE("Fail to get system ability mgr");
+        return false;
+    }
+    sptr<IRemoteObject> remoteObject = systemMgr->GetSystemAbility(BUNDLE_MGR_SERVICE_SYS_ABILITY_ID);
+    if (remoteObject == nullptr) {
+        BGTASK_LOGE("Fail to get bundle manager proxy");
+        return false;
+    }
+    sptr<AppExecFwk::IBundleMgr> bundleMgrProxy = iface_cast<AppExecFwk::IBundleMgr>(remoteObject);
+    if (bundleMgrProxy == nullptr) {
+        BGTASK_LOGE("Bundle mgr proxy is nullptr");
+        return false;
+    }
+    if (bundleMgrProxy->GetNameForUid(uid, bundleName) != ERR_OK || bundleName.empty()) {
+        BGTASK_LOGD("get bundle name of uid: %{public}d failed", uid);
+        return false;
+    }
+    return true;
+}
+
+void BundleNameCache::Invalidate(int32_t uid)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    // 未缓存的 uid 也要递增，正在进行的查询可能即将回填该 uid
+    generation_++;
+    auto iter = entries_.find(uid);
+    if (iter == entries_.end()) {
+        return;
+    }
+    lruList_.erase(iter->second.lruIter_);
+    entries_.erase(iter);
+    invalidateCount_++;
+}
+
+void BundleNameCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    generation_++;
+    invalidateCount_ += entries_.size();
+    lruList_.clear();
+    entries_.clear();
+}
+
+bool BundleNameCache::FindLocked(int32_t uid, std::string &bundleName)
+{
+    auto iter = entries_.find(uid);
+    if (iter == entries_.end()) {
+        return false;
+    }
+    lruList_.splice(lruList_.begin(), lruList_, iter->second.lruIter_);
+    bundleName = iter->second.bundleName_;
+    return true;
+}
+
+void BundleNameCache::PutLocked(int32_t uid, const std::string &bundleName)
+{
+    auto iter = entries_.find(uid);
+    if (iter != entries_.end()) {
+        iter->second.bundleName_ = bundleName;
+        lruList_.splice(lruList_.begin(), lruList_, iter->second.lruIter_);
+        return;
+    }
+    if (entries_.size() >= MAX_CACHE_SIZE) {
+        entries_.erase(lruList_.back());
+        lruList_.pop_back();
+    }
+    lruList_.emplace_front(uid);
+    CacheEntry entry;
+    entry.bundleName_ = bundleName;
+    entry.userId_ = uid / UID_TRANSFORM_DIVISOR;
+    entry.lruIter_ = lruList_.begin();
+    entries_.emplace(uid, entry);
+}
+
+bool BundleNameCache::FillLocked(int32_t uid, const std::string &bundleName, uint64_t generation)
+{
+    if (generation != generation_) {
+        BGTASK_LOGD("uid: %{public}d invalidated during query, skip fill", uid);
+        staleFillCount_++;
+        return false;
+    }
+    PutLocked(uid, bundleName);
+    return true;
+}
+
+void BundleNameCache::ShellDump(std::vector<std::string> &dumpInfo)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    std::stringstream stream;
+    stream << "bundle name cache, size: " << entries_.size() << ", hit: " << hitCount_
+        << ", miss: " << missCount_ << ", invalidate: " << invalidateCount_
+        << ", stale fill: " << staleFillCount_ << "\n";
+    uint32_t index = 1;
+    for (const auto &uid : lruList_) {
+        const auto &entry = entries_[uid];
+        stream << "No." << index++;
+        stream << "\tuid: " << uid << "\n";
+        stream << "\tuserId: " << entry.userId_ << "\n";
+        stream << "\tbundleName: " << entry.bundleName_ << "\n";
+    }
+    dumpInfo.emplace_back(stream.str());
+}
+}  // namespace BackgroundTaskMgr
+}  // namespace OHOS
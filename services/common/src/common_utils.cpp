@@ -42,6 +42,11 @@ bool CommonUtils::CheckExistNotification(const std::vector<int32_t> &notificatio
 
 bool CommonUtils::CheckModesSame(const std::vector<uint32_t> &oldBgModeIds, const std::vector<uint32_t> &newBgModeIds)
 {
+    BgModeSet oldModes(oldBgModeIds);
+    BgModeSet newModes(newBgModeIds);
+    if (oldModes.IsRepresentable() && newModes.IsRepresentable()) {
+        return CheckModesSame(oldModes, newModes);
+    }
     std::set<uint32_t> oldModesSet(oldBgModeIds.begin(), oldBgModeIds.end());
     std::set<uint32_t> newModesSet(newBgModeIds.begin(), newBgModeIds.end());
     return oldModesSet == newModesSet;
@@ -59,6 +64,11 @@ std::string CommonUtils::ModesToString(const std::vector<uint32_t> &bgmodes)
 bool CommonUtils::CheckApplyMode(const std::vector<uint32_t> &applyBgModeIds,
     const std::vector<uint32_t> &checkBgModeIds)
 {
+    BgModeSet applyModes(applyBgModeIds);
+    BgModeSet checkModes(checkBgModeIds);
+    if (applyModes.IsRepresentable()) {
+        return CheckApplyMode(applyModes, checkModes);
+    }
     for (const auto &mode : applyBgModeIds) {
         auto iter = std::find(checkBgModeIds.begin(), checkBgModeIds.end(), mode);
         if (iter == checkBgModeIds.end()) {
@@ -71,11 +81,12 @@ bool CommonUtils::CheckApplyMode(const std::vector<uint32_t> &applyBgModeIds,
 bool CommonUtils::CheckExistOtherMode(
     const std::vector<uint32_t> &bgModeIds, uint32_t bgMode, const std::set<uint32_t> &liveViewTypes)
 {
-    std::set<uint32_t> taskTypesSet(bgModeIds.begin(), bgModeIds.end());
-    std::set<uint32_t> otherTypes = liveViewTypes;
-    otherTypes.erase(bgMode);
-    for (const auto& type : otherTypes) {
-        if (taskTypesSet.find(type) != taskTypesSet.end()) {
+    BgModeSet taskTypes(bgModeIds);
+    if (taskTypes.IsRepresentable()) {
+        return CheckExistOtherMode(taskTypes, bgMode, liveViewTypes);
+    }
+    for (const auto& type : liveViewTypes) {
+        if (type != bgMode && CheckExistMode(bgModeIds, type)) {
             return true;
         }
     }
@@ -90,23 +101,54 @@ bool CommonUtils::CheckStrToNum(const std::string &value)
 
 void CommonUtils::SortMode(std::vector<uint32_t> &bgModeIds)
 {
-    std::vector<uint32_t> result;
-    std::vector<uint32_t> target = {
+    SortMode(bgModeIds, BgModeSet(bgModeIds));
+}
+
+bool CommonUtils::CheckModesSame(const BgModeSet &oldModes, const BgModeSet &newModes)
+{
+    return oldModes == newModes;
+}
+
+bool CommonUtils::CheckApplyMode(const BgModeSet &applyModes, const BgModeSet &checkModes)
+{
+    return checkModes.ContainsAll(applyModes);
+}
+
+bool CommonUtils::CheckExistOtherMode(const BgModeSet &modes, uint32_t bgMode, const std::set<uint32_t> &liveViewTypes)
+{
+    for (const auto& type : liveViewTypes) {
+        if (type != bgMode && modes.Contains(type)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CommonUtils::SortMode(std::vector<uint32_t> &bgModeIds, const BgModeSet &modes)
+{
+    // 优先数据传输、录制、定位，其余保持原有顺序
+    static constexpr uint32_t target[] = {
         BackgroundMode::DATA_TRANSFER,
         BackgroundMode::AUDIO_RECORDING,
         BackgroundMode::LOCATION
     };
+    BgModeSet targetModes;
+    for (const auto mode : target) {
+        targetModes.Add(mode);
+    }
+    std::vector<uint32_t> result;
+    result.reserve(bgModeIds.size());
     for (const auto mode : target) {
-        if (std::find(bgModeIds.begin(), bgModeIds.end(), mode) != bgModeIds.end()) {
+        if (modes.Contains(mode)) {
             result.push_back(mode);
         }
     }
     for (const auto mode : bgModeIds) {
-        if (std::find(target.begin(), target.end(), mode) == target.end()) {
+        if (!targetModes.Contains(mode)) {
             result.push_back(mode);
         }
     }
-    bgModeIds = result;
+    bgModeIds.swap(result);
 }
 }  // namespace SuspendManager
 }  // namespace OHOS
\ No newline at end of file
@@ -17,9 +17,11 @@
 #include <fcntl.h>
 #include <file_ex.h>
 #include <fstream>
+#include <iterator>
 #include <unistd.h>
 #include <securec.h>
 #include <sstream>
+#include <sys/mman.h>
 #include <sys/sendfile.h>
 #include <sys/stat.h>
 #include <sys/statfs.h>
@@ -28,14 +30,19 @@
 #include "continuous_task_log.h"
 #include "config_policy_utils.h"
 #include "directory_ex.h"
+#include "event_runner.h"
 #include "hisysevent.h"
 
 namespace OHOS {
 namespace BackgroundTaskMgr {
 namespace {
 static constexpr char TASK_RECORD_FILE_PATH[] = "/data/service/el1/public/background_task_mgr/running_task";
+static constexpr char TASK_JOURNAL_FILE_PATH[] = "/data/service/el1/public/background_task_mgr/running_task_journal";
 static const std::string RESOURCE_RECORD_FILE_PATH = "/data/service/el1/public/background_task_mgr/resource_record";
 static constexpr char AUTH_RECORD_FILE_PATH[] = "/data/service/el1/public/background_task_mgr/auth_record";
+static constexpr char AUTH_RECORD_BACKUP_FILE_PATH[] =
+    "/data/service/el1/public/background_task_mgr/auth_record_backup";
+static constexpr char SNAPSHOT_TMP_SUFFIX[] = ".tmp";
 static const std::string APP_RESOURCE_RECORD = "appResourceRecord";
 static const std::string PROCESS_RESOURCE_RECORD = "processResourceRecord";
 static const std::string AUTH_RECORD = "authRecord";
@@ -46,6 +53,77 @@ const std::string DOZE_TIME = "doze_time";
 constexpr int32_t EXTENSION_SUCCESS_CODE = 0;
 constexpr int32_t EXTENSION_ERROR_CODE = 13500099;
 constexpr int32_t MAX_AUTH_RECORD_SIZE = 400 * 1000; // 单个应用授权记录数据大小为400
+// 增量记录达到该条数后，全量落盘一次并清空增量文件
+constexpr uint32_t MAX_TASK_JOURNAL_COUNT = 100;
+// 落盘请求合并窗口，窗口内的多次修改只写一次文件
+constexpr int32_t PERSIST_DELAY_TIME = 100;
+static constexpr char PERSIST_RUNNER_NAME[] = "bgtask_persist";
+static constexpr char PERSIST_FLUSH_TASK[] = "bgtask_persist_flush";
+const std::string JOURNAL_OP = "op";
+const std::string JOURNAL_KEY = "key";
+const std::string JOURNAL_RECORD = "record";
+const std::string JOURNAL_OP_PUT = "put";
+const std::string JOURNAL_OP_REMOVE = "remove";
+// 二进制快照文件头："BGTS" + 版本号 + 数据长度 + 数据CRC32，数据部分为msgpack编码
+constexpr uint32_t SNAPSHOT_MAGIC = 0x53544742;
+constexpr uint32_t SNAPSHOT_VERSION = 1;
+constexpr uint32_t CRC32_POLYNOMIAL = 0xEDB88320;
+constexpr uint32_t CRC32_TABLE_SIZE = 256;
+constexpr uint32_t BITS_PER_BYTE = 8;
+
+struct SnapshotHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t length;
+    uint32_t crc;
+};
+
+uint32_t CalculateCrc32(const uint8_t *data, size_t length)
+{
+    static const std::vector<uint32_t> crcTable = []() {
+        std::vector<uint32_t> table(CRC32_TABLE_SIZE);
+        for (uint32_t i = 0; i < CRC32_TABLE_SIZE; i++) {
+            uint32_t crc = i;
+            for (uint32_t bit = 0; bit < BITS_PER_BYTE; bit++) {
+                crc = (crc & 1) ? ((crc >> 1) ^ CRC32_POLYNOMIAL) : (crc >> 1);
+            }
+            table[i] = crc;
+        }
+        return table;
+    }();
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc = crcTable[(crc ^ data[i]) & 0xFF] ^ (crc >> BITS_PER_BYTE);
+    }
+    return crc ^ 0xFFFFFFFF;
+}
+
+bool WriteAll(int32_t fd, const uint8_t *data, size_t length)
+{
+    size_t written = 0;
+    while (written < length) {
+        ssize_t ret = write(fd, data + written, length - written);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            return false;
+        }
+        written += static_cast<size_t>(ret);
+    }
+    return true;
+}
+
+// rename 只修改目录项，需同步父目录才能保证掉电后新文件名可见
+void FsyncParentDir(const std::string &filePath)
+{
+    size_t pos = filePath.find_last_of('/');
+    std::string dirPath = (pos == std::string::npos || pos == 0) ? "/" : filePath.substr(0, pos);
+    UniqueFd dirFd(open(dirPath.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+    if (dirFd.Get() < 0 || fsync(dirFd.Get()) != 0) {
+        BGTASK_LOGE("Fail to sync dir: %{private}s, errno: %{public}s", dirPath.c_str(), strerror(errno));
+    }
+}
 }
 
 DataStorageHelper::DataStorageHelper() {}
@@ -55,55 +133,372 @@ DataStorageHelper::~DataStorageHelper() {}
 ErrCode DataStorageHelper::RefreshTaskRecord(const std::unordered_map<std::string,
     std::shared_ptr<ContinuousTaskRecord>> &allRecord)
 {
-    nlohmann::json root;
+    nlohmann::json root = nlohmann::json::object();
     for (const auto &iter : allRecord) {
-        auto record = iter.second;
-        std::string data = record->ParseToJsonStr();
-        nlohmann::json recordJson = nlohmann::json::parse(data, nullptr, false);;
-        if (!recordJson.is_discarded()) {
-            root[iter.first] = recordJson;
+        if (iter.second != nullptr) {
+            iter.second->ParseToJson(root[iter.first]);
         }
     }
-    if (access(TASK_RECORD_FILE_PATH, F_OK) == ERR_OK) {
-        BGTASK_LOGD("the file: %{private}s already exists.", TASK_RECORD_FILE_PATH);
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    taskJournalCount_ = 0;
+    needCompactTaskJournal_ = false;
+    // 全量数据覆盖之前所有修改，未落盘的增量记录可以丢弃；全量落盘失败时由RequeueTaskSnapshot重新入队
+    pendingSnapshots_[TASK_RECORD_FILE_PATH] = std::move(root);
+    pendingTaskJournal_.clear();
+    pendingClearTaskJournal_ = true;
+    SchedulePersistFlush();
+    return ERR_OK;
+}
+
+ErrCode DataStorageHelper::RefreshTaskRecord(const std::string &key,
+    const std::unordered_map<std::string, std::shared_ptr<ContinuousTaskRecord>> &allRecord)
+{
+    if (taskJournalCount_ >= MAX_TASK_JOURNAL_COUNT || needCompactTaskJournal_) {
+        BGTASK_LOGI("task journal count: %{public}u, compact to snapshot", taskJournalCount_.load());
+        return RefreshTaskRecord(allRecord);
+    }
+    nlohmann::json entry;
+    entry[JOURNAL_KEY] = key;
+    auto iter = allRecord.find(key);
+    if (iter == allRecord.end() || iter->second == nullptr) {
+        entry[JOURNAL_OP] = JOURNAL_OP_REMOVE;
     } else {
-        FILE *file = fopen(TASK_RECORD_FILE_PATH, "w+");
-        if (file == nullptr) {
-            BGTASK_LOGE("Fail to open file: %{private}s, errno: %{public}s", TASK_RECORD_FILE_PATH, strerror(errno));
-            return ERR_BGTASK_CREATE_FILE_ERR;
+        entry[JOURNAL_OP] = JOURNAL_OP_PUT;
+        iter->second->ParseToJson(entry[JOURNAL_RECORD]);
+    }
+    taskJournalCount_++;
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    pendingTaskJournal_.emplace_back(std::move(entry));
+    SchedulePersistFlush();
+    return ERR_OK;
+}
+
+void DataStorageHelper::MarkSnapshotDirty(const std::string &filePath, nlohmann::json &&root)
+{
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    pendingSnapshots_[filePath] = std::move(root);
+    SchedulePersistFlush();
+}
+
+void DataStorageHelper::SchedulePersistFlush()
+{
+    if (persistFlushScheduled_) {
+        return;
+    }
+    if (persistHandler_ == nullptr) {
+        auto runner = AppExecFwk::EventRunner::Create(PERSIST_RUNNER_NAME);
+        if (runner == nullptr) {
+            BGTASK_LOGE("create persist runner fail");
+            return;
         }
-        int closeResult = fclose(file);
-        if (closeResult < 0) {
-            BGTASK_LOGE("Fail to close file: %{private}s, errno: %{public}s", TASK_RECORD_FILE_PATH, strerror(errno));
-            return ERR_BGTASK_CREATE_FILE_ERR;
+        persistHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
+    }
+    auto task = []() {
+        DelayedSingleton<DataStorageHelper>::GetInstance()->FlushPersistenceData();
+    };
+    if (persistHandler_->PostTask(task, PERSIST_FLUSH_TASK, PERSIST_DELAY_TIME)) {
+        persistFlushScheduled_ = true;
+    }
+}
+
+void DataStorageHelper::FlushPersistenceData()
+{
+    std::lock_guard<std::mutex> writeLock(writeMutex_);
+    std::map<std::string, nlohmann::json> snapshots;
+    std::vector<nlohmann::json> taskJournal;
+    bool clearTaskJournal = false;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        snapshots.swap(pendingSnapshots_);
+        taskJournal.swap(pendingTaskJournal_);
+        std::swap(clearTaskJournal, pendingClearTaskJournal_);
+        persistFlushScheduled_ = false;
+    }
+    for (auto &iter : snapshots) {
+        if (SaveSnapshotToFile(iter.second, iter.first) != ERR_OK) {
+            BGTASK_LOGE("save snapshot fail, file: %{private}s", iter.first.c_str());
+            if (iter.first == TASK_RECORD_FILE_PATH) {
+                // 磁盘上仍是旧的全量数据和增量记录，本次的增量记录不能追加到旧记录之后
+                RequeueTaskSnapshot(std::move(iter.second), taskJournal);
+            }
+            continue;
         }
+        if (iter.first == TASK_RECORD_FILE_PATH && clearTaskJournal) {
+            ClearTaskJournal();
+        }
+    }
+    if (!taskJournal.empty() && AppendTaskJournal(taskJournal) != ERR_OK) {
+        // 增量记录写入失败，下次修改时全量落盘
+        needCompactTaskJournal_ = true;
     }
-    return SaveJsonValueToFile(root.dump(CommonUtils::jsonFormat_), TASK_RECORD_FILE_PATH);
+}
+
+void DataStorageHelper::RequeueTaskSnapshot(nlohmann::json &&snapshot, std::vector<nlohmann::json> &taskJournal)
+{
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    if (pendingSnapshots_.find(TASK_RECORD_FILE_PATH) == pendingSnapshots_.end()) {
+        // 失败的全量数据放回队首，其后的增量记录排在新增记录之前，等下次落盘时重试
+        pendingSnapshots_[TASK_RECORD_FILE_PATH] = std::move(snapshot);
+        pendingTaskJournal_.insert(pendingTaskJournal_.begin(), std::make_move_iterator(taskJournal.begin()),
+            std::make_move_iterator(taskJournal.end()));
+        pendingClearTaskJournal_ = true;
+    }
+    // 已有更新的全量数据时，失败的全量数据及其增量记录均已被覆盖
+    taskJournal.clear();
 }
 
 ErrCode DataStorageHelper::RestoreTaskRecord(std::unordered_map<std::string,
     std::shared_ptr<ContinuousTaskRecord>> &allRecord)
 {
+    FlushPersistenceData();
     nlohmann::json root;
-    if (ParseJsonValueFromFile(root, TASK_RECORD_FILE_PATH) != ERR_OK) {
+    bool hasSnapshot = ParseSnapshotFromFile(root, TASK_RECORD_FILE_PATH) == ERR_OK;
+    if (hasSnapshot) {
+        for (auto iter = root.begin(); iter != root.end(); iter++) {
+            nlohmann::json recordJson = iter.value();
+            std::shared_ptr<ContinuousTaskRecord> record = std::make_shared<ContinuousTaskRecord>();
+            if (record->ParseFromJson(recordJson)) {
+                allRecord.emplace(iter.key(), record);
+            }
+        }
+    }
+    // 在全量数据基础上重放增量记录
+    bool hasJournal = ReplayTaskJournal(allRecord);
+    if (!hasSnapshot && !hasJournal) {
         return ERR_BGTASK_DATA_STORAGE_ERR;
     }
-    for (auto iter = root.begin(); iter != root.end(); iter++) {
-        nlohmann::json recordJson = iter.value();
-        std::shared_ptr<ContinuousTaskRecord> record = std::make_shared<ContinuousTaskRecord>();
-        if (record->ParseFromJson(recordJson)) {
-            allRecord.emplace(iter.key(), record);
+    return ERR_OK;
+}
+
+std::string DataStorageHelper::DumpCompactJson(const nlohmann::json &root)
+{
+    // 落盘数据无需缩进，非法UTF-8字符替换后写入，避免dump抛异常
+    return root.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace);
+}
+
+ErrCode DataStorageHelper::SaveSnapshotToFile(const nlohmann::json &root, const std::string &filePath)
+{
+    std::vector<uint8_t> payload = nlohmann::json::to_msgpack(root);
+    if (payload.size() > UINT32_MAX) {
+        BGTASK_LOGE("snapshot size: %{public}zu is too large", payload.size());
+        return ERR_BGTASK_DATA_STORAGE_ERR;
+    }
+    SnapshotHeader header {SNAPSHOT_MAGIC, SNAPSHOT_VERSION, static_cast<uint32_t>(payload.size()),
+        CalculateCrc32(payload.data(), payload.size())};
+    // 先写临时文件再rename，保证异常掉电时旧快照完整可用
+    std::string tmpPath = filePath + SNAPSHOT_TMP_SUFFIX;
+    UniqueFd fd(open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR));
+    if (fd.Get() < 0) {
+        BGTASK_LOGE("Fail to open file: %{private}s, errno: %{public}s", tmpPath.c_str(), strerror(errno));
+        return ERR_BGTASK_CREATE_FILE_ERR;
+    }
+    if (!WriteAll(fd.Get(), reinterpret_cast<const uint8_t *>(&header), sizeof(header)) ||
+        !WriteAll(fd.Get(), payload.data(), payload.size()) || fsync(fd.Get()) != 0) {
+        BGTASK_LOGE("Fail to write file: %{private}s, errno: %{public}s", tmpPath.c_str(), strerror(errno));
+        unlink(tmpPath.c_str());
+        return ERR_BGTASK_DATA_STORAGE_ERR;
+    }
+    if (rename(tmpPath.c_str(), filePath.c_str()) != 0) {
+        BGTASK_LOGE("Fail to rename file: %{private}s, errno: %{public}s", filePath.c_str(), strerror(errno));
+        unlink(tmpPath.c_str());
+        return ERR_BGTASK_DATA_STORAGE_ERR;
+    }
+    FsyncParentDir(filePath);
+    if (filePath == TASK_RECORD_FILE_PATH) {
+        ReportUserDataSizeEvent();
+    }
+    return ERR_OK;
+}
+
+int32_t DataStorageHelper::ParseSnapshotFromFile(nlohmann::json &value, const std::string &filePath)
+{
+    std::string realPath;
+    if (!ConvertFullPath(filePath, realPath)) {
+        BGTASK_LOGD("Get real path failed");
+        return ERR_BGTASK_DATA_STORAGE_ERR;
+    }
+    UniqueFd fd(open(realPath.c_str(), O_RDONLY | O_CLOEXEC));
+    struct stat statBuf;
+    if (fd.Get() < 0 || fstat(fd.Get(), &statBuf) < 0) {
+        BGTASK_LOGE("Fail to open file: %{private}s, errno: %{public}s", filePath.c_str(), strerror(errno));
+        return ERR_BGTASK_DATA_STORAGE_ERR;
+    }
+    size_t fileSize = static_cast<size_t>(statBuf.st_size);
+    if (fileSize < sizeof(SnapshotHeader)) {
+        return ParseJsonValueFromFile(value, filePath);
+    }
+    void *addr = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd.Get(), 0);
+    if (addr == MAP_FAILED) {
+        BGTASK_LOGE("Fail to mmap file: %{private}s, errno: %{public}s", filePath.c_str(), strerror(errno));
+        return ERR_BGTASK_DATA_STORAGE_ERR;
+    }
+    const uint8_t *data = static_cast<const uint8_t *>(addr);
+    SnapshotHeader header;
+    if (memcpy_s(&header, sizeof(header), data, sizeof(header)) != EOK) {
+        munmap(addr, fileSize);
+        return ERR_BGTASK_DATA_STORAGE_ERR;
+    }
+    if (header.magic != SNAPSHOT_MAGIC) {
+        // 旧版本JSON格式文件，下次落盘时转换为二进制格式
+        munmap(addr, fileSize);
+        BGTASK_LOGI("file: %{private}s is not snapshot, parse as json", filePath.c_str());
+        return ParseJsonValueFromFile(value, filePath);
+    }
+    const uint8_t *payload = data + sizeof(SnapshotHeader);
+    size_t payloadSize = fileSize - sizeof(SnapshotHeader);
+    if (header.version != SNAPSHOT_VERSION || header.length != payloadSize ||
+        header.crc != CalculateCrc32(payload, payloadSize)) {
+        munmap(addr, fileSize);
+        BGTASK_LOGE("snapshot file: %{private}s is broken, version: %{public}u", filePath.c_str(), header.version);
+        return ERR_BGTASK_DATA_STORAGE_ERR;
+    }
+    value = nlohmann::json::from_msgpack(payload, payload + payloadSize, true, false);
+    munmap(addr, fileSize);
+    if (value.is_discarded()) {
+        BGTASK_LOGE("failed due to data is discarded");
+        return ERR_BGTASK_DATA_STORAGE_ERR;
+    }
+    return ERR_OK;
+}
+
+ErrCode DataStorageHelper::ExportSnapshotToJson(const std::string &filePath, std::string &jsonStr)
+{
+    nlohmann::json root;
+    int32_t ret = ParseSnapshotFromFile(root, filePath);
+    if (ret != ERR_OK) {
+        return ret;
+    }
+    jsonStr = root.dump(CommonUtils::jsonFormat_, ' ', false, nlohmann::json::error_handler_t::replace);
+    return ERR_OK;
+}
+
+ErrCode DataStorageHelper::ExportJsonToFile(const std::string &srcPath, const std::string &destPath)
+{
+    std::string jsonStr;
+    ErrCode ret = ExportSnapshotToJson(srcPath, jsonStr);
+    if (ret != ERR_OK) {
+        BGTASK_LOGE("export file: %{private}s to json fail", srcPath.c_str());
+        return ret;
+    }
+    FILE *file = fopen(destPath.c_str(), "w+");
+    if (file == nullptr) {
+        BGTASK_LOGE("Fail to open file: %{private}s, errno: %{public}s", destPath.c_str(), strerror(errno));
+        return ERR_BGTASK_CREATE_FILE_ERR;
+    }
+    size_t res = fwrite(jsonStr.c_str(), 1, jsonStr.length(), file);
+    if (res != jsonStr.length()) {
+        BGTASK_LOGE("Fail to write file: %{private}s, errno: %{public}s", destPath.c_str(), strerror(errno));
+        fclose(file);
+        return ERR_BGTASK_DATA_STORAGE_ERR;
+    }
+    if (fclose(file) < 0) {
+        BGTASK_LOGE("Fail to close file: %{private}s, errno: %{public}s", destPath.c_str(), strerror(errno));
+        return ERR_BGTASK_DATA_STORAGE_ERR;
+    }
+    return ERR_OK;
+}
+
+void DataStorageHelper::DumpPersistenceData(std::vector<std::string> &dumpInfo)
+{
+    FlushPersistenceData();
+    std::vector<std::string> filePaths = {TASK_RECORD_FILE_PATH, RESOURCE_RECORD_FILE_PATH, AUTH_RECORD_FILE_PATH};
+    for (const auto &filePath : filePaths) {
+        std::string jsonStr;
+        if (ExportSnapshotToJson(filePath, jsonStr) != ERR_OK) {
+            dumpInfo.emplace_back(filePath + ": parse fail\n");
+            continue;
         }
+        dumpInfo.emplace_back(filePath + ":\n" + jsonStr + "\n");
+    }
+    dumpInfo.emplace_back("task journal count: " + std::to_string(taskJournalCount_.load()) + "\n");
+}
+
+ErrCode DataStorageHelper::AppendTaskJournal(const std::vector<nlohmann::json> &entries)
+{
+    FILE *file = fopen(TASK_JOURNAL_FILE_PATH, "a");
+    if (file == nullptr) {
+        BGTASK_LOGE("Fail to open file: %{private}s, errno: %{public}s", TASK_JOURNAL_FILE_PATH, strerror(errno));
+        return ERR_BGTASK_OPEN_FILE_ERR;
+    }
+    std::string lines;
+    for (const auto &entry : entries) {
+        lines.append(DumpCompactJson(entry)).append("\n");
+    }
+    size_t res = fwrite(lines.c_str(), 1, lines.length(), file);
+    if (res != lines.length() || fflush(file) != 0 || fsync(fileno(file)) != 0) {
+        BGTASK_LOGE("Fail to write file: %{private}s, errno: %{public}s", TASK_JOURNAL_FILE_PATH, strerror(errno));
+        fclose(file);
+        return ERR_BGTASK_DATA_STORAGE_ERR;
+    }
+    if (fclose(file) < 0) {
+        BGTASK_LOGE("Fail to close file: %{private}s, errno: %{public}s", TASK_JOURNAL_FILE_PATH, strerror(errno));
+        return ERR_BGTASK_DATA_STORAGE_ERR;
     }
     return ERR_OK;
 }
 
+ErrCode DataStorageHelper::ClearTaskJournal()
+{
+    if (access(TASK_JOURNAL_FILE_PATH, F_OK) != ERR_OK) {
+        return ERR_OK;
+    }
+    if (truncate(TASK_JOURNAL_FILE_PATH, 0) != 0) {
+        BGTASK_LOGE("Fail to truncate file: %{private}s, errno: %{public}s", TASK_JOURNAL_FILE_PATH, strerror(errno));
+        return ERR_BGTASK_DATA_STORAGE_ERR;
+    }
+    return ERR_OK;
+}
+
+bool DataStorageHelper::ReplayTaskJournal(
+    std::unordered_map<std::string, std::shared_ptr<ContinuousTaskRecord>> &allRecord)
+{
+    std::string realPath;
+    if (!ConvertFullPath(TASK_JOURNAL_FILE_PATH, realPath)) {
+        return false;
+    }
+    std::ifstream fin(realPath);
+    if (!fin.is_open()) {
+        BGTASK_LOGE("Open file: %{private}s failed.", TASK_JOURNAL_FILE_PATH);
+        return false;
+    }
+    uint32_t count = 0;
+    std::string line;
+    while (std::getline(fin, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        nlohmann::json entry = nlohmann::json::parse(line, nullptr, false);
+        // 异常掉电可能导致最后一条记录不完整，丢弃后续内容
+        if (entry.is_discarded() || !entry.is_object() || !CommonUtils::CheckJsonValue(entry, {JOURNAL_OP, JOURNAL_KEY})
+            || !entry[JOURNAL_OP].is_string() || !entry[JOURNAL_KEY].is_string()) {
+            BGTASK_LOGW("task journal is broken, stop replay at entry: %{public}u", count);
+            break;
+        }
+        count++;
+        std::string key = entry.at(JOURNAL_KEY).get<std::string>();
+        if (entry.at(JOURNAL_OP).get<std::string>() == JOURNAL_OP_REMOVE) {
+            allRecord.erase(key);
+            continue;
+        }
+        if (!entry.contains(JOURNAL_RECORD)) {
+            continue;
+        }
+        std::shared_ptr<ContinuousTaskRecord> record = std::make_shared<ContinuousTaskRecord>();
+        if (record->ParseFromJson(entry[JOURNAL_RECORD])) {
+            allRecord[key] = record;
+        }
+    }
+    taskJournalCount_ = count;
+    return true;
+}
+
 ErrCode DataStorageHelper::RestoreAuthRecord(std::unordered_map<std::string,
     std::shared_ptr<BannerNotificationRecord>> &authRecord)
 {
+    FlushPersistenceData();
     nlohmann::json root;
     BGTASK_LOGI("RestoreAuthRecord start");
-    if (ParseJsonValueFromFile(root, AUTH_RECORD_FILE_PATH) != ERR_OK) {
+    if (ParseSnapshotFromFile(root, AUTH_RECORD_FILE_PATH) != ERR_OK) {
         BGTASK_LOGE("bannerNotification parse json value from file fail.");
         return ERR_BGTASK_DATA_STORAGE_ERR;
     }
@@ -135,71 +530,43 @@ ErrCode DataStorageHelper::RestoreAuthRecord(std::unordered_map<std::string,
 ErrCode DataStorageHelper::RefreshResourceRecord(const ResourceRecordMap &appRecord,
     const ResourceRecordMap &processRecord)
 {
-    std::string record {""};
-    ConvertMapToString(appRecord, processRecord, record);
-    if (access(RESOURCE_RECORD_FILE_PATH.c_str(), F_OK) == ERR_OK) {
-        BGTASK_LOGD("the file: %{private}s already exists.", RESOURCE_RECORD_FILE_PATH.c_str());
-    } else {
-        FILE *file = fopen(RESOURCE_RECORD_FILE_PATH.c_str(), "w+");
-        if (file == nullptr) {
-            BGTASK_LOGE("Fail to open file: %{private}s, errno: %{public}s",
-                RESOURCE_RECORD_FILE_PATH.c_str(), strerror(errno));
-            return ERR_BGTASK_CREATE_FILE_ERR;
-        }
-        int closeResult = fclose(file);
-        if (closeResult < 0) {
-            BGTASK_LOGE("Fail to close file: %{private}s, errno: %{public}s",
-                RESOURCE_RECORD_FILE_PATH.c_str(), strerror(errno));
-            return ERR_BGTASK_CREATE_FILE_ERR;
-        }
-    }
-    return SaveJsonValueToFile(record, RESOURCE_RECORD_FILE_PATH);
+    nlohmann::json root;
+    ConvertMapsToJson(appRecord, processRecord, root);
+    MarkSnapshotDirty(RESOURCE_RECORD_FILE_PATH, std::move(root));
+    return ERR_OK;
 }
 
 ErrCode DataStorageHelper::RefreshAuthRecord(
     const std::unordered_map<std::string, std::shared_ptr<BannerNotificationRecord>> &authRecord)
 {
-    nlohmann::json root;
+    nlohmann::json root = nlohmann::json::object();
     for (const auto &iter : authRecord) {
-        auto record = iter.second;
-        std::string data = record->ParseToJsonStr();
-        nlohmann::json recordJson = nlohmann::json::parse(data, nullptr, false);;
-        if (!recordJson.is_discarded()) {
-            root[iter.first] = recordJson;
+        if (iter.second != nullptr) {
+            iter.second->ParseToJson(root[iter.first]);
         }
     }
-    if (access(AUTH_RECORD_FILE_PATH, F_OK) == ERR_OK) {
-        BGTASK_LOGD("the file: %{private}s already exists.", AUTH_RECORD_FILE_PATH);
-    } else {
-        FILE *file = fopen(AUTH_RECORD_FILE_PATH, "w+");
-        if (file == nullptr) {
-            BGTASK_LOGE("Fail to open file: %{private}s, errno: %{public}s", AUTH_RECORD_FILE_PATH, strerror(errno));
-            return ERR_BGTASK_CREATE_FILE_ERR;
-        }
-        int closeResult = fclose(file);
-        if (closeResult < 0) {
-            BGTASK_LOGE("Fail to close file: %{private}s, errno: %{public}s", AUTH_RECORD_FILE_PATH, strerror(errno));
-            return ERR_BGTASK_CREATE_FILE_ERR;
-        }
-    }
-    return SaveJsonValueToFile(root.dump(CommonUtils::jsonFormat_), AUTH_RECORD_FILE_PATH);
+    MarkSnapshotDirty(AUTH_RECORD_FILE_PATH, std::move(root));
+    return ERR_OK;
 }
 
 ErrCode DataStorageHelper::OnBackup(MessageParcel& data, MessageParcel& reply)
 {
+    FlushPersistenceData();
     std::string replyCode = SetReplyCode(EXTENSION_SUCCESS_CODE);
     FILE *file = nullptr;
-    char tmpPath[PATH_MAX] = {0};
-    if (realpath(AUTH_RECORD_FILE_PATH, tmpPath) == nullptr) {
-        BGTASK_LOGE("realpath fail, errno: %{public}s", strerror(errno));
+    // 备份数据使用JSON格式，兼容旧版本设备恢复
+    if (ExportJsonToFile(AUTH_RECORD_FILE_PATH, AUTH_RECORD_BACKUP_FILE_PATH) != ERR_OK) {
         replyCode = SetReplyCode(EXTENSION_ERROR_CODE);
     } else {
-        file = fopen(tmpPath, "r");
+        file = fopen(AUTH_RECORD_BACKUP_FILE_PATH, "r");
     }
     if (file == nullptr) {
-        BGTASK_LOGE("Fail to open file: %{private}s, errno: %{public}s", tmpPath, strerror(errno));
+        BGTASK_LOGE("Fail to open file: %{private}s, errno: %{public}s", AUTH_RECORD_BACKUP_FILE_PATH,
+            strerror(errno));
         replyCode = SetReplyCode(EXTENSION_ERROR_CODE);
     }
+    // 导出文件仅用于传递备份数据，已打开的描述符仍可读取，无需保留在磁盘上
+    unlink(AUTH_RECORD_BACKUP_FILE_PATH);
     UniqueFd fd(-1);
     if (file != nullptr) {
         fd = UniqueFd(fileno(file));
@@ -220,7 +587,8 @@ ErrCode DataStorageHelper::OnBackup(MessageParcel& data, MessageParcel& reply)
         closeResult = fclose(file);
     }
     if (closeResult < 0) {
-        BGTASK_LOGE("Fail to close file: %{private}s, errno: %{public}s", tmpPath, strerror(errno));
+        BGTASK_LOGE("Fail to close file: %{private}s, errno: %{public}s", AUTH_RECORD_BACKUP_FILE_PATH,
+            strerror(errno));
         return ERR_INVALID_OPERATION;
     }
     BGTASK_LOGI("OnBackup success!");
@@ -230,6 +598,8 @@ ErrCode DataStorageHelper::OnBackup(MessageParcel& data, MessageParcel& reply)
 ErrCode DataStorageHelper::OnRestore(MessageParcel& data, MessageParcel& reply,
     std::unordered_map<std::string, std::shared_ptr<BannerNotificationRecord>>& allRecord)
 {
+    // 恢复数据直接覆盖文件，需先写入待落盘数据，避免恢复后被旧数据覆盖
+    FlushPersistenceData();
     std::string replyCode = SetReplyCode(EXTENSION_SUCCESS_CODE);
     UniqueFd srcFd(data.ReadFileDescriptor());
     bool getAuthRet = GetAuthRecord(srcFd);
@@ -310,8 +680,9 @@ std::string DataStorageHelper::SetReplyCode(int32_t replyCode)
 ErrCode DataStorageHelper::RestoreResourceRecord(ResourceRecordMap &appRecord,
     ResourceRecordMap &processRecord)
 {
+    FlushPersistenceData();
     nlohmann::json root;
-    if (ParseJsonValueFromFile(root, RESOURCE_RECORD_FILE_PATH) != ERR_OK) {
+    if (ParseSnapshotFromFile(root, RESOURCE_RECORD_FILE_PATH) != ERR_OK) {
         BGTASK_LOGD("can not read string form file: %{private}s", RESOURCE_RECORD_FILE_PATH.c_str());
         return ERR_BGTASK_DATA_STORAGE_ERR;
     }
@@ -319,27 +690,6 @@ ErrCode DataStorageHelper::RestoreResourceRecord(ResourceRecordMap &appRecord,
     return ERR_OK;
 }
 
-int32_t DataStorageHelper::SaveJsonValueToFile(const std::string &value, const std::string &filePath)
-{
-    std::ofstream fout;
-    std::string realPath;
-    if (!ConvertFullPath(filePath, realPath)) {
-        BGTASK_LOGE("SaveJsonValueToFile Get real file path: %{private}s failed", filePath.c_str());
-        return ERR_BGTASK_GET_ACTUAL_FILE_ERR;
-    }
-    fout.open(realPath, std::ios::out);
-    if (!fout.is_open()) {
-        BGTASK_LOGE("Open file: %{private}s failed.", filePath.c_str());
-        return ERR_BGTASK_OPEN_FILE_ERR;
-    }
-    fout << value.c_str() << std::endl;
-    fout.close();
-    if (filePath == TASK_RECORD_FILE_PATH) {
-        ReportUserDataSizeEvent();
-    }
-    return ERR_OK;
-}
-
 bool DataStorageHelper::ParseFastSuspendDozeTime(const std::string &FilePath, int &time)
 {
     nlohmann::json jsonObj;
@@ -420,17 +770,15 @@ bool DataStorageHelper::ConvertFullPath(const std::string& partialPath, std::str
     return true;
 }
 
-void DataStorageHelper::ConvertMapToString(const ResourceRecordMap &appRecord,
-    const ResourceRecordMap &processRecord, std::string &recordString)
+void DataStorageHelper::ConvertMapsToJson(const ResourceRecordMap &appRecord,
+    const ResourceRecordMap &processRecord, nlohmann::json &root)
 {
-    nlohmann::json root;
     nlohmann::json appValue;
     ConvertMapToJson(appRecord, appValue);
     root[APP_RESOURCE_RECORD] = appValue;
     nlohmann::json processValue;
     ConvertMapToJson(processRecord, processValue);
     root[PROCESS_RESOURCE_RECORD] = processValue;
-    recordString = root.dump(CommonUtils::jsonFormat_);
 }
 
 void DataStorageHelper::ConvertMapToJson(const ResourceRecordMap &appRecord, nlohmann::json &root)
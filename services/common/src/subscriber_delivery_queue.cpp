@@ -0,0 +1,404 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "subscriber_delivery_queue.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <sstream>
+
+#include "bgtaskmgr_log_wrapper.h"
+#include "event_runner.h"
+#include "time_provider.h"
+
+namespace OHOS {
+namespace BackgroundTaskMgr {
+namespace {
+static constexpr char DELIVERY_RUNNER_NAME[] = "bgtask_delivery_";
+static constexpr char DELIVERY_MONITOR_NAME[] = "bgtask_delivery_monitor";
+static constexpr char DELIVERY_DRAIN_TASK[] = "delivery_drain_";
+// 普通订阅者共享的工作线程数
+static constexpr uint32_t DELIVERY_WORKER_NUM = 2;
+// 被降级的慢订阅者各自独占一个线程，独占线程数有上限，超过上限的卡死订阅者被摘除
+static constexpr uint32_t MAX_DEDICATED_WORKER_NUM = 4;
+// 超过该长度后仅合并同键状态更新
+static constexpr size_t MAX_QUEUE_SIZE = 128;
+static constexpr size_t MAX_DEMOTED_QUEUE_SIZE = 32;
+// 硬上限为软上限的倍数，超过后丢弃积压并摘除订阅者
+static constexpr size_t HARD_QUEUE_SIZE_FACTOR = 8;
+static constexpr size_t MAX_DELIVERY_BATCH = 8;
+// 单次回调时延预算，单位毫秒
+static constexpr int64_t DELIVERY_LATENCY_BUDGET = 50;
+static constexpr uint32_t MIN_RECOVER_TIMES = 16;
+}
+
+SubscriberDeliveryQueue::SubscriberDeliveryQueue() {}
+
+SubscriberDeliveryQueue::~SubscriberDeliveryQueue() {}
+
+void SubscriberDeliveryQueue::Deliver(DeliveryModule module, const sptr<IBackgroundTaskSubscriber> &subscriber,
+    const DeliveryTask &task, const std::string &coalesceKey)
+{
+    if (subscriber == nullptr || !task) {
+        return;
+    }
+    sptr<IRemoteObject> remote = subscriber->AsObject();
+    if (remote == nullptr || !remote->IsProxyObject()) {
+        // 同进程订阅者没有跨进程开销，直接回调
+        task(subscriber);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    auto &queue = queues_[std::make_pair(module, remote.GetRefPtr())];
+    if (queue == nullptr) {
+        queue = std::make_shared<SubscriberQueue>();
+        queue->subscriber_ = subscriber;
+        queue->id_ = nextQueueId_++;
+        queue->workerIndex_ = nextWorkerIndex_++ % DELIVERY_WORKER_NUM;
+    }
+    if (queue->detached_) {
+        // 已摘除的订阅者不再投递，直到取消订阅或死亡后重新订阅
+        totalDropped_++;
+        return;
+    }
+    size_t maxQueueSize = queue->demoted_ ? MAX_DEMOTED_QUEUE_SIZE : MAX_QUEUE_SIZE;
+    if (queue->tasks_.size() >= maxQueueSize) {
+        // 队列超过软上限时只合并同键的状态更新，生命周期回调照常入队，避免订阅者状态永久不一致
+        queue->overflowCount_++;
+        if (queue->overflowCount_ == 1) {
+            BGTASK_LOGW("subscriber delivery queue overflow, module: %{public}u, demoted: %{public}d",
+                static_cast<uint32_t>(module), queue->demoted_);
+        }
+        if (!coalesceKey.empty() && CoalesceLocked(queue, coalesceKey, task)) {
+            return;
+        }
+        if (queue->tasks_.size() >= maxQueueSize * HARD_QUEUE_SIZE_FACTOR) {
+            BGTASK_LOGE("subscriber delivery queue exceed hard limit, module: %{public}u, detach it",
+                static_cast<uint32_t>(module));
+            DetachLocked(queue);
+            totalDropped_++;
+            return;
+        }
+    }
+    queue->tasks_.emplace_back(PendingTask {coalesceKey, task});
+    ScheduleDrainLocked(queue);
+}
+
+bool SubscriberDeliveryQueue::CoalesceLocked(const std::shared_ptr<SubscriberQueue> &queue,
+    const std::string &coalesceKey, const DeliveryTask &task)
+{
+    for (auto iter = queue->tasks_.rbegin(); iter != queue->tasks_.rend(); ++iter) {
+        if (iter->coalesceKey_.empty()) {
+            // 不能越过生命周期回调合并，否则会改变回调顺序
+            return false;
+        }
+        if (iter->coalesceKey_ == coalesceKey) {
+            iter->task_ = task;
+            queue->coalescedCount_++;
+            totalCoalesced_++;
+            return true;
+        }
+    }
+    return false;
+}
+
+void SubscriberDeliveryQueue::RemoveSubscriber(DeliveryModule module, const wptr<IRemoteObject> &remote)
+{
+    if (remote == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    auto iter = queues_.find(std::make_pair(module, remote.GetRefPtr()));
+    if (iter == queues_.end()) {
+        return;
+    }
+    auto queue = iter->second;
+    queue->removed_ = true;
+    totalDropped_ += queue->tasks_.size();
+    queue->tasks_.clear();
+    queues_.erase(iter);
+    ReleaseDedicatedWorkerLocked(queue);
+}
+
+void SubscriberDeliveryQueue::DetachLocked(const std::shared_ptr<SubscriberQueue> &queue)
+{
+    if (queue->detached_) {
+        return;
+    }
+    queue->detached_ = true;
+    totalDetached_++;
+    totalDropped_ += queue->tasks_.size();
+    queue->tasks_.clear();
+    ReleaseDedicatedWorkerLocked(queue);
+}
+
+void SubscriberDeliveryQueue::ScheduleDrainLocked(const std::shared_ptr<SubscriberQueue> &queue)
+{
+    if (queue->scheduled_ || queue->removed_ || queue->tasks_.empty()) {
+        return;
+    }
+    auto worker = GetQueueWorkerLocked(queue);
+    if (worker == nullptr) {
+        BGTASK_LOGE("subscriber delivery worker is null");
+        return;
+    }
+    auto task = [queue]() {
+        DelayedSingleton<SubscriberDeliveryQueue>::GetInstance()->DrainQueue(queue);
+    };
+    if (worker->PostTask(task, DELIVERY_DRAIN_TASK + std::to_string(queue->id_))) {
+        queue->scheduled_ = true;
+    }
+}
+
+void SubscriberDeliveryQueue::DrainQueue(const std::shared_ptr<SubscriberQueue> &queue)
+{
+    std::vector<PendingTask> batch;
+    sptr<IBackgroundTaskSubscriber> subscriber;
+    std::shared_ptr<AppExecFwk::EventHandler> worker;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        while (!queue->tasks_.empty() && batch.size() < MAX_DELIVERY_BATCH) {
+            batch.emplace_back(std::move(queue->tasks_.front()));
+            queue->tasks_.pop_front();
+        }
+        subscriber = queue->subscriber_;
+        worker = GetQueueWorkerLocked(queue);
+    }
+    size_t deliveredNum = 0;
+    for (; deliveredNum < batch.size(); deliveredNum++) {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex_);
+            // 降级或恢复后换了线程，剩余回调回到队首由新线程投递
+            if (queue->removed_ || queue->detached_ || GetQueueWorkerLocked(queue) != worker) {
+                break;
+            }
+            BeginCallLocked(queue);
+        }
+        int64_t beginTime = TimeProvider::GetCurrentTime(ClockType::CLOCK_TYPE_MONOTONIC);
+        batch[deliveredNum].task_(subscriber);
+        int64_t endTime = TimeProvider::GetCurrentTime(ClockType::CLOCK_TYPE_MONOTONIC);
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        EndCallLocked(queue, endTime - beginTime);
+    }
+
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    queue->scheduled_ = false;
+    if (deliveredNum > 0) {
+        queue->deliveredCount_ += deliveredNum;
+        queue->batchCount_++;
+        totalDelivered_ += deliveredNum;
+    }
+    if (queue->removed_ || queue->detached_) {
+        totalDropped_ += batch.size() - deliveredNum;
+        return;
+    }
+    for (size_t index = batch.size(); index > deliveredNum; index--) {
+        queue->tasks_.emplace_front(std::move(batch[index - 1]));
+    }
+    ScheduleDrainLocked(queue);
+}
+
+void SubscriberDeliveryQueue::BeginCallLocked(const std::shared_ptr<SubscriberQueue> &queue)
+{
+    queue->inFlight_ = true;
+    uint64_t callSeq = ++queue->callSeq_;
+    auto monitor = GetMonitorLocked();
+    if (monitor == nullptr) {
+        return;
+    }
+    // 回调仍未返回时由看门狗立即降级，不等待回调结束
+    auto task = [queue, callSeq]() {
+        DelayedSingleton<SubscriberDeliveryQueue>::GetInstance()->CheckInFlightCall(queue, callSeq);
+    };
+    monitor->PostTask(task, DELIVERY_LATENCY_BUDGET);
+}
+
+void SubscriberDeliveryQueue::EndCallLocked(const std::shared_ptr<SubscriberQueue> &queue, int64_t latency)
+{
+    queue->inFlight_ = false;
+    queue->maxLatency_ = std::max(queue->maxLatency_, latency);
+    if (queue->removed_ || queue->detached_) {
+        // 卡住期间被摘除的订阅者，回调返回后才能回收其独占线程
+        ReleaseDedicatedWorkerLocked(queue);
+        return;
+    }
+    if (latency > DELIVERY_LATENCY_BUDGET) {
+        queue->fastTimes_ = 0;
+        if (!queue->demoted_) {
+            BGTASK_LOGW("subscriber delivery cost %{public}" PRId64 "ms, demote it", latency);
+            DemoteLocked(queue);
+        }
+        return;
+    }
+    queue->fastTimes_++;
+    if (queue->demoted_ && queue->fastTimes_ >= MIN_RECOVER_TIMES) {
+        RestoreLocked(queue);
+    }
+}
+
+void SubscriberDeliveryQueue::CheckInFlightCall(const std::shared_ptr<SubscriberQueue> &queue, uint64_t callSeq)
+{
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    if (!queue->inFlight_ || queue->callSeq_ != callSeq || queue->removed_ || queue->detached_ ||
+        queue->demoted_) {
+        return;
+    }
+    BGTASK_LOGW("subscriber delivery exceed %{public}" PRId64 "ms and not return, demote it",
+        DELIVERY_LATENCY_BUDGET);
+    queue->fastTimes_ = 0;
+    DemoteLocked(queue);
+}
+
+void SubscriberDeliveryQueue::DemoteLocked(const std::shared_ptr<SubscriberQueue> &queue)
+{
+    std::shared_ptr<AppExecFwk::EventHandler> spareWorker = nullptr;
+    if (dedicatedWorkerNum_ < MAX_DEDICATED_WORKER_NUM) {
+        spareWorker = AcquireIdleWorkerLocked();
+    }
+    if (spareWorker == nullptr) {
+        if (queue->inFlight_) {
+            // 没有可用的独占线程，卡死的订阅者直接摘除，避免积压继续阻塞共享线程
+            BGTASK_LOGE("no dedicated delivery worker left, detach hanging subscriber");
+            DetachLocked(queue);
+        }
+        return;
+    }
+    uint32_t index = queue->workerIndex_;
+    if (!queue->inFlight_ || index >= workers_.size()) {
+        queue->dedicatedWorker_ = spareWorker;
+    } else {
+        // 回调卡在共享线程上，把该线程留给这个订阅者独占，共享位置换成新线程，
+        // 并把已排在该线程上的其他订阅者迁移过去
+        auto blockedWorker = workers_[index];
+        queue->dedicatedWorker_ = blockedWorker;
+        workers_[index] = spareWorker;
+        for (auto &iter : queues_) {
+            const auto &other = iter.second;
+            if (other == queue || other->demoted_ || other->workerIndex_ != index || !other->scheduled_) {
+                continue;
+            }
+            blockedWorker->RemoveTask(DELIVERY_DRAIN_TASK + std::to_string(other->id_));
+            other->scheduled_ = false;
+            ScheduleDrainLocked(other);
+        }
+    }
+    queue->demoted_ = true;
+    dedicatedWorkerNum_++;
+    totalDemoted_++;
+}
+
+void SubscriberDeliveryQueue::RestoreLocked(const std::shared_ptr<SubscriberQueue> &queue)
+{
+    BGTASK_LOGI("subscriber delivery recovered, restore it");
+    ReleaseDedicatedWorkerLocked(queue);
+    queue->workerIndex_ = nextWorkerIndex_++ % DELIVERY_WORKER_NUM;
+}
+
+void SubscriberDeliveryQueue::ReleaseDedicatedWorkerLocked(const std::shared_ptr<SubscriberQueue> &queue)
+{
+    if (!queue->demoted_ || queue->inFlight_) {
+        return;
+    }
+    // 独占线程上可能正在执行本次回调，不能在此析构，放回空闲池复用
+    if (queue->dedicatedWorker_ != nullptr) {
+        idleWorkers_.emplace_back(queue->dedicatedWorker_);
+    }
+    queue->dedicatedWorker_ = nullptr;
+    queue->demoted_ = false;
+    queue->fastTimes_ = 0;
+    dedicatedWorkerNum_--;
+}
+
+std::shared_ptr<AppExecFwk::EventHandler> SubscriberDeliveryQueue::GetQueueWorkerLocked(
+    const std::shared_ptr<SubscriberQueue> &queue)
+{
+    if (queue->demoted_) {
+        return queue->dedicatedWorker_;
+    }
+    return GetWorkerLocked(queue->workerIndex_);
+}
+
+std::shared_ptr<AppExecFwk::EventHandler> SubscriberDeliveryQueue::GetWorkerLocked(uint32_t index)
+{
+    if (workers_.empty()) {
+        workers_.resize(DELIVERY_WORKER_NUM, nullptr);
+    }
+    if (index >= workers_.size()) {
+        return nullptr;
+    }
+    if (workers_[index] == nullptr) {
+        workers_[index] = AcquireIdleWorkerLocked();
+    }
+    return workers_[index];
+}
+
+std::shared_ptr<AppExecFwk::EventHandler> SubscriberDeliveryQueue::AcquireIdleWorkerLocked()
+{
+    if (!idleWorkers_.empty()) {
+        auto worker = idleWorkers_.back();
+        idleWorkers_.pop_back();
+        return worker;
+    }
+    if (createdWorkerNum_ >= DELIVERY_WORKER_NUM + MAX_DEDICATED_WORKER_NUM) {
+        return nullptr;
+    }
+    auto runner = AppExecFwk::EventRunner::Create(DELIVERY_RUNNER_NAME + std::to_string(createdWorkerNum_));
+    if (runner == nullptr) {
+        BGTASK_LOGE("create subscriber delivery runner fail");
+        return nullptr;
+    }
+    createdWorkerNum_++;
+    return std::make_shared<AppExecFwk::EventHandler>(runner);
+}
+
+std::shared_ptr<AppExecFwk::EventHandler> SubscriberDeliveryQueue::GetMonitorLocked()
+{
+    if (monitor_ == nullptr) {
+        auto runner = AppExecFwk::EventRunner::Create(DELIVERY_MONITOR_NAME);
+        if (runner == nullptr) {
+            BGTASK_LOGE("create subscriber delivery monitor fail");
+            return nullptr;
+        }
+        monitor_ = std::make_shared<AppExecFwk::EventHandler>(runner);
+    }
+    return monitor_;
+}
+
+void SubscriberDeliveryQueue::ShellDump(std::vector<std::string> &dumpInfo)
+{
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    std::stringstream stream;
+    stream << "subscriber delivery, queues: " << queues_.size() << ", delivered: " << totalDelivered_
+        << ", dropped: " << totalDropped_ << ", coalesced: " << totalCoalesced_ << ", demoted: " << totalDemoted_
+        << ", detached: " << totalDetached_ << ", dedicated workers: " << dedicatedWorkerNum_ << "\n";
+    uint32_t index = 1;
+    for (const auto &iter : queues_) {
+        const auto &queue = iter.second;
+        stream << "No." << index++;
+        stream << "\tmodule: " << static_cast<uint32_t>(iter.first.first) << "\n";
+        stream << "\tworker: " << queue->workerIndex_ << "\n";
+        stream << "\tdemoted: " << (queue->demoted_ ? "true" : "false") << "\n";
+        stream << "\tdetached: " << (queue->detached_ ? "true" : "false") << "\n";
+        stream << "\tpending: " << queue->tasks_.size() << "\n";
+        stream << "\tdelivered: " << queue->deliveredCount_ << "\n";
+        stream << "\tbatches: " << queue->batchCount_ << "\n";
+        stream << "\toverflow: " << queue->overflowCount_ << "\n";
+        stream << "\tcoalesced: " << queue->coalescedCount_ << "\n";
+        stream << "\tmaxLatency: " << queue->maxLatency_ << "ms\n";
+    }
+    dumpInfo.emplace_back(stream.str());
+}
+}  // namespace BackgroundTaskMgr
+}  // namespace OHOS
@@ -20,6 +20,7 @@
 #include "common_utils.h"
 #include "bg_continuous_task_mgr.h"
 #include "bgtaskmgr_inner_errors.h"
+#include "bundle_name_cache.h"
 #include "continuous_task_log.h"
 #include "bg_efficiency_resources_mgr.h"
 
@@ -64,6 +65,7 @@ void SystemEventObserver::SetBgContinuousTaskMgr(const std::shared_ptr<BgContinu
 
 void SystemEventObserver::OnReceiveEvent(const EventFwk::CommonEventData &eventData)
 {
+    InvalidateBundleNameCache(eventData);
     OnReceiveEventContinuousTask(eventData);
     OnReceiveEventEfficiencyRes(eventData);
 }
@@ -111,6 +113,25 @@ void SystemEventObserver::OnReceiveEventContinuousTask(const EventFwk::CommonEve
     handler->PostTask(task, TASK_ON_BUNDLEINFO_CHANGED);
 }
 
+void SystemEventObserver::InvalidateBundleNameCache(const EventFwk::CommonEventData &eventData)
+{
+    AAFwk::Want want = eventData.GetWant();
+    std::string action = want.GetAction();
+    if (action != EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_ADDED
+        && action != EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_REMOVED
+        && action != EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_FULLY_REMOVED
+        && action != EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_CHANGED
+        && action != EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_REPLACED) {
+        return;
+    }
+    int32_t uid = want.GetIntParam(AppExecFwk::Constants::UID, -1);
+    if (uid < 0) {
+        DelayedSingleton<BundleNameCache>::GetInstance()->Clear();
+        return;
+    }
+    DelayedSingleton<BundleNameCache>::GetInstance()->Invalidate(uid);
+}
+
 void SystemEventObserver::OnReceiveEventEfficiencyRes(const EventFwk::CommonEventData &eventData)
 {
     AAFwk::Want want = eventData.GetWant();
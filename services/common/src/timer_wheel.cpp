@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "timer_wheel.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "bgtaskmgr_log_wrapper.h"
+#include "event_runner.h"
+#include "time_provider.h"
+
+namespace OHOS {
+namespace BackgroundTaskMgr {
+namespace {
+static constexpr char TIMER_WHEEL_RUNNER_NAME[] = "bgtask_timer_wheel";
+// 时间轮刻度，单位毫秒，同一刻度内到期的定时器合并处理
+static constexpr int64_t TICK_TIME = 100;
+static constexpr uint32_t MODULE_SHIFT = 32;
+
+// 返回从 pos 之后第一个非空槽位的距离，取值 1 ~ 64
+uint32_t GetNextOccupiedDistance(uint64_t bits, uint32_t pos)
+{
+    uint32_t shift = (pos + 1) & 63;
+    uint64_t rotated = shift == 0 ? bits : ((bits >> shift) | (bits << (64 - shift)));
+    return static_cast<uint32_t>(__builtin_ctzll(rotated)) + 1;
+}
+}
+
+TimerWheel::TimerWheel() {}
+
+TimerWheel::~TimerWheel() {}
+
+uint64_t TimerWheel::MakeKey(TimerWheelModule module, int32_t id)
+{
+    return (static_cast<uint64_t>(module) << MODULE_SHIFT) | static_cast<uint32_t>(id);
+}
+
+uint64_t TimerWheel::GetNowTick()
+{
+    int64_t now = TimeProvider::GetCurrentTime(ClockType::CLOCK_TYPE_MONOTONIC);
+    return static_cast<uint64_t>(std::max(now, static_cast<int64_t>(0)) / TICK_TIME);
+}
+
+bool TimerWheel::AddTimer(TimerWheelModule module, int32_t id, int64_t delayTime, const TimerCallback &callback,
+    const std::shared_ptr<AppExecFwk::EventHandler> &handler)
+{
+    if (!callback) {
+        return false;
+    }
+    int64_t now = TimeProvider::GetCurrentTime(ClockType::CLOCK_TYPE_MONOTONIC);
+    int64_t expireTime = std::max(now, static_cast<int64_t>(0)) + std::max(delayTime, static_cast<int64_t>(0));
+    {
+        std::lock_guard<std::mutex> lock(wheelMutex_);
+        uint64_t key = MakeKey(module, id);
+        auto iter = timers_.find(key);
+        if (iter != timers_.end()) {
+            EraseLocked(iter->second);
+            timers_.erase(iter);
+            rescheduleCount_++;
+        } else if (dispatched_.erase(key) > 0) {
+            rescheduleCount_++;
+        }
+        if (timers_.empty()) {
+            currentTick_ = std::max(currentTick_, GetNowTick());
+        }
+        TimerNode node;
+        node.key_ = key;
+        node.seq_ = ++nextSeq_;
+        // 向上取整，保证定时器不会早于期望时间到期
+        node.expireTick_ = std::max(static_cast<uint64_t>((expireTime + TICK_TIME - 1) / TICK_TIME),
+            currentTick_ + 1);
+        node.callback_ = callback;
+        node.handler_ = handler;
+        node.hasHandler_ = handler != nullptr;
+        InsertLocked(std::move(node));
+    }
+    ScheduleWakeup();
+    return true;
+}
+
+void TimerWheel::RemoveTimer(TimerWheelModule module, int32_t id)
+{
+    std::lock_guard<std::mutex> lock(wheelMutex_);
+    uint64_t key = MakeKey(module, id);
+    auto iter = timers_.find(key);
+    if (iter == timers_.end()) {
+        // 已到期但回调还未执行时同样取消
+        if (dispatched_.erase(key) > 0) {
+            cancelCount_++;
+        }
+        return;
+    }
+    EraseLocked(iter->second);
+    timers_.erase(iter);
+    cancelCount_++;
+}
+
+bool TimerWheel::HasTimer(TimerWheelModule module, int32_t id)
+{
+    std::lock_guard<std::mutex> lock(wheelMutex_);
+    return timers_.find(MakeKey(module, id)) != timers_.end();
+}
+
+void TimerWheel::InsertLocked(TimerNode &&node)
+{
+    uint64_t expireTick = std::max(node.expireTick_, currentTick_);
+    uint64_t delta = expireTick - currentTick_;
+    uint32_t level = 0;
+    while (level < WHEEL_LEVELS - 1 && delta >= (1ULL << (WHEEL_BITS * (level + 1)))) {
+        level++;
+    }
+    uint32_t slot = 0;
+    if (delta >= (1ULL << (WHEEL_BITS * WHEEL_LEVELS))) {
+        // 超出时间轮范围的定时器放在最高层最远的槽位，转动到该槽位时重新插入
+        slot = static_cast<uint32_t>((currentTick_ >> (WHEEL_BITS * level)) + WHEEL_SLOTS - 1) & (WHEEL_SLOTS - 1);
+    } else {
+        slot = static_cast<uint32_t>(expireTick >> (WHEEL_BITS * level)) & (WHEEL_SLOTS - 1);
+    }
+    uint64_t key = node.key_;
+    auto &timerSlot = wheel_[level][slot];
+    timerSlot.emplace_back(std::move(node));
+    occupied_[level] |= 1ULL << slot;
+    timers_[key] = TimerLocation {level, slot, std::prev(timerSlot.end())};
+}
+
+void TimerWheel::EraseLocked(const TimerLocation &location)
+{
+    auto &timerSlot = wheel_[location.level_][location.slot_];
+    timerSlot.erase(location.iter_);
+    if (timerSlot.empty()) {
+        occupied_[location.level_] &= ~(1ULL << location.slot_);
+    }
+}
+
+void TimerWheel::AdvanceLocked(uint64_t targetTick, std::vector<TimerNode> &expired)
+{
+    while (currentTick_ < targetTick) {
+        if (timers_.empty()) {
+            currentTick_ = targetTick;
+            break;
+        }
+        // 跳过既没有定时器到期、也不需要降级的空闲刻度
+        uint64_t nextTick = targetTick;
+        if (occupied_[0] != 0) {
+            uint32_t pos = static_cast<uint32_t>(currentTick_) & (WHEEL_SLOTS - 1);
+            nextTick = std::min(nextTick, currentTick_ + GetNextOccupiedDistance(occupied_[0], pos));
+        }
+        for (uint32_t level = 1; level < WHEEL_LEVELS; ++level) {
+            if (occupied_[level] != 0) {
+                uint32_t shift = WHEEL_BITS * level;
+                nextTick = std::min(nextTick, ((currentTick_ >> shift) + 1) << shift);
+                break;
+            }
+        }
+        currentTick_ = nextTick - 1;
+        StepLocked(expired);
+    }
+}
+
+void TimerWheel::StepLocked(std::vector<TimerNode> &expired)
+{
+    currentTick_++;
+    for (uint32_t level = 1; level < WHEEL_LEVELS; ++level) {
+        uint32_t shift = WHEEL_BITS * level;
+        if ((currentTick_ & ((1ULL << shift) - 1)) != 0) {
+            break;
+        }
+        CascadeLocked(level, static_cast<uint32_t>(currentTick_ >> shift) & (WHEEL_SLOTS - 1));
+    }
+    uint32_t slot = static_cast<uint32_t>(currentTick_) & (WHEEL_SLOTS - 1);
+    auto &timerSlot = wheel_[0][slot];
+    if (timerSlot.empty()) {
+        return;
+    }
+    coalescedCount_ += timerSlot.size() - 1;
+    for (auto &node : timerSlot) {
+        timers_.erase(node.key_);
+        dispatched_[node.key_] = node.seq_;
+        expired.emplace_back(std::move(node));
+    }
+    timerSlot.clear();
+    occupied_[0] &= ~(1ULL << slot);
+}
+
+void TimerWheel::CascadeLocked(uint32_t level, uint32_t slot)
+{
+    TimerSlot nodes;
+    nodes.swap(wheel_[level][slot]);
+    occupied_[level] &= ~(1ULL << slot);
+    for (auto &node : nodes) {
+        InsertLocked(std::move(node));
+    }
+}
+
+bool TimerWheel::GetNextExpireTickLocked(uint64_t &nextTick)
+{
+    if (timers_.empty()) {
+        return false;
+    }
+    bool found = false;
+    if (occupied_[0] != 0) {
+        uint32_t pos = static_cast<uint32_t>(currentTick_) & (WHEEL_SLOTS - 1);
+        nextTick = currentTick_ + GetNextOccupiedDistance(occupied_[0], pos);
+        found = true;
+    }
+    // 高层只需检查最近的非空槽位，唤醒时间取真实到期时间而非槽位边界，降级在唤醒时一并完成
+    for (uint32_t level = 1; level < WHEEL_LEVELS; ++level) {
+        if (occupied_[level] == 0) {
+            continue;
+        }
+        uint32_t pos = static_cast<uint32_t>(currentTick_ >> (WHEEL_BITS * level)) & (WHEEL_SLOTS - 1);
+        uint32_t slot = (pos + GetNextOccupiedDistance(occupied_[level], pos)) & (WHEEL_SLOTS - 1);
+        for (const auto &node : wheel_[level][slot]) {
+            if (!found || node.expireTick_ < nextTick) {
+                nextTick = node.expireTick_;
+                found = true;
+            }
+        }
+    }
+    return found;
+}
+
+void TimerWheel::ScheduleWakeup()
+{
+    std::shared_ptr<AppExecFwk::EventHandler> handler {nullptr};
+    uint64_t nextTick = 0;
+    {
+        std::lock_guard<std::mutex> lock(wheelMutex_);
+        if (!GetNextExpireTickLocked(nextTick)) {
+            return;
+        }
+        // 已有不晚于该刻度的唤醒，无需重复投递
+        if (!pendingWakeups_.empty() && *pendingWakeups_.begin() <= nextTick) {
+            return;
+        }
+        handler = GetHandlerLocked();
+        if (handler == nullptr) {
+            return;
+        }
+        pendingWakeups_.insert(nextTick);
+    }
+    int64_t now = TimeProvider::GetCurrentTime(ClockType::CLOCK_TYPE_MONOTONIC);
+    int64_t delayTime = std::max(static_cast<int64_t>(nextTick) * TICK_TIME - now, static_cast<int64_t>(0));
+    auto task = [nextTick]() {
+        DelayedSingleton<TimerWheel>::GetInstance()->OnTick(nextTick);
+    };
+    handler->PostTask(task, delayTime);
+}
+
+void TimerWheel::OnTick(uint64_t tick)
+{
+    std::vector<TimerNode> expired;
+    {
+        std::lock_guard<std::mutex> lock(wheelMutex_);
+        pendingWakeups_.erase(tick);
+        if (inTick_) {
+            return;
+        }
+        inTick_ = true;
+        wakeupCount_++;
+        AdvanceLocked(std::max(currentTick_, GetNowTick()), expired);
+        expiredCount_ += expired.size();
+    }
+    Dispatch(expired);
+    ScheduleWakeup();
+    std::lock_guard<std::mutex> lock(wheelMutex_);
+    inTick_ = false;
+}
+
+void TimerWheel::Dispatch(std::vector<TimerNode> &expired)
+{
+    for (auto &node : expired) {
+        uint64_t key = node.key_;
+        uint64_t seq = node.seq_;
+        if (!node.hasHandler_) {
+            if (ConsumeDispatched(key, seq)) {
+                node.callback_();
+            }
+            continue;
+        }
+        auto handler = node.handler_.lock();
+        if (handler == nullptr) {
+            ConsumeDispatched(key, seq);
+            continue;
+        }
+        // 回调在目标线程执行前可能已被取消或重新设置，执行时再次确认
+        auto callback = std::move(node.callback_);
+        auto task = [key, seq, callback]() {
+            if (DelayedSingleton<TimerWheel>::GetInstance()->ConsumeDispatched(key, seq)) {
+                callback();
+            }
+        };
+        if (!handler->PostTask(task)) {
+            ConsumeDispatched(key, seq);
+        }
+    }
+}
+
+bool TimerWheel::ConsumeDispatched(uint64_t key, uint64_t seq)
+{
+    std::lock_guard<std::mutex> lock(wheelMutex_);
+    auto iter = dispatched_.find(key);
+    if (iter == dispatched_.end() || iter->second != seq) {
+        return false;
+    }
+    dispatched_.erase(iter);
+    return true;
+}
+
+std::shared_ptr<AppExecFwk::EventHandler> TimerWheel::GetHandlerLocked()
+{
+    if (handler_ == nullptr) {
+        auto runner = AppExecFwk::EventRunner::Create(TIMER_WHEEL_RUNNER_NAME);
+        if (runner == nullptr) {
+            BGTASK_LOGE("create timer wheel runner fail");
+            return nullptr;
+        }
+        handler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
+    }
+    return handler_;
+}
+
+void TimerWheel::ShellDump(std::vector<std::string> &dumpInfo)
+{
+    std::lock_guard<std::mutex> lock(wheelMutex_);
+    std::stringstream stream;
+    stream << "timer wheel, timers: " << timers_.size() << ", wakeups: " << wakeupCount_
+        << ", expired: " << expiredCount_ << ", coalesced: " << coalescedCount_
+        << ", rescheduled: " << rescheduleCount_ << ", canceled: " << cancelCount_
+        << ", pending wakeups: " << pendingWakeups_.size() << ", dispatched: " << dispatched_.size() << "\n";
+    for (uint32_t level = 0; level < WHEEL_LEVELS; ++level) {
+        size_t count = 0;
+        for (const auto &timerSlot : wheel_[level]) {
+            count += timerSlot.size();
+        }
+        stream << "\tlevel" << level << ": " << count << "\n";
+    }
+    dumpInfo.emplace_back(stream.str());
+}
+}  // namespace BackgroundTaskMgr
+}  // namespace OHOS
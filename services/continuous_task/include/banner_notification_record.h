@@ -43,6 +43,7 @@ public:
     void SetAuthResult(int32_t authResult);
     void SetUserId(int32_t userId);
     void SetAppIndex(int32_t appIndex);
+    void ParseToJson(nlohmann::json &root);
     std::string ParseToJsonStr();
     bool ParseFromJson(const nlohmann::json &value);
 
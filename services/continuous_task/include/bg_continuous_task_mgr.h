@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_CONTINUOUS_TASK_INCLUDE_BG_CONTINUOUS_TASK_MGR_H
 #define FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_CONTINUOUS_TASK_INCLUDE_BG_CONTINUOUS_TASK_MGR_H
 
+#include <functional>
 #include <memory>
 #include <mutex>
 
@@ -31,10 +32,14 @@
 #include "task_notification_subscriber.h"
 #endif
 #include "continuous_task_info.h"
+#include "continuous_task_operation.h"
 #include "background_task_mode.h"
 #include "background_common.h"
 #include "continuous_task_param.h"
 #include "continuous_task_record.h"
+#include "continuous_task_registry.h"
+#include "continuous_task_snapshot.h"
+#include "task_subscriber_registry.h"
 #include "continuous_task_request.h"
 #include "background_task_submode.h"
 #include "ibackground_task_subscriber.h"
@@ -47,6 +52,7 @@
 #include "dialog_event_observer.h"
 #include "banner_notification_event_observer.h"
 #include "data_transfer_progress.h"
+#include "progress_coalescer.h"
 
 namespace OHOS {
 namespace BackgroundTaskMgr {
@@ -78,16 +84,6 @@ struct CachedBundleInfo {
     std::string appName_ {""};
 };
 
-struct SubscriberInfo {
-    SubscriberInfo(sptr<IBackgroundTaskSubscriber> subscriber, int uid, int pid, bool isHap, uint32_t flag)
-        : subscriber_(subscriber), uid_(uid), pid_(pid), isHap_(isHap), flag_(flag) {};
-    sptr<IBackgroundTaskSubscriber> subscriber_;
-    int uid_;
-    int pid_;
-    bool isHap_ {false};
-    uint32_t flag_ {0};
-};
-
 struct InnerApiReqBgRunningConfig {
     bool needNotification_;
     uint32_t bgModeId_;
@@ -108,6 +104,8 @@ public:
     ErrCode RequestBackgroundRunningForInner(const sptr<ContinuousTaskParamForInner> &taskParam);
     ErrCode RequestGetContinuousTasksByUidForInner(int32_t uid,
         std::vector<std::shared_ptr<ContinuousTaskInfo>> &list);
+    ErrCode RequestGetContinuousTasksByUidsForInner(const std::vector<int32_t> &uids,
+        std::vector<std::shared_ptr<ContinuousTaskInfo>> &list);
     ErrCode UpdateDataTransferProgress(const sptr<DataTransferProgress> &progressInfo);
     ErrCode AddSubscriber(const std::shared_ptr<SubscriberInfo> subscriberInfo);
     ErrCode RemoveSubscriber(const sptr<IBackgroundTaskSubscriber> &subscriber, uint32_t flag = 0);
@@ -149,6 +147,11 @@ public:
         int32_t uid, int32_t pid, int32_t reason, const std::string &key, bool isStandby = false);
     void SuspendContinuousAudioTask(int32_t uid);
     void ActiveContinuousTask(int32_t uid, int32_t pid, const std::string &key, bool isStandby = false);
+    ErrCode StopContinuousTasks(const std::vector<ContinuousTaskOperation> &operations, std::vector<int32_t> &results);
+    ErrCode SuspendContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+        std::vector<int32_t> &results);
+    ErrCode ActiveContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+        std::vector<int32_t> &results);
     void OnRemoveSystemAbility(int32_t systemAbilityId, const std::string& deviceId);
     void HandleRemoveTaskByMode(uint32_t mode);
     void OnBannerNotificationActionButtonClick(const int32_t buttonType, const int32_t uid,
@@ -170,6 +173,24 @@ public:
     ErrCode NotifyAudioStart(const int32_t uid);
     std::shared_ptr<AppExecFwk::EventHandler> GetHandler() const;
 private:
+    // 批量修改作用域，作用域内延后落盘与 SA 通知，最外层作用域结束时合并执行一次，仅在服务线程使用
+    class BatchOperationScope {
+    public:
+        explicit BatchOperationScope(BgContinuousTaskMgr &mgr) : mgr_(mgr)
+        {
+            mgr_.BeginBatchOperation();
+        }
+        ~BatchOperationScope()
+        {
+            mgr_.EndBatchOperation();
+        }
+        BatchOperationScope(const BatchOperationScope &) = delete;
+        BatchOperationScope &operator=(const BatchOperationScope &) = delete;
+
+    private:
+        BgContinuousTaskMgr &mgr_;
+    };
+
     ErrCode StartBackgroundRunningInner(std::shared_ptr<ContinuousTaskRecord> &continuousTaskRecordPtr);
     ErrCode UpdateBackgroundRunningInner(const std::string &taskInfoMapKey,
         const sptr<ContinuousTaskParam> &taskParam);
@@ -185,6 +206,7 @@ private:
     ErrCode GetAllContinuousTasksInner(int32_t uid, std::vector<std::shared_ptr<ContinuousTaskInfo>> &list,
         bool includeSuspended = true, bool exemptUid = false);
     ErrCode UpdateDataTransferProgressInner(int32_t uid, const sptr<DataTransferProgress> &progressInfo);
+    void FlushDataTransferProgress(int32_t continuousTaskId);
     ErrCode CheckIsSysReadyAndPermission(int32_t callingUid);
     ErrCode AddSubscriberInner(const std::shared_ptr<SubscriberInfo> subscriberInfo);
     ErrCode RemoveSubscriberInner(const sptr<IBackgroundTaskSubscriber> &subscriber, uint32_t flag = 0);
@@ -192,6 +214,8 @@ private:
     ErrCode SendContinuousTaskNotification(std::shared_ptr<ContinuousTaskRecord> &ContinuousTaskRecordPtr);
     ErrCode GetContinuousTaskAppsInner(std::vector<std::shared_ptr<ContinuousTaskCallbackInfo>> &list, int32_t uid,
         bool includeSuspended = false);
+    std::shared_ptr<const ContinuousTaskSnapshot> GetValidSnapshot();
+    std::shared_ptr<const ContinuousTaskSnapshot> PublishSnapshot();
     ErrCode AVSessionNotifyUpdateNotificationInner(int32_t uid, int32_t pid, bool isPublish = false);
     void RemoveAudioPlaybackDelayTask(int32_t uid);
     ErrCode StopBackgroundRunningByContext(int32_t uid, const std::string &abilityName, int32_t abilityId);
@@ -246,10 +270,13 @@ private:
     ErrCode CheckSpecialNotificationText(std::string &notificationText,
         const std::shared_ptr<ContinuousTaskRecord> continuousTaskRecord, uint32_t mode);
     int32_t RefreshTaskRecord();
+    int32_t RefreshTaskRecord(const std::string &taskInfoMapKey);
     void HandleAppContinuousTaskStop(int32_t uid);
     bool checkPidCondition(const std::vector<AppExecFwk::RunningProcessInfo> &allProcesses, int32_t pid);
     bool checkNotificationCondition(const std::set<std::string> &notificationLabels, const std::string &label);
     std::shared_ptr<Global::Resource::ResourceManager> GetBundleResMgr(const AppExecFwk::BundleInfo &bundleInfo);
+    std::shared_ptr<Global::Resource::ResourceManager> GetBgTaskResMgr();
+    void ResetBgTaskResMgr();
     std::string GetMainAbilityLabel(const std::string &bundleName, int32_t userId);
     std::string GetNotificationText(const std::shared_ptr<ContinuousTaskRecord> record);
     void RemoveContinuousTaskRecordByUidAndMode(int32_t uid, uint32_t mode);
@@ -304,6 +331,17 @@ private:
     ErrCode CancelNotification(const std::shared_ptr<ContinuousTaskRecord> continuousTaskInfo);
     void HandleSuspendContinuousTaskByStandby(int32_t uid, int32_t pid, int32_t mode, const std::string &key);
     void HandleActiveContinuousTaskByStandby(int32_t uid, int32_t pid, const std::string &key);
+    void DispatchSuspendContinuousTask(
+        int32_t uid, int32_t pid, int32_t reason, const std::string &key, bool isStandby);
+    void DispatchActiveContinuousTask(int32_t uid, int32_t pid, const std::string &key, bool isStandby);
+    bool HasOperationTarget(const ContinuousTaskOperation &operation, bool matchByUid);
+    ErrCode HandleBatchOperation(const std::vector<ContinuousTaskOperation> &operations,
+        std::vector<int32_t> &results, const std::function<ErrCode(const ContinuousTaskOperation &)> &handle);
+    void BeginBatchOperation();
+    void EndBatchOperation();
+    void DeliverToSubscriber(const sptr<IBackgroundTaskSubscriber> &subscriber,
+        const std::function<void(const sptr<IBackgroundTaskSubscriber> &)> &task, const std::string &coalesceKey = "");
+    void FlushBatchDeliveries();
     std::string GetAbilityNamePid(const sptr<ContinuousTaskParamForInner> &taskParam, int32_t pid, int32_t callingUid);
 
 #ifdef HAS_OS_ACCOUNT_CAR
@@ -321,12 +359,30 @@ private:
     std::atomic<bool> isSysReady_ {false};
     int32_t bgTaskUid_ {-1};
     std::shared_ptr<AppExecFwk::EventHandler> handler_ {nullptr};
-    std::unordered_map<std::string, std::shared_ptr<ContinuousTaskRecord>> continuousTaskInfosMap_ {};
+    ContinuousTaskRegistry continuousTaskInfosMap_ {};
+    // 查询接口读取的只读快照，仅通过 std::atomic_load/std::atomic_store 访问
+    std::shared_ptr<const ContinuousTaskSnapshot> snapshot_ {nullptr};
+    ProgressCoalescer progressCoalescer_ {};
+    // 批量操作期间延后落盘与 SA 通知，仅在服务线程访问
+    int32_t batchDepth_ {0};
+    bool batchRecordDirty_ {false};
+    std::set<int32_t> batchStoppedUids_ {};
+    // 批量操作期间按订阅者合并的回调，批次结束时每个订阅者只投递一次
+    struct BatchDelivery {
+        sptr<IBackgroundTaskSubscriber> subscriber_ {nullptr};
+        std::vector<std::pair<std::string, std::function<void(const sptr<IBackgroundTaskSubscriber> &)>>> tasks_ {};
+    };
+    bool isCollectingDeliveries_ {false};
+    std::vector<BatchDelivery> batchDeliveries_ {};
     std::unordered_map<int32_t, bool> avSessionNotification_ {};
     std::mutex delayTasksMutex_;
     std::unordered_set<int32_t> delayTasks_;
     std::mutex liveViewInfoMutex_;
     std::unordered_map<int32_t, std::unordered_set<std::string>> liveViewInfo_ {};
+    // 长时任务资源 hap 的 ResourceManager 及多类型通知文本缓存，资源或语言变化时重建
+    std::mutex resMgrMutex_;
+    std::shared_ptr<Global::Resource::ResourceManager> bgTaskResMgr_ {nullptr};
+    std::unordered_map<std::string, std::string> mergeNotificationTextCache_ {};
 
 #ifdef DISTRIBUTED_NOTIFICATION_ENABLE
     std::shared_ptr<TaskNotificationSubscriber> subscriber_ {nullptr};
@@ -334,7 +390,7 @@ private:
     std::shared_ptr<SystemEventObserver> systemEventListener_ {nullptr};
     std::shared_ptr<DialogEventObserver> dialogClickListener_ {nullptr};
     std::shared_ptr<BannerNotificationEventObserver> bannerNotificationClickListener_ {nullptr};
-    std::list<std::shared_ptr<SubscriberInfo>> bgTaskSubscribers_ {};
+    TaskSubscriberRegistry bgTaskSubscribers_ {};
     sptr<RemoteDeathRecipient> susriberDeathRecipient_ {nullptr};
     std::unordered_map<int32_t, CachedBundleInfo> cachedBundleInfos_ {};
     std::unordered_map<int32_t, std::vector<uint32_t>> applyTaskOnForeground_ {};
@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_CONTINUOUS_TASK_INCLUDE_CONTINUOUS_TASK_INFO_H
 #define FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_CONTINUOUS_TASK_INCLUDE_CONTINUOUS_TASK_INFO_H
 
+#include "bg_mode_set.h"
 #include "iremote_object.h"
 #include "nlohmann/json.hpp"
 #include "parcel.h"
@@ -61,6 +62,7 @@ public:
     int32_t GetNotificationId() const;
     int32_t GetContinuousTaskId() const;
     std::shared_ptr<AbilityRuntime::WantAgent::WantAgent> GetWantAgent() const;
+    void ParseToJson(nlohmann::json &root);
     std::string ParseToJsonStr();
     bool ParseFromJson(const nlohmann::json &value);
     std::string ToString(std::vector<uint32_t> &bgmodes);
@@ -72,6 +74,13 @@ public:
     std::shared_ptr<ProgressInfo> GetProgressInfo() const;
     bool NeedNotificationForInnerApi() const;
     bool IsFromComponent() const;
+    void ResetNotificationFingerprint();
+    void SetBgModeIds(const std::vector<uint32_t> &bgModeIds);
+    void AddBgModeId(uint32_t bgModeId);
+    void SetBgSubModeIds(const std::vector<uint32_t> &bgSubModeIds);
+    void AddBgSubModeId(uint32_t bgSubModeId);
+    const BgModeSet &GetBgModeSet() const;
+    const BgModeSet &GetBgSubModeSet() const;
 
 private:
     std::vector<uint32_t> ToVector(std::string &str);
@@ -100,6 +109,9 @@ private:
     bool isBatchApi_ {false};
     std::vector<uint32_t> bgModeIds_ {};
     std::vector<uint32_t> bgSubModeIds_ {};
+    // bgModeIds_/bgSubModeIds_ 的集合缓存，须经 Set/Add 接口修改以保持同步
+    BgModeSet bgModeSet_ {};
+    BgModeSet bgSubModeSet_ {};
     int32_t abilityId_ {-1};
     int32_t reason_ {0};
     int32_t detailedCancelReason_ {0};
@@ -119,9 +131,13 @@ private:
     std::shared_ptr<ProgressInfo> progressInfo_ {nullptr};
     // 标记是否通过组件申请的长时任务
     bool isFromComponent_ {false};
+    // 最近一次发布的通知内容指纹，未发布或通知已取消时为0，不持久化
+    uint64_t notificationFingerprint_ {0};
+    uint64_t subNotificationFingerprint_ {0};
 
     friend class BgContinuousTaskMgr;
     friend class NotificationTools;
+    friend class ContinuousTaskSnapshot;
 };
 }  // namespace BackgroundTaskMgr
 }  // namespace OHOS
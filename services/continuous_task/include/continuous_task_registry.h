@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_CONTINUOUS_TASK_INCLUDE_CONTINUOUS_TASK_REGISTRY_H
+#define FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_CONTINUOUS_TASK_INCLUDE_CONTINUOUS_TASK_REGISTRY_H
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "continuous_task_record.h"
+
+namespace OHOS {
+namespace BackgroundTaskMgr {
+/**
+ * 长时任务记录表，在主键之外维护 uid、abilityId、continuousTaskId 二级索引。
+ * 保持与 unordered_map 一致的接口，通过下标或 GetMutableRecords 写入时，
+ * 索引在下次查询前重建。
+ * 记录增删或被修改时递增版本号，用于判断只读快照是否过期。
+ */
+class ContinuousTaskRegistry {
+public:
+    using RecordMap = std::unordered_map<std::string, std::shared_ptr<ContinuousTaskRecord>>;
+    using iterator = RecordMap::iterator;
+    using const_iterator = RecordMap::const_iterator;
+
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+    bool empty() const;
+    size_t size() const;
+    iterator find(const std::string &key);
+    const_iterator find(const std::string &key) const;
+    const std::shared_ptr<ContinuousTaskRecord> &at(const std::string &key) const;
+    std::shared_ptr<ContinuousTaskRecord> &operator[](const std::string &key);
+    std::pair<iterator, bool> emplace(const std::string &key, const std::shared_ptr<ContinuousTaskRecord> &record);
+    iterator erase(iterator iter);
+    size_t erase(const std::string &key);
+    void clear();
+
+    RecordMap &GetMutableRecords();
+    const RecordMap &GetRecords() const;
+
+    std::vector<std::string> GetKeysByUid(int32_t uid);
+    std::vector<std::string> GetKeysByAbilityId(int32_t abilityId);
+    iterator FindByTaskId(int32_t continuousTaskId);
+    bool HasUid(int32_t uid);
+
+    uint64_t GetVersion() const;
+    void Touch();
+
+private:
+    struct IndexEntry {
+        int32_t uid {-1};
+        int32_t abilityId {-1};
+        int32_t continuousTaskId {-1};
+    };
+
+    void AddIndex(const std::string &key, const std::shared_ptr<ContinuousTaskRecord> &record);
+    void RemoveIndex(const std::string &key);
+    void CheckAndRebuildIndex();
+    static std::vector<std::string> CollectKeys(
+        const std::unordered_map<int32_t, std::unordered_set<std::string>> &index, int32_t id);
+
+private:
+    RecordMap records_ {};
+    std::unordered_map<std::string, IndexEntry> indexedKeys_ {};
+    std::unordered_map<int32_t, std::unordered_set<std::string>> uidIndex_ {};
+    std::unordered_map<int32_t, std::unordered_set<std::string>> abilityIdIndex_ {};
+    std::unordered_map<int32_t, std::string> taskIdIndex_ {};
+    bool indexDirty_ {false};
+    std::atomic<uint64_t> version_ {0};
+};
+}  // namespace BackgroundTaskMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_CONTINUOUS_TASK_INCLUDE_CONTINUOUS_TASK_REGISTRY_H
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_CONTINUOUS_TASK_INCLUDE_CONTINUOUS_TASK_SNAPSHOT_H
+#define FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_CONTINUOUS_TASK_INCLUDE_CONTINUOUS_TASK_SNAPSHOT_H
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "continuous_task_callback_info.h"
+#include "continuous_task_info.h"
+#include "continuous_task_record.h"
+#include "continuous_task_registry.h"
+
+namespace OHOS {
+namespace BackgroundTaskMgr {
+/**
+ * 长时任务记录表的只读快照，在 handler 线程构建后整体发布，构建完成后不再修改。
+ * 查询接口可在 binder 线程直接读取，记录表版本号未变化时复用预先生成的查询结果。
+ */
+class ContinuousTaskSnapshot {
+public:
+    ContinuousTaskSnapshot(const ContinuousTaskRegistry &registry, uint64_t version);
+    uint64_t GetVersion() const;
+    size_t Size() const;
+    void GetTasks(int32_t uid, bool includeSuspended, bool exemptUid,
+        std::vector<std::shared_ptr<ContinuousTaskInfo>> &list) const;
+    void GetApps(int32_t uid, bool includeSuspended,
+        std::vector<std::shared_ptr<ContinuousTaskCallbackInfo>> &list) const;
+
+    static std::shared_ptr<ContinuousTaskInfo> MakeTaskInfo(const std::shared_ptr<ContinuousTaskRecord> &record);
+    static std::shared_ptr<ContinuousTaskCallbackInfo> MakeAppInfo(
+        const std::shared_ptr<ContinuousTaskRecord> &record);
+
+private:
+    struct Entry {
+        bool suspended_ {false};
+        std::shared_ptr<ContinuousTaskInfo> taskInfo_ {nullptr};
+        std::shared_ptr<ContinuousTaskCallbackInfo> appInfo_ {nullptr};
+    };
+
+    template<typename T>
+    static void AppendAll(const std::vector<std::shared_ptr<T>> &cached, std::vector<std::shared_ptr<T>> &list);
+
+private:
+    uint64_t version_ {0};
+    std::vector<Entry> entries_ {};
+    std::unordered_map<int32_t, std::vector<size_t>> uidIndex_ {};
+    // 全量查询结果，快照发布时生成
+    std::vector<std::shared_ptr<ContinuousTaskInfo>> allTasks_ {};
+    std::vector<std::shared_ptr<ContinuousTaskInfo>> activeTasks_ {};
+    std::vector<std::shared_ptr<ContinuousTaskCallbackInfo>> allApps_ {};
+    std::vector<std::shared_ptr<ContinuousTaskCallbackInfo>> activeApps_ {};
+};
+}  // namespace BackgroundTaskMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_CONTINUOUS_TASK_INCLUDE_CONTINUOUS_TASK_SNAPSHOT_H
@@ -16,6 +16,11 @@
 #ifndef FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_CONTINUOUS_TASK_INCLUDE_NOTIFICATION_TOOLS_H
 #define FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_CONTINUOUS_TASK_INCLUDE_NOTIFICATION_TOOLS_H
 
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <utility>
+
 #include "singleton.h"
 #include "continuous_task_record.h"
 #include "bgtaskmgr_inner_errors.h"
@@ -48,11 +53,29 @@ public:
         const std::map<std::string, std::pair<std::string, std::string>> &newPromptInfos,
         const std::shared_ptr<BannerNotificationRecord> bannerNotification,
         int32_t serviceUid);
+    void RefreshBannerNotifications(const std::vector<std::string> &bannerNotificationBtn,
+        const std::map<std::string, std::pair<std::string, std::string>> &newPromptInfos,
+        const std::map<std::string, std::shared_ptr<BannerNotificationRecord>> &bannerNotifications,
+        int32_t serviceUid);
+    // 批量操作期间取消通知延后到最外层结束时去重下发，期间重新发布的通知不再取消
+    void BeginBatchOperation();
+    void EndBatchOperation();
+    void ShellDump(std::vector<std::string> &dumpInfo);
     std::string CreateBannerNotificationLabel(const std::string &bundleName, int32_t userId,
         int32_t appIndex);
 
 private:
+    bool DeferCancelNotification(const std::string &label, int32_t id);
+    void DropPendingCancel(const std::string &label, int32_t id);
+    void FlushPendingCancels(std::set<std::pair<std::string, int32_t>> &pendingCancels);
+    bool SkipUnchangedNotification(uint64_t lastFingerprint, uint64_t fingerprint);
+
     static int32_t notificationIdIndex_;
+    std::mutex batchMutex_;
+    int32_t batchDepth_ {0};
+    std::set<std::pair<std::string, int32_t>> pendingCancels_ {};
+    std::atomic<uint64_t> publishedCount_ {0};
+    std::atomic<uint64_t> skippedCount_ {0};
 
     DECLARE_DELAYED_SINGLETON(NotificationTools)
 };
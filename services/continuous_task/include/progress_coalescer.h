@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_CONTINUOUS_TASK_INCLUDE_PROGRESS_COALESCER_H
+#define FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_CONTINUOUS_TASK_INCLUDE_PROGRESS_COALESCER_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "progress_info.h"
+
+namespace OHOS {
+namespace BackgroundTaskMgr {
+/**
+ * 数据传输进度通知合并器。每个长时任务的进度通知按最小发布间隔限频，
+ * 间隔内的更新只保留最新值，变化不明显的更新延后一个间隔补发。仅在长时任务线程访问。
+ */
+class ProgressCoalescer {
+public:
+    ProgressCoalescer();
+
+    /**
+     * @brief 判断本次进度更新是否需要立即发布通知.
+     *
+     * @param isChanged 进度之外的通知内容是否变化.
+     * @param delayTime 需要新建延迟发布任务时返回延迟时间，否则为 -1.
+     * @return true 立即发布，false 丢弃或合并到延迟发布.
+     */
+    bool OnProgressUpdate(int32_t taskId, const std::shared_ptr<ProgressInfo> &progressInfo, bool isChanged,
+        int64_t &delayTime);
+    void OnPublished(int32_t taskId, const std::shared_ptr<ProgressInfo> &progressInfo);
+    bool TakePending(int32_t taskId);
+
+    /**
+     * @brief 延迟发布失败时恢复待发布状态，按退避间隔重试，超过重试次数后放弃本次更新.
+     *
+     * @param delayTime 需要新建重试任务时返回延迟时间，否则为 -1.
+     */
+    void OnPublishFailed(int32_t taskId, int64_t &delayTime);
+    void RemoveTask(int32_t taskId);
+    void RemoveIf(const std::function<bool(int32_t)> &fun);
+    size_t Size() const;
+    void ShellDump(std::vector<std::string> &dumpInfo);
+
+private:
+    struct ProgressState {
+        int64_t lastPublishTime_ {0};
+        int32_t lastValue_ {-1};
+        std::string lastTitle_ {""};
+        std::string lastFileName_ {""};
+        bool lastMute_ {false};
+        bool pending_ {false};
+        bool flushScheduled_ {false};
+        int32_t retryTimes_ {0};
+    };
+
+    bool IsSignificant(const ProgressState &state, const std::shared_ptr<ProgressInfo> &progressInfo) const;
+
+private:
+    std::unordered_map<int32_t, ProgressState> states_ {};
+    int64_t minInterval_ {0};
+    int32_t significantDelta_ {0};
+    uint64_t publishedCount_ {0};
+    uint64_t mergedCount_ {0};
+    uint64_t droppedCount_ {0};
+    uint64_t failedCount_ {0};
+};
+}  // namespace BackgroundTaskMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_CONTINUOUS_TASK_INCLUDE_PROGRESS_COALESCER_H
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_CONTINUOUS_TASK_INCLUDE_TASK_SUBSCRIBER_REGISTRY_H
+#define FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_CONTINUOUS_TASK_INCLUDE_TASK_SUBSCRIBER_REGISTRY_H
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "ibackground_task_subscriber.h"
+
+namespace OHOS {
+namespace BackgroundTaskMgr {
+struct SubscriberInfo {
+    SubscriberInfo(sptr<IBackgroundTaskSubscriber> subscriber, int uid, int pid, bool isHap, uint32_t flag)
+        : subscriber_(subscriber), uid_(uid), pid_(pid), isHap_(isHap), flag_(flag) {};
+    sptr<IBackgroundTaskSubscriber> subscriber_;
+    int uid_;
+    int pid_;
+    bool isHap_ {false};
+    uint32_t flag_ {0};
+};
+
+/**
+ * 长时任务回调订阅者列表，按 SA、订阅全量状态的应用、应用 uid 分桶，
+ * 订阅者变化后在下一次事件分发前重建分桶。
+ */
+class TaskSubscriberRegistry {
+public:
+    using SubscriberList = std::list<std::shared_ptr<SubscriberInfo>>;
+    using SubscriberBucket = std::vector<std::shared_ptr<SubscriberInfo>>;
+    using iterator = SubscriberList::iterator;
+    using const_iterator = SubscriberList::const_iterator;
+
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+    bool empty() const;
+    size_t size() const;
+    void emplace_back(const std::shared_ptr<SubscriberInfo> &subscriberInfo);
+    iterator erase(iterator iter);
+    void clear();
+
+    void UpdateFlag(iterator iter, uint32_t flag);
+    const SubscriberBucket &GetSaSubscribers();
+    const SubscriberBucket &GetStateSubscribers();
+    const SubscriberBucket &GetHapSubscribers(int32_t uid);
+    bool HasHapSubscriber(int32_t uid, uint32_t flag);
+
+private:
+    void CheckAndRebuildBuckets();
+
+private:
+    SubscriberList subscribers_ {};
+    SubscriberBucket saSubscribers_ {};
+    SubscriberBucket stateSubscribers_ {};
+    std::unordered_map<int32_t, SubscriberBucket> hapSubscribers_ {};
+    bool bucketDirty_ {false};
+};
+}  // namespace BackgroundTaskMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_CONTINUOUS_TASK_INCLUDE_TASK_SUBSCRIBER_REGISTRY_H
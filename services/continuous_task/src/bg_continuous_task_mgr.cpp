@@ -16,6 +16,7 @@
 #include "bg_continuous_task_mgr.h"
 #include "background_task_mgr_service.h"
 
+#include <algorithm>
 #include <sstream>
 #include <unistd.h>
 #include <fcntl.h>
@@ -45,6 +46,7 @@
 #include "string_wrapper.h"
 #include "system_ability_definition.h"
 
+#include "bg_mode_set.h"
 #include "bgtask_common.h"
 #include "bgtask_config.h"
 #include "bgtask_hitrace_chain.h"
@@ -53,6 +55,7 @@
 #include "continuous_task_log.h"
 #include "system_event_observer.h"
 #include "data_storage_helper.h"
+#include "subscriber_delivery_queue.h"
 #ifdef SUPPORT_GRAPHICS
 #include "locale_config.h"
 #endif // SUPPORT_GRAPHICS
@@ -147,6 +150,9 @@ static constexpr char DUMP_PARAM_CANCEL_ALL[] = "--cancel_all";
 static constexpr char DUMP_PARAM_CANCEL[] = "--cancel";
 static constexpr char DUMP_PARAM_GET[] = "--get";
 static constexpr char DUMP_INNER_TASK[] = "--inner_task";
+static constexpr char DUMP_PARAM_PERSISTENCE[] = "--persistence";
+static constexpr char DUMP_PARAM_PROGRESS[] = "--progress";
+static constexpr char DUMP_PARAM_NOTIFICATION[] = "--notification";
 static constexpr char BGMODE_PERMISSION[] = "ohos.permission.KEEP_BACKGROUND_RUNNING";
 static constexpr char BGMODE_PERMISSION_SYSTEM[] = "ohos.permission.KEEP_BACKGROUND_RUNNING_SYSTEM";
 static constexpr char BGMODE_PERMISSION_SPECIAL_SCENARIO[] = "ohos.permission.KEEP_BACKGROUND_RUNNING_SPECIAL_SCENARIO";
@@ -178,6 +184,16 @@ static void GetOsAccountIdFromUid(int32_t uid, int32_t &osAccountId)
     osAccountId = uid / UID_TRANSFORM_DIVISOR;
 }
 #endif // HAS_OS_ACCOUNT_PART
+
+// 优先按模式集合比较，任一集合不可表示时回退到 vector 比较
+static bool IsSameModes(const BgModeSet &oldModes, const std::vector<uint32_t> &oldBgModeIds,
+    const BgModeSet &newModes, const std::vector<uint32_t> &newBgModeIds)
+{
+    if (oldModes.IsRepresentable() && newModes.IsRepresentable()) {
+        return CommonUtils::CheckModesSame(oldModes, newModes);
+    }
+    return CommonUtils::CheckModesSame(oldBgModeIds, newBgModeIds);
+}
 }
 
 #define GET_DISABLE_REQUEST_RESULT_RETURN(uid)                                                  \
@@ -304,14 +320,14 @@ void BgContinuousTaskMgr::InitNecessaryState()
 void BgContinuousTaskMgr::HandlePersistenceData()
 {
     BGTASK_LOGI("service restart, restore data");
-    DelayedSingleton<DataStorageHelper>::GetInstance()->RestoreTaskRecord(continuousTaskInfosMap_);
+    DelayedSingleton<DataStorageHelper>::GetInstance()->RestoreTaskRecord(continuousTaskInfosMap_.GetMutableRecords());
     std::vector<AppExecFwk::RunningProcessInfo> allAppProcessInfos;
     if (!AppMgrHelper::GetInstance()->GetAllRunningProcesses(allAppProcessInfos)) {
         BGTASK_LOGE("get all running process fail.");
         return;
     }
     CheckPersistenceData(allAppProcessInfos);
-    DelayedSingleton<DataStorageHelper>::GetInstance()->RefreshTaskRecord(continuousTaskInfosMap_);
+    DelayedSingleton<DataStorageHelper>::GetInstance()->RefreshTaskRecord(continuousTaskInfosMap_.GetRecords());
     RestoreApplyRecord();
     DelayedSingleton<DataStorageHelper>::GetInstance()->RestoreAuthRecord(bannerNotificationRecord_);
     DelayedSingleton<DataStorageHelper>::GetInstance()->RefreshAuthRecord(bannerNotificationRecord_);
@@ -516,18 +532,36 @@ std::shared_ptr<Global::Resource::ResourceManager> BgContinuousTaskMgr::GetBundl
     return resourceManager;
 }
 
-bool BgContinuousTaskMgr::GetNotificationPrompt()
+std::shared_ptr<Global::Resource::ResourceManager> BgContinuousTaskMgr::GetBgTaskResMgr()
 {
-    BgTaskHiTraceChain traceChain(__func__);
-    continuousTaskText_.clear();
-    continuousTaskSubText_.clear();
+    std::lock_guard<std::mutex> lock(resMgrMutex_);
+    if (bgTaskResMgr_ != nullptr) {
+        return bgTaskResMgr_;
+    }
     AppExecFwk::BundleInfo bundleInfo;
     if (!BundleManagerHelper::GetInstance()->GetBundleInfo(BG_TASK_RES_BUNDLE_NAME,
         AppExecFwk::BundleFlag::GET_BUNDLE_WITH_ABILITIES, bundleInfo)) {
         BGTASK_LOGE("get background task res: %{public}s bundle info failed", BG_TASK_RES_BUNDLE_NAME);
-        return false;
+        return nullptr;
     }
-    auto resourceManager = GetBundleResMgr(bundleInfo);
+    bgTaskResMgr_ = GetBundleResMgr(bundleInfo);
+    return bgTaskResMgr_;
+}
+
+void BgContinuousTaskMgr::ResetBgTaskResMgr()
+{
+    std::lock_guard<std::mutex> lock(resMgrMutex_);
+    bgTaskResMgr_ = nullptr;
+    mergeNotificationTextCache_.clear();
+}
+
+bool BgContinuousTaskMgr::GetNotificationPrompt()
+{
+    BgTaskHiTraceChain traceChain(__func__);
+    continuousTaskText_.clear();
+    continuousTaskSubText_.clear();
+    ResetBgTaskResMgr();
+    auto resourceManager = GetBgTaskResMgr();
     if (resourceManager == nullptr) {
         BGTASK_LOGE("Get bgtask resource hap manager failed");
         return false;
@@ -899,12 +933,44 @@ ErrCode BgContinuousTaskMgr::RequestGetContinuousTasksByUidForInner(int32_t uid,
     ErrCode result = ERR_OK;
     HitraceScoped traceScoped(HITRACE_TAG_OHOS,
         "BackgroundTaskManager::ContinuousTask::Service::RequestGetContinuousTasksByUidForInner");
-    handler_->PostSyncTask([this, uid, &list, &result]() {
-        result = this->GetAllContinuousTasksInner(uid, list);
+    auto snapshot = GetValidSnapshot();
+    if (snapshot != nullptr) {
+        snapshot->GetTasks(uid, true, false, list);
+        return result;
+    }
+    handler_->PostSyncTask([this, uid, &list]() {
+        this->PublishSnapshot()->GetTasks(uid, true, false, list);
         }, AppExecFwk::EventQueue::Priority::HIGH);
     return result;
 }
 
+ErrCode BgContinuousTaskMgr::RequestGetContinuousTasksByUidsForInner(const std::vector<int32_t> &uids,
+    std::vector<std::shared_ptr<ContinuousTaskInfo>> &list)
+{
+    if (!isSysReady_.load()) {
+        BGTASK_LOGW("manager is not ready");
+        return ERR_BGTASK_SYS_NOT_READY;
+    }
+    HitraceScoped traceScoped(HITRACE_TAG_OHOS,
+        "BackgroundTaskManager::ContinuousTask::Service::RequestGetContinuousTasksByUidsForInner");
+    auto snapshot = GetValidSnapshot();
+    if (snapshot == nullptr) {
+        handler_->PostSyncTask([this, &snapshot]() {
+            snapshot = this->PublishSnapshot();
+            }, AppExecFwk::EventQueue::Priority::HIGH);
+    }
+    if (snapshot == nullptr) {
+        return ERR_OK;
+    }
+    std::unordered_set<int32_t> visitedUids;
+    for (int32_t uid : uids) {
+        if (visitedUids.insert(uid).second) {
+            snapshot->GetTasks(uid, true, false, list);
+        }
+    }
+    return ERR_OK;
+}
+
 std::string BgContinuousTaskMgr::GetAbilityNamePid(
     const sptr<ContinuousTaskParamForInner> &taskParam, int32_t pid, int32_t callingUid)
 {
@@ -1033,7 +1099,7 @@ void BgContinuousTaskMgr::InitRecordParam(std::shared_ptr<ContinuousTaskRecord>
     continuousTaskRecord->fullTokenId_ = fullTokenId;
     continuousTaskRecord->callingTokenId_ = callingTokenId;
     continuousTaskRecord->isSystem_ = BundleManagerHelper::GetInstance()->IsSystemApp(fullTokenId);
-    continuousTaskRecord->bgSubModeIds_ = taskParam->bgSubModeIds_;
+    continuousTaskRecord->SetBgSubModeIds(taskParam->bgSubModeIds_);
     continuousTaskRecord->isCombinedTaskNotification_ = taskParam->isCombinedTaskNotification_;
     continuousTaskRecord->combinedNotificationTaskId_ = taskParam->combinedNotificationTaskId_;
     continuousTaskRecord->isByRequestObject_ = taskParam->isByRequestObject_;
@@ -1047,7 +1113,7 @@ ErrCode BgContinuousTaskMgr::CheckSubMode(const std::shared_ptr<AAFwk::Want> wan
     if (want->HasParameter(BG_TASK_SUB_MODE_TYPE)) {
         if (CommonUtils::CheckExistMode(record->bgModeIds_, BackgroundMode::BLUETOOTH_INTERACTION) &&
             want->GetIntParam(BG_TASK_SUB_MODE_TYPE, 0) == BackgroundSubMode::CAR_KEY && !record->isByRequestObject_) {
-            record->bgSubModeIds_.push_back(BackgroundSubMode::CAR_KEY);
+            record->AddBgSubModeId(BackgroundSubMode::CAR_KEY);
         } else {
             BGTASK_LOGE("subMode is invaild.");
             return ERR_BGTASK_CHECK_TASK_PARAM;
@@ -1095,22 +1161,21 @@ ErrCode BgContinuousTaskMgr::UpdateTaskInfo(std::shared_ptr<ContinuousTaskRecord
     if (ret != ERR_OK) {
         return ret;
     }
+    std::string taskInfoMapKey = std::to_string(record->uid_) + SEPARATOR + record->abilityName_ + SEPARATOR +
+        std::to_string(record->abilityId_) + SEPARATOR + std::to_string(record->GetContinuousTaskId());
     if (record->suspendState_) {
-        std::string taskInfoMapKey = std::to_string(record->uid_) + SEPARATOR + record->abilityName_ + SEPARATOR +
-            std::to_string(record->abilityId_) + SEPARATOR + std::to_string(record->GetContinuousTaskId());
         HandleActiveContinuousTask(record->uid_, record->pid_, taskInfoMapKey);
     }
     BGTASK_LOGI("update continuous task success, taskId: %{public}d", record->GetContinuousTaskId());
     OnContinuousTaskChanged(record, ContinuousTaskEventTriggerType::TASK_UPDATE);
     taskParam->notificationId_ = record->GetNotificationId();
     taskParam->continuousTaskId_ = record->GetContinuousTaskId();
-    return RefreshTaskRecord();
+    return RefreshTaskRecord(taskInfoMapKey);
 }
 
 ErrCode BgContinuousTaskMgr::UpdateTaskNotification(std::shared_ptr<ContinuousTaskRecord> record,
     const sptr<ContinuousTaskParam> &taskParam)
 {
-    auto oldModes = record->bgModeIds_;
     std::string mainAbilityLabel = GetMainAbilityLabel(record->bundleName_, record->userId_);
     if (mainAbilityLabel == "") {
         BGTASK_LOGE("uid: %{public}d get main ability label or notification text fail.", record->uid_);
@@ -1118,8 +1183,12 @@ ErrCode BgContinuousTaskMgr::UpdateTaskNotification(std::shared_ptr<ContinuousTa
     }
     if (!record->isCombinedTaskNotification_) {
         record->bgModeId_ = taskParam->bgModeId_;
-        record->bgModeIds_ = taskParam->bgModeIds_;
-        record->bgSubModeIds_ = taskParam->bgSubModeIds_;
+        record->SetBgModeIds(taskParam->bgModeIds_);
+        record->SetBgSubModeIds(taskParam->bgSubModeIds_);
+    }
+    if (record->wantAgent_ != taskParam->wantAgent_) {
+        // 指纹只覆盖 wantAgent 的跳转目标，重新设置 wantAgent 时需强制重新发布
+        record->ResetNotificationFingerprint();
     }
     record->wantAgent_ = taskParam->wantAgent_;
     if (record->wantAgent_ != nullptr && record->wantAgent_->GetPendingWant() != nullptr) {
@@ -1134,7 +1203,9 @@ ErrCode BgContinuousTaskMgr::UpdateTaskNotification(std::shared_ptr<ContinuousTa
     }
     std::map<std::string, std::pair<std::string, std::string>> newPromptInfos;
     if (record->isCombinedTaskNotification_) {
-        if (CommonUtils::CheckModesSame(oldModes, taskParam->bgModeIds_)) {
+        // 合并通知的任务不会更新模式，记录中的模式即为更新前的模式
+        if (IsSameModes(record->GetBgModeSet(), record->bgModeIds_, BgModeSet(taskParam->bgModeIds_),
+            taskParam->bgModeIds_)) {
             newPromptInfos.emplace(record->notificationLabel_, std::make_pair(mainAbilityLabel, ""));
             return NotificationTools::GetInstance()->RefreshContinuousNotificationWantAndContext(bgTaskUid_,
                 newPromptInfos, record);
@@ -1166,11 +1237,8 @@ ErrCode BgContinuousTaskMgr::UpdateBackgroundRunningByTaskIdInner(int32_t uid,
         BGTASK_LOGE("update task fail, taskId: %{public}d", taskParam->updateTaskId_);
         return ERR_BGTASK_CONTINUOUS_TASKID_INVALID;
     }
-    auto findTask = [continuousTaskId](const auto &target) {
-        return continuousTaskId == target.second->continuousTaskId_ && target.second->isByRequestObject_;
-    };
-    auto findTaskIter = find_if(continuousTaskInfosMap_.begin(), continuousTaskInfosMap_.end(), findTask);
-    if (findTaskIter == continuousTaskInfosMap_.end()) {
+    auto findTaskIter = continuousTaskInfosMap_.FindByTaskId(continuousTaskId);
+    if (findTaskIter == continuousTaskInfosMap_.end() || !findTaskIter->second->isByRequestObject_) {
         BGTASK_LOGE("uid: %{public}d not have task, taskId: %{public}d", uid, continuousTaskId);
         return ERR_BGTASK_OBJECT_NOT_EXIST;
     }
@@ -1213,7 +1281,7 @@ ErrCode BgContinuousTaskMgr::UpdateBackgroundRunningInner(const std::string &tas
 
     auto continuousTaskRecord = iter->second;
     GET_DISABLE_REQUEST_RESULT_RETURN(continuousTaskRecord->GetUid());
-    auto oldModes = continuousTaskRecord->bgModeIds_;
+    BgModeSet oldModes = continuousTaskRecord->GetBgModeSet();
 
     BGTASK_LOGI("background task mode %{public}d, old modes: %{public}s, new modes %{public}s, isBatchApi %{public}d,"
         " abilityId %{public}d", continuousTaskRecord->bgModeId_,
@@ -1221,12 +1289,13 @@ ErrCode BgContinuousTaskMgr::UpdateBackgroundRunningInner(const std::string &tas
         continuousTaskRecord->ToString(taskParam->bgModeIds_).c_str(),
         continuousTaskRecord->isBatchApi_, continuousTaskRecord->abilityId_);
     // update continuoustask by same modes.
-    if (CommonUtils::CheckModesSame(oldModes, taskParam->bgModeIds_)) {
+    if (IsSameModes(oldModes, continuousTaskRecord->bgModeIds_, BgModeSet(taskParam->bgModeIds_),
+        taskParam->bgModeIds_)) {
         return ERR_OK;
     }
     if (!CommonUtils::CheckExistMode(taskParam->bgModeIds_, BackgroundMode::BLUETOOTH_INTERACTION) &&
         !continuousTaskRecord->bgSubModeIds_.empty()) {
-        continuousTaskRecord->bgSubModeIds_.clear();
+        continuousTaskRecord->SetBgSubModeIds({});
     }
     uint32_t configuredBgMode = GetBackgroundModeInfo(continuousTaskRecord->uid_, continuousTaskRecord->abilityName_);
     for (auto it =  taskParam->bgModeIds_.begin(); it != taskParam->bgModeIds_.end(); it++) {
@@ -1236,12 +1305,12 @@ ErrCode BgContinuousTaskMgr::UpdateBackgroundRunningInner(const std::string &tas
             return ret;
         }
     }
-    continuousTaskRecord->bgModeIds_ = taskParam->bgModeIds_;
+    continuousTaskRecord->SetBgModeIds(taskParam->bgModeIds_);
     continuousTaskRecord->isBatchApi_ = taskParam->isBatchApi_;
 
     // old and new task hava mode: DATA_TRANSFER, not update notification
-    if (CommonUtils::CheckExistMode(oldModes, BackgroundMode::DATA_TRANSFER) &&
-        CommonUtils::CheckExistMode(continuousTaskRecord->bgModeIds_, BackgroundMode::DATA_TRANSFER)) {
+    if (oldModes.Contains(BackgroundMode::DATA_TRANSFER) &&
+        continuousTaskRecord->GetBgModeSet().Contains(BackgroundMode::DATA_TRANSFER)) {
         BGTASK_LOGI("uid: %{public}d, bundleName: %{public}s, abilityId: %{public}d have same mode: DATA_TRANSFER",
             continuousTaskRecord->uid_, continuousTaskRecord->bundleName_.c_str(), continuousTaskRecord->abilityId_);
     } else {
@@ -1256,7 +1325,7 @@ ErrCode BgContinuousTaskMgr::UpdateBackgroundRunningInner(const std::string &tas
     OnContinuousTaskChanged(continuousTaskRecord, ContinuousTaskEventTriggerType::TASK_UPDATE);
     taskParam->notificationId_ = continuousTaskRecord->GetNotificationId();
     taskParam->continuousTaskId_ = continuousTaskRecord->GetContinuousTaskId();
-    return RefreshTaskRecord();
+    return RefreshTaskRecord(taskInfoMapKey);
 }
 
 ErrCode BgContinuousTaskMgr::UpdateDataTransferProgress(const sptr<DataTransferProgress> &progressInfo)
@@ -1294,14 +1363,8 @@ ErrCode BgContinuousTaskMgr::UpdateDataTransferProgressInner(int32_t uid,
         BGTASK_LOGE("progress info is invalid, taskId: %{public}d", continuousTaskId);
         return ERR_BGTASK_CONTINUOUS_PROGRESS_INFO_INVALID;
     }
-    auto findTask = [continuousTaskId, uid](const auto &target) {
-        if (!target.second) {
-            return false;
-        }
-        return continuousTaskId == target.second->continuousTaskId_ && target.second->uid_ == uid;
-    };
-    auto iter = find_if(continuousTaskInfosMap_.begin(), continuousTaskInfosMap_.end(), findTask);
-    if (iter == continuousTaskInfosMap_.end()) {
+    auto iter = continuousTaskInfosMap_.FindByTaskId(continuousTaskId);
+    if (iter == continuousTaskInfosMap_.end() || iter->second->uid_ != uid) {
         BGTASK_LOGE("uid: %{public}d not have task, taskId: %{public}d", uid, continuousTaskId);
         return ERR_BGTASK_OBJECT_NOT_EXIST;
     }
@@ -1310,27 +1373,68 @@ ErrCode BgContinuousTaskMgr::UpdateDataTransferProgressInner(int32_t uid,
         BGTASK_LOGE("task is not DATA_TRANSFER mode, taskId: %{public}d", continuousTaskId);
         return ERR_BGTASK_CONTINUOUS_NOT_DATA_TRANSFER;
     }
-    if (progressInfo->GetWantAgent() != nullptr) {
+    bool isChanged = progressInfo->GetWantAgent() != nullptr;
+    if (isChanged) {
         record->wantAgent_ = progressInfo->GetWantAgent();
     }
     record->progressInfo_ = progressInfo->GetProgressInfo();
+    if (progressCoalescer_.Size() > continuousTaskInfosMap_.size()) {
+        progressCoalescer_.RemoveIf([this](int32_t taskId) {
+            return continuousTaskInfosMap_.FindByTaskId(taskId) == continuousTaskInfosMap_.end();
+        });
+    }
+    // 进度为瞬时状态，只更新内存和通知，不重写持久化文件
+    int64_t delayTime = -1;
+    if (!progressCoalescer_.OnProgressUpdate(continuousTaskId, record->progressInfo_, isChanged, delayTime)) {
+        if (delayTime >= 0) {
+            auto self = shared_from_this();
+            handler_->PostTask([self, continuousTaskId]() {
+                self->FlushDataTransferProgress(continuousTaskId);
+            }, delayTime);
+        }
+        return ERR_OK;
+    }
     ErrCode ret = SendContinuousTaskNotification(record);
     if (ret != ERR_OK) {
         BGTASK_LOGE("update dataTransfer progress failed, taskId: %{public}d", continuousTaskId);
         return ret;
     }
-    return RefreshTaskRecord();
+    progressCoalescer_.OnPublished(continuousTaskId, record->progressInfo_);
+    return ERR_OK;
+}
+
+void BgContinuousTaskMgr::FlushDataTransferProgress(int32_t continuousTaskId)
+{
+    if (!progressCoalescer_.TakePending(continuousTaskId)) {
+        return;
+    }
+    auto iter = continuousTaskInfosMap_.FindByTaskId(continuousTaskId);
+    if (iter == continuousTaskInfosMap_.end()) {
+        progressCoalescer_.RemoveTask(continuousTaskId);
+        return;
+    }
+    auto record = iter->second;
+    if (SendContinuousTaskNotification(record) != ERR_OK) {
+        BGTASK_LOGE("flush dataTransfer progress failed, taskId: %{public}d", continuousTaskId);
+        int64_t delayTime = -1;
+        progressCoalescer_.OnPublishFailed(continuousTaskId, delayTime);
+        if (delayTime >= 0) {
+            auto self = shared_from_this();
+            handler_->PostTask([self, continuousTaskId]() {
+                self->FlushDataTransferProgress(continuousTaskId);
+            }, delayTime);
+        }
+        return;
+    }
+    progressCoalescer_.OnPublished(continuousTaskId, record->progressInfo_);
 }
 
 ErrCode BgContinuousTaskMgr::CheckAbilityTaskNum(const std::shared_ptr<ContinuousTaskRecord> record)
 {
     uint32_t taskNum = 0;
     int32_t abilityId = record->GetAbilityId();
-    for (const auto &task : continuousTaskInfosMap_) {
-        if (!task.second) {
-            continue;
-        }
-        if (task.second->GetAbilityId() == abilityId && task.second->isByRequestObject_) {
+    for (const auto &key : continuousTaskInfosMap_.GetKeysByAbilityId(abilityId)) {
+        if (continuousTaskInfosMap_.at(key)->isByRequestObject_) {
             taskNum = taskNum + 1;
         }
     }
@@ -1368,7 +1472,10 @@ ErrCode BgContinuousTaskMgr::AllowApplyContinuousTask(const std::shared_ptr<Cont
         checkBgModeIds = applyTaskOnForeground_.at(uid);
     }
     checkBgModeIds.push_back(BackgroundMode::AUDIO_PLAYBACK);
-    if (CommonUtils::CheckApplyMode(record->bgModeIds_, checkBgModeIds)) {
+    const BgModeSet &applyModes = record->GetBgModeSet();
+    bool isApplied = applyModes.IsRepresentable() ? CommonUtils::CheckApplyMode(applyModes, BgModeSet(checkBgModeIds)) :
+        CommonUtils::CheckApplyMode(record->bgModeIds_, checkBgModeIds);
+    if (isApplied) {
         return ERR_OK;
     }
     // 查询前台应用
@@ -1477,7 +1584,11 @@ ErrCode BgContinuousTaskMgr::StartBackgroundRunningSubmit(std::shared_ptr<Contin
         continuousTaskRecord->continuousTaskId_);
     continuousTaskInfosMap_.emplace(taskInfoMapKey, continuousTaskRecord);
     OnContinuousTaskChanged(continuousTaskRecord, ContinuousTaskEventTriggerType::TASK_START);
-    return RefreshTaskRecord();
+    if (!sendNotification) {
+        // 合并通知会同时修改被合并任务的记录，全量落盘
+        return RefreshTaskRecord();
+    }
+    return RefreshTaskRecord(taskInfoMapKey);
 }
 
 ErrCode BgContinuousTaskMgr::CheckCombinedTaskNotification(std::shared_ptr<ContinuousTaskRecord> &recordParam,
@@ -1516,46 +1627,40 @@ ErrCode BgContinuousTaskMgr::DetermineMatchCombinedTaskNotifacation(std::shared_
     bool &sendNotification)
 {
     int32_t mergeNotificationTaskId = recordParam->combinedNotificationTaskId_;
-    ErrCode ret = ERR_BGTASK_CONTINUOUS_TASKID_INVALID;
-    for (const auto &record : continuousTaskInfosMap_) {
-        if (!record.second) {
-            BGTASK_LOGE("current task is null");
-            continue;
-        }
-        if (record.second->uid_ != recordParam->uid_) {
-            BGTASK_LOGE("current task uid not equal, task uid: %{public}d, param uid: %{public}d", record.second->uid_,
-                recordParam->uid_);
-            continue;
-        }
-        if (record.second->GetContinuousTaskId() != mergeNotificationTaskId) {
-            BGTASK_LOGE("task id is not equal, task id: %{public}d, param combined task id: %{public}d",
-                record.second->GetContinuousTaskId(), mergeNotificationTaskId);
-            continue;
-        }
-        if (!record.second->isCombinedTaskNotification_) {
-            BGTASK_LOGE("continuous task not support merge, taskId: %{public}d", mergeNotificationTaskId);
-            return ERR_BGTASK_CONTINUOUS_NOT_MERGE_COMBINED_FALSE;
-        }
-        if (record.second->GetNotificationId() == -1) {
-            BGTASK_LOGE("continuous task notification not exist, taskId: %{public}d", mergeNotificationTaskId);
-            return ERR_BGTASK_CONTINUOUS_NOT_MERGE_NOTIFICATION_NOT_EXIST;
-        }
-        if (!CommonUtils::CheckModesSame(record.second->bgModeIds_, recordParam->bgModeIds_)) {
-            BGTASK_LOGE("background task modes mismatch, taskId: %{public}d", mergeNotificationTaskId);
-            return ERR_BGTASK_CONTINUOUS_MODE_OR_SUBMODE_TYPE_MISMATCH;
-        }
-        if (!CommonUtils::CheckModesSame(record.second->bgSubModeIds_, recordParam->bgSubModeIds_)) {
-            BGTASK_LOGE("background task submodes mismatch, taskId: %{public}d", mergeNotificationTaskId);
-            return ERR_BGTASK_CONTINUOUS_MODE_OR_SUBMODE_TYPE_MISMATCH;
-        } else {
-            sendNotification = false;
-            recordParam->notificationId_ = record.second->GetNotificationId();
-            recordParam->notificationLabel_ = record.second->GetNotificationLabel();
-            record.second->combinedNotificationTaskId_ = mergeNotificationTaskId;
-            return ERR_OK;
-        }
+    auto findTaskIter = continuousTaskInfosMap_.FindByTaskId(mergeNotificationTaskId);
+    if (findTaskIter == continuousTaskInfosMap_.end()) {
+        BGTASK_LOGE("task id not exist, param combined task id: %{public}d", mergeNotificationTaskId);
+        return ERR_BGTASK_CONTINUOUS_TASKID_INVALID;
     }
-    return ret;
+    auto record = findTaskIter->second;
+    if (record->uid_ != recordParam->uid_) {
+        BGTASK_LOGE("current task uid not equal, task uid: %{public}d, param uid: %{public}d", record->uid_,
+            recordParam->uid_);
+        return ERR_BGTASK_CONTINUOUS_TASKID_INVALID;
+    }
+    if (!record->isCombinedTaskNotification_) {
+        BGTASK_LOGE("continuous task not support merge, taskId: %{public}d", mergeNotificationTaskId);
+        return ERR_BGTASK_CONTINUOUS_NOT_MERGE_COMBINED_FALSE;
+    }
+    if (record->GetNotificationId() == -1) {
+        BGTASK_LOGE("continuous task notification not exist, taskId: %{public}d", mergeNotificationTaskId);
+        return ERR_BGTASK_CONTINUOUS_NOT_MERGE_NOTIFICATION_NOT_EXIST;
+    }
+    if (!IsSameModes(record->GetBgModeSet(), record->bgModeIds_, recordParam->GetBgModeSet(),
+        recordParam->bgModeIds_)) {
+        BGTASK_LOGE("background task modes mismatch, taskId: %{public}d", mergeNotificationTaskId);
+        return ERR_BGTASK_CONTINUOUS_MODE_OR_SUBMODE_TYPE_MISMATCH;
+    }
+    if (!IsSameModes(record->GetBgSubModeSet(), record->bgSubModeIds_, recordParam->GetBgSubModeSet(),
+        recordParam->bgSubModeIds_)) {
+        BGTASK_LOGE("background task submodes mismatch, taskId: %{public}d", mergeNotificationTaskId);
+        return ERR_BGTASK_CONTINUOUS_MODE_OR_SUBMODE_TYPE_MISMATCH;
+    }
+    sendNotification = false;
+    recordParam->notificationId_ = record->GetNotificationId();
+    recordParam->notificationLabel_ = record->GetNotificationLabel();
+    record->combinedNotificationTaskId_ = mergeNotificationTaskId;
+    return ERR_OK;
 }
 
 uint32_t GetBgModeNameIndex(uint32_t bgModeId, bool isNewApi)
@@ -1571,6 +1676,8 @@ ErrCode BgContinuousTaskMgr::SendContinuousTaskNotification(
     std::shared_ptr<ContinuousTaskRecord> &continuousTaskRecord)
 {
     BgTaskHiTraceChain traceChain(__func__);
+    // 发布或取消通知会修改通知 id
+    continuousTaskInfosMap_.Touch();
     if (continuousTaskText_.empty()) {
         BGTASK_LOGE("get notification prompt info failed, continuousTaskText_ is empty");
         return ERR_BGTASK_NOTIFICATION_VERIFY_FAILED;
@@ -1628,6 +1735,7 @@ void BgContinuousTaskMgr::FilterNotificationMode(const std::shared_ptr<Continuou
     bool isPublish = (iter != avSessionNotification_.end()) ? iter->second : false;
     bool isPublishAvsession = isPublish || (CommonUtils::CheckExistMode(subModesValue,
         BackgroundTaskSubmode::SUBMODE_AVSESSION_AUDIO_PLAYBACK) && record->isByRequestObject_);
+    BgModeSet checkModeSet;
     for (const auto mode : modesValue) {
         if ((mode == BackgroundMode::AUDIO_PLAYBACK && isPublishAvsession) || ((mode == BackgroundMode::VOIP ||
             mode == BackgroundMode::AUDIO_RECORDING) && record->IsSystem())) {
@@ -1636,8 +1744,9 @@ void BgContinuousTaskMgr::FilterNotificationMode(const std::shared_ptr<Continuou
             continue;
         }
         checkModes.push_back(mode);
+        checkModeSet.Add(mode);
     }
-    CommonUtils::SortMode(checkModes);
+    CommonUtils::SortMode(checkModes, checkModeSet);
 }
 
 ErrCode BgContinuousTaskMgr::CheckNotificationText(std::string &notificationText,
@@ -1744,17 +1853,6 @@ WEAK_FUNC ErrCode BgContinuousTaskMgr::FormatNotificationText(std::string &notif
     const std::vector<uint32_t> &checkModes, const std::string &mergeBlueNotificationText,
     std::vector<std::tuple<Global::Resource::ResourceManager::NapiValueType, std::string>> &jsParams)
 {
-    AppExecFwk::BundleInfo bundleInfo;
-    if (!BundleManagerHelper::GetInstance()->GetBundleInfo(BG_TASK_RES_BUNDLE_NAME,
-        AppExecFwk::BundleFlag::GET_BUNDLE_WITH_ABILITIES, bundleInfo)) {
-        BGTASK_LOGE("get bundleName bundleInfo: %{public}s bundle info failed.", BG_TASK_RES_BUNDLE_NAME);
-        return ERR_BGTASK_NOTIFICATION_VERIFY_FAILED;
-    }
-    auto resourceManager = GetBundleResMgr(bundleInfo);
-    if (resourceManager == nullptr) {
-        BGTASK_LOGE("resourceManager is null.");
-        return ERR_BGTASK_NOTIFICATION_VERIFY_FAILED;
-    }
     std::string notificationFormatType {""};
     if (checkModes.size() == MAX_NOTIFICATION_TEXT_TYPE - 1) {
         // 双类型通知
@@ -1766,11 +1864,33 @@ WEAK_FUNC ErrCode BgContinuousTaskMgr::FormatNotificationText(std::string &notif
         // 超三类型通知
         notificationFormatType = g_taskNotificationResNames[MAX_NOTIFICATION_TEXT_TYPE - 1];
     }
+    // 格式化结果只取决于格式类型及参与格式化的前几个类型
+    std::string cacheKey = notificationFormatType;
+    size_t formatModeNum = std::min(checkModes.size(), static_cast<size_t>(MAX_NOTIFICATION_TEXT_TYPE));
+    for (size_t index = 0; index < formatModeNum; index++) {
+        cacheKey += "_" + std::to_string(checkModes[index]);
+    }
     std::string notificationMergeText {""};
-    resourceManager->GetStringFormatByName(notificationFormatType.c_str(), notificationMergeText, jsParams);
+    {
+        std::lock_guard<std::mutex> lock(resMgrMutex_);
+        auto iter = mergeNotificationTextCache_.find(cacheKey);
+        if (iter != mergeNotificationTextCache_.end()) {
+            notificationMergeText = iter->second;
+        }
+    }
     if (notificationMergeText.empty()) {
-        BGTASK_LOGE("get merge notification title text failed!");
-        return ERR_BGTASK_NOTIFICATION_VERIFY_FAILED;
+        auto resourceManager = GetBgTaskResMgr();
+        if (resourceManager == nullptr) {
+            BGTASK_LOGE("resourceManager is null.");
+            return ERR_BGTASK_NOTIFICATION_VERIFY_FAILED;
+        }
+        resourceManager->GetStringFormatByName(notificationFormatType.c_str(), notificationMergeText, jsParams);
+        if (notificationMergeText.empty()) {
+            BGTASK_LOGE("get merge notification title text failed!");
+            return ERR_BGTASK_NOTIFICATION_VERIFY_FAILED;
+        }
+        std::lock_guard<std::mutex> lock(resMgrMutex_);
+        mergeNotificationTextCache_[cacheKey] = notificationMergeText;
     }
     notificationText = mergeBlueNotificationText + notificationMergeText;
     return ERR_OK;
@@ -1860,24 +1980,19 @@ ErrCode BgContinuousTaskMgr::StopBackgroundRunningInner(int32_t uid, const std::
     BgTaskHiTraceChain traceChain(__func__);
     if (continuousTaskId != -1) {
         // 新接口取消
-        auto findTask = [continuousTaskId](const auto &target) {
-            return continuousTaskId == target.second->continuousTaskId_;
-        };
-        auto findTaskIter = find_if(continuousTaskInfosMap_.begin(), continuousTaskInfosMap_.end(),
-            findTask);
+        auto findTaskIter = continuousTaskInfosMap_.FindByTaskId(continuousTaskId);
         if (findTaskIter == continuousTaskInfosMap_.end()) {
             BGTASK_LOGE("uid: %{public}d not have task, taskId: %{public}d", uid, continuousTaskId);
             return ERR_BGTASK_OBJECT_NOT_EXIST;
         }
         return StopBackgroundRunningByTask(findTaskIter->second);
     } else {
-        auto findTask = [uid, abilityName, abilityId](const auto &target) {
-            return uid == target.second->uid_ && abilityName == target.second->abilityName_
-                && abilityId == target.second->abilityId_;
+        auto findTask = [this, &abilityName, abilityId](const std::string &key) {
+            auto record = continuousTaskInfosMap_.at(key);
+            return abilityName == record->abilityName_ && abilityId == record->abilityId_;
         };
-        auto findTaskIter = find_if(continuousTaskInfosMap_.begin(), continuousTaskInfosMap_.end(),
-            findTask);
-        if (findTaskIter == continuousTaskInfosMap_.end()) {
+        auto taskKeys = continuousTaskInfosMap_.GetKeysByUid(uid);
+        if (find_if(taskKeys.begin(), taskKeys.end(), findTask) == taskKeys.end()) {
             BGTASK_LOGE("uid: %{public}d not have task", uid);
             return ERR_BGTASK_OBJECT_NOT_EXIST;
         }
@@ -1890,14 +2005,11 @@ ErrCode BgContinuousTaskMgr::StopBackgroundRunningByContext(int32_t uid, const s
     int32_t abilityId)
 {
     std::vector<std::shared_ptr<ContinuousTaskRecord>> tasklist {};
-    auto iter = continuousTaskInfosMap_.begin();
-    while (iter != continuousTaskInfosMap_.end()) {
-        if (iter->second->uid_ == uid && iter->second->abilityName_ == abilityName &&
-            iter->second->abilityId_ == abilityId) {
-            auto record = iter->second;
+    for (const auto &key : continuousTaskInfosMap_.GetKeysByUid(uid)) {
+        auto record = continuousTaskInfosMap_.at(key);
+        if (record->abilityName_ == abilityName && record->abilityId_ == abilityId) {
             tasklist.push_back(record);
         }
-        iter++;
     }
     ErrCode ret = ERR_OK;
     for (const auto &record : tasklist) {
@@ -1916,10 +2028,7 @@ ErrCode BgContinuousTaskMgr::StopBackgroundRunningByTask(const std::shared_ptr<C
         return ERR_BGTASK_CHECK_TASK_PARAM;
     }
     int32_t continuousTaskId = task->GetContinuousTaskId();
-    auto findTask = [continuousTaskId](const auto &target) {
-        return continuousTaskId == target.second->continuousTaskId_;
-    };
-    auto findTaskIter = find_if(continuousTaskInfosMap_.begin(), continuousTaskInfosMap_.end(), findTask);
+    auto findTaskIter = continuousTaskInfosMap_.FindByTaskId(continuousTaskId);
     if (findTaskIter == continuousTaskInfosMap_.end()) {
         BGTASK_LOGE("no have task, taskId: %{public}d", continuousTaskId);
         return ERR_BGTASK_OBJECT_EXISTS;
@@ -1927,10 +2036,11 @@ ErrCode BgContinuousTaskMgr::StopBackgroundRunningByTask(const std::shared_ptr<C
     auto record = findTaskIter->second;
     OnContinuousTaskChanged(record, ContinuousTaskEventTriggerType::TASK_CANCEL);
     BGTASK_LOGI("remove continuous task success, taskId: %{public}d", continuousTaskId);
+    std::string taskInfoMapKey = findTaskIter->first;
     continuousTaskInfosMap_.erase(findTaskIter);
     auto result = CancelNotification(record);
     HandleAppContinuousTaskStop(record->uid_);
-    RefreshTaskRecord();
+    RefreshTaskRecord(taskInfoMapKey);
     return result;
 }
 
@@ -1943,8 +2053,13 @@ ErrCode BgContinuousTaskMgr::GetAllContinuousTasks(std::vector<std::shared_ptr<C
     }
     HitraceScoped traceScoped(HITRACE_TAG_OHOS,
         "BackgroundTaskManager::ContinuousTask::Service::GetAllContinuousTasks");
-    handler_->PostSyncTask([this, callingUid, &list, &result]() {
-        result = this->GetAllContinuousTasksInner(callingUid, list);
+    auto snapshot = GetValidSnapshot();
+    if (snapshot != nullptr) {
+        snapshot->GetTasks(callingUid, true, false, list);
+        return result;
+    }
+    handler_->PostSyncTask([this, callingUid, &list]() {
+        this->PublishSnapshot()->GetTasks(callingUid, true, false, list);
         }, AppExecFwk::EventQueue::Priority::HIGH);
     return result;
 }
@@ -1959,8 +2074,13 @@ ErrCode BgContinuousTaskMgr::GetAllContinuousTasks(
     }
     HitraceScoped traceScoped(HITRACE_TAG_OHOS,
         "BackgroundTaskManager::ContinuousTask::Service::GetAllContinuousTasksIncludeSuspended");
-    handler_->PostSyncTask([this, callingUid, &list, &result, includeSuspended]() {
-        result = this->GetAllContinuousTasksInner(callingUid, list, includeSuspended);
+    auto snapshot = GetValidSnapshot();
+    if (snapshot != nullptr) {
+        snapshot->GetTasks(callingUid, includeSuspended, false, list);
+        return result;
+    }
+    handler_->PostSyncTask([this, callingUid, &list, includeSuspended]() {
+        this->PublishSnapshot()->GetTasks(callingUid, includeSuspended, false, list);
         }, AppExecFwk::EventQueue::Priority::HIGH);
     return result;
 }
@@ -1989,30 +2109,20 @@ ErrCode BgContinuousTaskMgr::GetAllContinuousTasksInner(int32_t uid,
         return ERR_OK;
     }
     BGTASK_LOGD("GetAllContinuousTasksInner, includeSuspended: %{public}d", includeSuspended);
-    for (const auto &record : continuousTaskInfosMap_) {
-        if (!record.second) {
-            continue;
-        }
-        if (!exemptUid && record.second->uid_ != uid) {
-            continue;
+    auto appendTaskInfo = [&list, includeSuspended](const std::shared_ptr<ContinuousTaskRecord> &record) {
+        if (!record || (!includeSuspended && record->suspendState_)) {
+            return;
         }
-        if (!includeSuspended && record.second->suspendState_) {
-            continue;
+        list.push_back(ContinuousTaskSnapshot::MakeTaskInfo(record));
+    };
+    if (exemptUid) {
+        for (const auto &record : continuousTaskInfosMap_) {
+            appendTaskInfo(record.second);
         }
-        std::string wantAgentBundleName {"NULL"};
-        std::string wantAgentAbilityName {"NULL"};
-        if (record.second->wantAgentInfo_ != nullptr) {
-            wantAgentBundleName = record.second->wantAgentInfo_->bundleName_;
-            wantAgentAbilityName = record.second->wantAgentInfo_->abilityName_;
-        }
-        auto info = std::make_shared<ContinuousTaskInfo>(record.second->abilityName_, record.second->uid_,
-            record.second->pid_, record.second->isFromWebview_, record.second->bgModeIds_, record.second->bgSubModeIds_,
-            record.second->notificationId_, record.second->continuousTaskId_, record.second->abilityId_,
-            wantAgentBundleName, wantAgentAbilityName);
-        info->SetBundleName(record.second->bundleName_);
-        info->SetAppIndex(record.second->appIndex_);
-        info->SetByRequestObject(record.second->isByRequestObject_);
-        list.push_back(info);
+        return ERR_OK;
+    }
+    for (const auto &key : continuousTaskInfosMap_.GetKeysByUid(uid)) {
+        appendTaskInfo(continuousTaskInfosMap_.at(key));
     }
     return ERR_OK;
 }
@@ -2065,34 +2175,33 @@ void BgContinuousTaskMgr::SuspendContinuousTask(
     }
     auto self = shared_from_this();
     auto task = [self, uid, pid, reason, key, isStandby]() {
-        if (!self) {
-            return;
-        }
-        bool hasCallback = self->IsExistCallback(uid, CONTINUOUS_TASK_SUSPEND);
-        if (isStandby) {
-            if (hasCallback) {
-                self->HandleSuspendContinuousTaskByStandby(uid, pid, reason, key);
-            }
-            return;
-        }
-        if (hasCallback) {
-            self->HandleSuspendContinuousTask(uid, pid, reason, key);
-        } else {
-            self->HandleStopContinuousTask(uid, pid, 0, key);
+        if (self) {
+            self->DispatchSuspendContinuousTask(uid, pid, reason, key, isStandby);
         }
     };
     handler_->PostTask(task);
 }
 
-bool BgContinuousTaskMgr::IsExistCallback(int32_t uid, uint32_t type)
+void BgContinuousTaskMgr::DispatchSuspendContinuousTask(
+    int32_t uid, int32_t pid, int32_t reason, const std::string &key, bool isStandby)
 {
-    for (auto iter = bgTaskSubscribers_.begin(); iter != bgTaskSubscribers_.end(); ++iter) {
-        if ((*iter)->isHap_ && (*iter)->uid_ == uid && (((*iter)->flag_ & type) > 0)) {
-            BGTASK_LOGD("flag: %{public}u", (*iter)->flag_);
-            return true;
+    bool hasCallback = IsExistCallback(uid, CONTINUOUS_TASK_SUSPEND);
+    if (isStandby) {
+        if (hasCallback) {
+            HandleSuspendContinuousTaskByStandby(uid, pid, reason, key);
         }
+        return;
     }
-    return false;
+    if (hasCallback) {
+        HandleSuspendContinuousTask(uid, pid, reason, key);
+    } else {
+        HandleStopContinuousTask(uid, pid, 0, key);
+    }
+}
+
+bool BgContinuousTaskMgr::IsExistCallback(int32_t uid, uint32_t type)
+{
+    return bgTaskSubscribers_.HasHapSubscriber(uid, type);
 }
 
 void BgContinuousTaskMgr::HandleSuspendContinuousTask(int32_t uid, int32_t pid, int32_t mode, const std::string &key)
@@ -2101,12 +2210,8 @@ void BgContinuousTaskMgr::HandleSuspendContinuousTask(int32_t uid, int32_t pid,
         BGTASK_LOGW("suspend TaskInfo failure, no matched task: %{public}s", key.c_str());
         return;
     }
-    auto iter = continuousTaskInfosMap_.begin();
-    while (iter != continuousTaskInfosMap_.end()) {
-        if (iter->second->GetUid() != uid || iter->first != key) {
-            ++iter;
-            continue;
-        }
+    auto iter = continuousTaskInfosMap_.find(key);
+    if (iter->second != nullptr && iter->second->GetUid() == uid) {
         BGTASK_LOGW("SuspendContinuousTask mode: %{public}d, key %{public}s", mode, key.c_str());
         iter->second->suspendState_ = true;
         iter->second->isStandby_ = false;
@@ -2117,12 +2222,12 @@ void BgContinuousTaskMgr::HandleSuspendContinuousTask(int32_t uid, int32_t pid,
             iter->second->suspendReason_ = static_cast<int32_t>(reasonValue);
         }
         OnContinuousTaskChanged(iter->second, ContinuousTaskEventTriggerType::TASK_SUSPEND);
-        RefreshTaskRecord();
-        break;
+        RefreshTaskRecord(key);
     }
     // 暂停状态取消长时任务通知
-    if (continuousTaskInfosMap_[key] != nullptr) {
-        auto record = continuousTaskInfosMap_[key];
+    if (iter->second != nullptr) {
+        auto record = iter->second;
+        record->ResetNotificationFingerprint();
         NotificationTools::GetInstance()->CancelNotification(record->GetNotificationLabel(),
             record->GetNotificationId());
         int32_t subNotificationId = record->GetSubNotificationId();
@@ -2155,7 +2260,7 @@ void BgContinuousTaskMgr::HandleSuspendContinuousTaskByStandby(
     uint32_t reasonValue = ContinuousTaskSuspendReason::GetSuspendReasonValue(mode, true);
     taskInfo->suspendReason_ = (reasonValue == 0) ? -1 : static_cast<int32_t>(reasonValue);
     OnContinuousTaskChanged(taskInfo, ContinuousTaskEventTriggerType::TASK_SUSPEND);
-    RefreshTaskRecord();
+    RefreshTaskRecord(key);
 }
 
 void BgContinuousTaskMgr::ActiveContinuousTask(int32_t uid, int32_t pid, const std::string &key, bool isStandby)
@@ -2166,36 +2271,183 @@ void BgContinuousTaskMgr::ActiveContinuousTask(int32_t uid, int32_t pid, const s
     }
     auto self = shared_from_this();
     auto task = [self, uid, pid, key, isStandby]() {
-        if (!self) {
-            return;
-        }
-        if (isStandby) {
-            if (self->IsExistCallback(uid, CONTINUOUS_TASK_ACTIVE)) {
-                self->HandleActiveContinuousTaskByStandby(uid, pid, key);
-            }
-            return;
+        if (self) {
+            self->DispatchActiveContinuousTask(uid, pid, key, isStandby);
         }
-        self->HandleActiveContinuousTask(uid, pid, key);
     };
     handler_->PostTask(task);
 }
 
-void BgContinuousTaskMgr::HandleActiveContinuousTask(int32_t uid, int32_t pid, const std::string &key)
+void BgContinuousTaskMgr::DispatchActiveContinuousTask(int32_t uid, int32_t pid, const std::string &key,
+    bool isStandby)
 {
-    auto findTask = [uid](const auto &target) {
-        return uid == target.second->uid_ && target.second->suspendState_;
-    };
-    auto findTaskIter = find_if(continuousTaskInfosMap_.begin(), continuousTaskInfosMap_.end(), findTask);
-    if (findTaskIter == continuousTaskInfosMap_.end()) {
+    if (isStandby) {
+        if (IsExistCallback(uid, CONTINUOUS_TASK_ACTIVE)) {
+            HandleActiveContinuousTaskByStandby(uid, pid, key);
+        }
+        return;
+    }
+    HandleActiveContinuousTask(uid, pid, key);
+}
+
+bool BgContinuousTaskMgr::HasOperationTarget(const ContinuousTaskOperation &operation, bool matchByUid)
+{
+    if (matchByUid) {
+        return continuousTaskInfosMap_.HasUid(operation.GetUid());
+    }
+    auto iter = continuousTaskInfosMap_.find(operation.GetKey());
+    return iter != continuousTaskInfosMap_.end() && iter->second != nullptr &&
+        iter->second->GetUid() == operation.GetUid();
+}
+
+ErrCode BgContinuousTaskMgr::HandleBatchOperation(const std::vector<ContinuousTaskOperation> &operations,
+    std::vector<int32_t> &results, const std::function<ErrCode(const ContinuousTaskOperation &)> &handle)
+{
+    results.assign(operations.size(), ERR_BGTASK_SYS_NOT_READY);
+    if (!isSysReady_.load()) {
+        BGTASK_LOGW("manager is not ready");
+        return ERR_BGTASK_SYS_NOT_READY;
+    }
+    if (operations.empty()) {
+        return ERR_OK;
+    }
+    // 整批操作在一次服务线程任务内完成，落盘与 SA 通知在批次结束时各做一次
+    handler_->PostSyncTask([this, &operations, &results, &handle]() {
+        BatchOperationScope batchScope(*this);
+        for (size_t i = 0; i < operations.size(); i++) {
+            results[i] = handle(operations[i]);
+        }
+        }, AppExecFwk::EventQueue::Priority::HIGH);
+    return ERR_OK;
+}
+
+void BgContinuousTaskMgr::BeginBatchOperation()
+{
+    if (batchDepth_++ == 0) {
+        NotificationTools::GetInstance()->BeginBatchOperation();
+        isCollectingDeliveries_ = true;
+    }
+}
+
+void BgContinuousTaskMgr::EndBatchOperation()
+{
+    if (batchDepth_ <= 0 || --batchDepth_ > 0) {
+        return;
+    }
+    NotificationTools::GetInstance()->EndBatchOperation();
+    if (batchRecordDirty_) {
+        batchRecordDirty_ = false;
+        RefreshTaskRecord();
+    }
+    std::set<int32_t> stoppedUids;
+    stoppedUids.swap(batchStoppedUids_);
+    for (int32_t uid : stoppedUids) {
+        HandleAppContinuousTaskStop(uid);
+    }
+    FlushBatchDeliveries();
+}
+
+void BgContinuousTaskMgr::DeliverToSubscriber(const sptr<IBackgroundTaskSubscriber> &subscriber,
+    const std::function<void(const sptr<IBackgroundTaskSubscriber> &)> &task, const std::string &coalesceKey)
+{
+    if (subscriber == nullptr) {
         return;
     }
+    if (!isCollectingDeliveries_) {
+        DelayedSingleton<SubscriberDeliveryQueue>::GetInstance()->Deliver(DeliveryModule::CONTINUOUS_TASK,
+            subscriber, task, coalesceKey);
+        return;
+    }
+    auto iter = std::find_if(batchDeliveries_.begin(), batchDeliveries_.end(), [&subscriber](const auto &delivery) {
+        return delivery.subscriber_->AsObject() == subscriber->AsObject();
+    });
+    if (iter == batchDeliveries_.end()) {
+        iter = batchDeliveries_.insert(batchDeliveries_.end(), BatchDelivery {subscriber, {}});
+    }
+    // 同一批次内同一任务的更新回调只保留最新状态
+    if (!coalesceKey.empty()) {
+        auto taskIter = std::find_if(iter->tasks_.begin(), iter->tasks_.end(), [&coalesceKey](const auto &item) {
+            return item.first == coalesceKey;
+        });
+        if (taskIter != iter->tasks_.end()) {
+            taskIter->second = task;
+            return;
+        }
+    }
+    iter->tasks_.emplace_back(coalesceKey, task);
+}
+
+void BgContinuousTaskMgr::FlushBatchDeliveries()
+{
+    isCollectingDeliveries_ = false;
+    std::vector<BatchDelivery> deliveries;
+    deliveries.swap(batchDeliveries_);
+    auto deliveryQueue = DelayedSingleton<SubscriberDeliveryQueue>::GetInstance();
+    for (auto &delivery : deliveries) {
+        if (delivery.tasks_.size() == 1) {
+            deliveryQueue->Deliver(DeliveryModule::CONTINUOUS_TASK, delivery.subscriber_,
+                delivery.tasks_[0].second, delivery.tasks_[0].first);
+            continue;
+        }
+        // 订阅接口为逐条回调，合并后仍逐条调用，但每个订阅者只占用一个投递项
+        auto tasks = std::make_shared<decltype(delivery.tasks_)>(std::move(delivery.tasks_));
+        deliveryQueue->Deliver(DeliveryModule::CONTINUOUS_TASK, delivery.subscriber_,
+            [tasks](const sptr<IBackgroundTaskSubscriber> &subscriber) {
+                for (const auto &task : *tasks) {
+                    task.second(subscriber);
+                }
+            });
+    }
+}
+
+ErrCode BgContinuousTaskMgr::StopContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+    std::vector<int32_t> &results)
+{
+    return HandleBatchOperation(operations, results, [this](const ContinuousTaskOperation &operation) -> ErrCode {
+        uint32_t taskType = operation.GetTaskType();
+        bool matchByUid = taskType == BackgroundMode::DATA_TRANSFER || taskType == ALL_MODES;
+        if (!HasOperationTarget(operation, matchByUid)) {
+            return ERR_BGTASK_OBJECT_NOT_EXIST;
+        }
+        HandleStopContinuousTask(operation.GetUid(), operation.GetPid(), taskType, operation.GetKey());
+        return ERR_OK;
+    });
+}
+
+ErrCode BgContinuousTaskMgr::SuspendContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+    std::vector<int32_t> &results)
+{
+    return HandleBatchOperation(operations, results, [this](const ContinuousTaskOperation &operation) -> ErrCode {
+        if (!HasOperationTarget(operation, false)) {
+            return ERR_BGTASK_OBJECT_NOT_EXIST;
+        }
+        DispatchSuspendContinuousTask(operation.GetUid(), operation.GetPid(), operation.GetReason(),
+            operation.GetKey(), operation.IsStandby());
+        return ERR_OK;
+    });
+}
+
+ErrCode BgContinuousTaskMgr::ActiveContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+    std::vector<int32_t> &results)
+{
+    return HandleBatchOperation(operations, results, [this](const ContinuousTaskOperation &operation) -> ErrCode {
+        if (!HasOperationTarget(operation, !operation.IsStandby())) {
+            return ERR_BGTASK_OBJECT_NOT_EXIST;
+        }
+        DispatchActiveContinuousTask(operation.GetUid(), operation.GetPid(), operation.GetKey(),
+            operation.IsStandby());
+        return ERR_OK;
+    });
+}
+
+void BgContinuousTaskMgr::HandleActiveContinuousTask(int32_t uid, int32_t pid, const std::string &key)
+{
     std::string notificationLabel = "default";
     int32_t notificationId = ILLEGAL_NOTIFICATION_ID;
     std::vector<int32_t> notificationOldIds {};
-    auto iter = continuousTaskInfosMap_.begin();
-    while (iter != continuousTaskInfosMap_.end()) {
-        if (iter->second->GetUid() != uid || !iter->second->suspendState_) {
-            ++iter;
+    for (const auto &taskKey : continuousTaskInfosMap_.GetKeysByUid(uid)) {
+        auto iter = continuousTaskInfosMap_.find(taskKey);
+        if (!iter->second->suspendState_) {
             continue;
         }
         BGTASK_LOGI("ActiveContinuousTask uid: %{public}d, pid: %{public}d", uid, pid);
@@ -2214,7 +2466,7 @@ void BgContinuousTaskMgr::HandleActiveContinuousTask(int32_t uid, int32_t pid, c
                 iter->second->notificationId_ = notificationId;
             }
         }
-        RefreshTaskRecord();
+        RefreshTaskRecord(iter->first);
     }
 }
 
@@ -2229,7 +2481,7 @@ void BgContinuousTaskMgr::HandleActiveContinuousTaskByStandby(int32_t uid, int32
         iter.second->isStandby_ = true;
         iter.second->isStandbySuspend_ = false;
         OnContinuousTaskChanged(iter.second, ContinuousTaskEventTriggerType::TASK_ACTIVE);
-        RefreshTaskRecord();
+        RefreshTaskRecord(iter.first);
     }
 }
 
@@ -2248,10 +2500,10 @@ void BgContinuousTaskMgr::HandleActiveNotification(std::shared_ptr<ContinuousTas
 
 void BgContinuousTaskMgr::RemoveContinuousTaskRecordByUid(int32_t uid)
 {
-    auto iter = continuousTaskInfosMap_.begin();
-    while (iter != continuousTaskInfosMap_.end()) {
-        if (iter->second->GetUid() != uid) {
-            ++iter;
+    BatchOperationScope batchScope(*this);
+    for (const auto &taskKey : continuousTaskInfosMap_.GetKeysByUid(uid)) {
+        auto iter = continuousTaskInfosMap_.find(taskKey);
+        if (iter == continuousTaskInfosMap_.end()) {
             continue;
         }
         BGTASK_LOGW("erase key %{public}s", iter->first.c_str());
@@ -2265,23 +2517,22 @@ void BgContinuousTaskMgr::RemoveContinuousTaskRecordByUid(int32_t uid)
             std::string subNotificationLabel = iter->second->GetSubNotificationLabel();
             NotificationTools::GetInstance()->CancelNotification(subNotificationLabel, subNotificationId);
         }
-        iter = continuousTaskInfosMap_.erase(iter);
-        RefreshTaskRecord();
+        continuousTaskInfosMap_.erase(iter);
+        RefreshTaskRecord(taskKey);
     }
     HandleAppContinuousTaskStop(uid);
 }
 
 void BgContinuousTaskMgr::RemoveContinuousTaskRecordByUidAndMode(int32_t uid, uint32_t mode)
 {
-    auto iter = continuousTaskInfosMap_.begin();
-    while (iter != continuousTaskInfosMap_.end()) {
-        if (iter->second->GetUid() != uid) {
-            ++iter;
+    BatchOperationScope batchScope(*this);
+    for (const auto &taskKey : continuousTaskInfosMap_.GetKeysByUid(uid)) {
+        auto iter = continuousTaskInfosMap_.find(taskKey);
+        if (iter == continuousTaskInfosMap_.end()) {
             continue;
         }
         auto findModeIter = std::find(iter->second->bgModeIds_.begin(), iter->second->bgModeIds_.end(), mode);
         if (findModeIter == iter->second->bgModeIds_.end()) {
-            ++iter;
             continue;
         }
         iter->second->reason_ = FREEZE_CANCEL;
@@ -2294,8 +2545,8 @@ void BgContinuousTaskMgr::RemoveContinuousTaskRecordByUidAndMode(int32_t uid, ui
             std::string subNotificationLabel = iter->second->GetSubNotificationLabel();
             NotificationTools::GetInstance()->CancelNotification(subNotificationLabel, subNotificationId);
         }
-        iter = continuousTaskInfosMap_.erase(iter);
-        RefreshTaskRecord();
+        continuousTaskInfosMap_.erase(iter);
+        RefreshTaskRecord(taskKey);
     }
     HandleAppContinuousTaskStop(uid);
 }
@@ -2324,7 +2575,7 @@ ErrCode BgContinuousTaskMgr::AddSubscriberInner(const std::shared_ptr<Subscriber
     if (subscriberIter != bgTaskSubscribers_.end()) {
         BGTASK_LOGW("target subscriber already exist");
         if ((*subscriberIter)->isHap_) {
-            (*subscriberIter)->flag_ = (*subscriberIter)->flag_ |= subscriberInfo->flag_;
+            bgTaskSubscribers_.UpdateFlag(subscriberIter, (*subscriberIter)->flag_ | subscriberInfo->flag_);
             BGTASK_LOGW("update subscriber success, current flag: %{public}d", (*subscriberIter)->flag_);
         }
         return ERR_BGTASK_OBJECT_EXISTS;
@@ -2368,7 +2619,7 @@ ErrCode BgContinuousTaskMgr::RemoveSubscriberInner(const sptr<IBackgroundTaskSub
         return ERR_BGTASK_INVALID_PARAM;
     }
     if ((*subscriberIter)->isHap_) {
-        (*subscriberIter)->flag_ = (*subscriberIter)->flag_ & ~flag;
+        bgTaskSubscribers_.UpdateFlag(subscriberIter, (*subscriberIter)->flag_ & ~flag);
         BGTASK_LOGW("remove subscriber success, current flag: %{public}d", (*subscriberIter)->flag_);
         if ((*subscriberIter)->flag_ > 0) {
             BGTASK_LOGD("application uid: %{public}d have callback function.", (*subscriberIter)->uid_);
@@ -2379,6 +2630,8 @@ ErrCode BgContinuousTaskMgr::RemoveSubscriberInner(const sptr<IBackgroundTaskSub
         remote->RemoveDeathRecipient(susriberDeathRecipient_);
     }
     bgTaskSubscribers_.erase(subscriberIter);
+    DelayedSingleton<SubscriberDeliveryQueue>::GetInstance()->RemoveSubscriber(
+        DeliveryModule::CONTINUOUS_TASK, remote);
     BGTASK_LOGI("Remove continuous task subscriber succeed");
     return ERR_OK;
 }
@@ -2391,13 +2644,38 @@ ErrCode BgContinuousTaskMgr::GetContinuousTaskApps(std::vector<std::shared_ptr<C
         return ERR_BGTASK_SYS_NOT_READY;
     }
 
-    ErrCode result = ERR_OK;
-
-    handler_->PostSyncTask([this, &list, uid, &result]() {
-        result = this->GetContinuousTaskAppsInner(list, uid);
+    auto snapshot = GetValidSnapshot();
+    if (snapshot != nullptr) {
+        snapshot->GetApps(uid, false, list);
+        return ERR_OK;
+    }
+    handler_->PostSyncTask([this, &list, uid]() {
+        this->PublishSnapshot()->GetApps(uid, false, list);
         }, AppExecFwk::EventQueue::Priority::HIGH);
 
-    return result;
+    return ERR_OK;
+}
+
+std::shared_ptr<const ContinuousTaskSnapshot> BgContinuousTaskMgr::GetValidSnapshot()
+{
+    auto snapshot = std::atomic_load(&snapshot_);
+    if (snapshot == nullptr || snapshot->GetVersion() != continuousTaskInfosMap_.GetVersion()) {
+        return nullptr;
+    }
+    return snapshot;
+}
+
+std::shared_ptr<const ContinuousTaskSnapshot> BgContinuousTaskMgr::PublishSnapshot()
+{
+    // 仅在 handler 线程调用，记录表未变化时复用已发布的快照
+    uint64_t version = continuousTaskInfosMap_.GetVersion();
+    auto snapshot = std::atomic_load(&snapshot_);
+    if (snapshot != nullptr && snapshot->GetVersion() == version) {
+        return snapshot;
+    }
+    snapshot = std::make_shared<const ContinuousTaskSnapshot>(continuousTaskInfosMap_, version);
+    std::atomic_store(&snapshot_, snapshot);
+    return snapshot;
 }
 
 ErrCode BgContinuousTaskMgr::GetContinuousTaskAppsInner(std::vector<std::shared_ptr<ContinuousTaskCallbackInfo>> &list,
@@ -2407,21 +2685,20 @@ ErrCode BgContinuousTaskMgr::GetContinuousTaskAppsInner(std::vector<std::shared_
         return ERR_OK;
     }
 
-    for (auto record : continuousTaskInfosMap_) {
-        if (uid != -1 && uid != record.second->uid_) {
-            continue;
+    auto appendAppInfo = [&list, includeSuspended](const std::shared_ptr<ContinuousTaskRecord> &record) {
+        if (record->suspendState_ && !includeSuspended) {
+            return;
         }
-        if (record.second->suspendState_ && !includeSuspended) {
-            continue;
+        list.push_back(ContinuousTaskSnapshot::MakeAppInfo(record));
+    };
+    if (uid == -1) {
+        for (const auto &record : continuousTaskInfosMap_) {
+            appendAppInfo(record.second);
         }
-        auto appInfo = std::make_shared<ContinuousTaskCallbackInfo>(record.second->bgModeId_, record.second->uid_,
-            record.second->pid_, record.second->abilityName_, record.second->isFromWebview_, record.second->isBatchApi_,
-            record.second->bgModeIds_, record.second->abilityId_, record.second->fullTokenId_);
-        appInfo->SetContinuousTaskId(record.second->continuousTaskId_);
-        appInfo->SetByRequestObject(record.second->isByRequestObject_);
-        appInfo->SetSuspendState(record.second->suspendState_);
-        appInfo->SetSuspendReason(record.second->suspendReason_);
-        list.push_back(appInfo);
+        return ERR_OK;
+    }
+    for (const auto &key : continuousTaskInfosMap_.GetKeysByUid(uid)) {
+        appendAppInfo(continuousTaskInfosMap_.at(key));
     }
     return ERR_OK;
 }
@@ -2465,11 +2742,7 @@ ErrCode BgContinuousTaskMgr::AVSessionNotifyUpdateNotificationInner(int32_t uid,
     if (isPublish) {
         RemoveAudioPlaybackDelayTask(uid);
     }
-    auto findUid = [uid](const auto &target) {
-        return uid == target.second->GetUid();
-    };
-    auto findUidIter = find_if(continuousTaskInfosMap_.begin(), continuousTaskInfosMap_.end(), findUid);
-    if (findUidIter == continuousTaskInfosMap_.end()) {
+    if (!continuousTaskInfosMap_.HasUid(uid)) {
         RemoveAudioPlaybackDelayTask(uid);
         return ERR_BGTASK_OBJECT_NOT_EXIST;
     }
@@ -2496,7 +2769,7 @@ ErrCode BgContinuousTaskMgr::AVSessionNotifyUpdateNotificationInner(int32_t uid,
     if (!isPublish && record->bgModeIds_.size() == 1 && record->bgModeIds_[0] == BackgroundMode::AUDIO_PLAYBACK) {
         BGTASK_LOGI("avsession not exist, send continuousTask notification uid: %{public}d", uid);
         result = SendContinuousTaskNotification(record);
-        RefreshTaskRecord();
+        RefreshTaskRecord(findUidIter->first);
         RemoveAudioPlaybackDelayTask(uid);
         return result;
     }
@@ -2512,7 +2785,7 @@ ErrCode BgContinuousTaskMgr::AVSessionNotifyUpdateNotificationInner(int32_t uid,
             newPromptInfos.emplace(record->notificationLabel_, std::make_pair(mainAbilityLabel, notificationText));
             NotificationTools::GetInstance()->RefreshContinuousNotifications(newPromptInfos, bgTaskUid_);
         }
-        RefreshTaskRecord();
+        RefreshTaskRecord(findUidIter->first);
     }
     RemoveAudioPlaybackDelayTask(uid);
     return result;
@@ -2564,48 +2837,44 @@ void BgContinuousTaskMgr::SendAudioCallBackTaskState(const std::shared_ptr<Conti
     continuousTaskCallbackInfo->SetBundleName(continuousTaskInfo->bundleName_);
     continuousTaskCallbackInfo->SetUserId(continuousTaskInfo->userId_);
     continuousTaskCallbackInfo->SetAppIndex(continuousTaskInfo->appIndex_);
-    const ContinuousTaskCallbackInfo& taskCallbackInfoRef = *continuousTaskCallbackInfo;
-    for (auto iter = bgTaskSubscribers_.begin(); iter != bgTaskSubscribers_.end(); ++iter) {
-        if ((*iter)->isHap_ && (*iter)->subscriber_) {
-            if (((*iter)->flag_ & SUBSCRIBER_BACKGROUND_TASK_STATE) > 0) {
-                (*iter)->subscriber_->OnContinuousTaskStop(taskCallbackInfoRef);
-            }
-        }
+    auto onStop = [continuousTaskCallbackInfo](const sptr<IBackgroundTaskSubscriber> &subscriber) {
+        subscriber->OnContinuousTaskStop(*continuousTaskCallbackInfo);
+    };
+    for (const auto &subscriberInfo : bgTaskSubscribers_.GetStateSubscribers()) {
+        DeliverToSubscriber(subscriberInfo->subscriber_, onStop);
     }
 }
 
 void BgContinuousTaskMgr::HandleSuspendContinuousAudioTask(int32_t uid)
 {
-    auto iter = continuousTaskInfosMap_.begin();
-    while (iter != continuousTaskInfosMap_.end()) {
-        if (iter->second->GetUid() == uid &&
-            CommonUtils::CheckExistMode(iter->second->bgModeIds_, BackgroundMode::AUDIO_PLAYBACK)) {
-            iter->second->audioDetectState_ = false;
-            NotificationTools::GetInstance()->CancelNotification(iter->second->GetNotificationLabel(),
-                iter->second->GetNotificationId());
-            if (!IsExistCallback(uid, CONTINUOUS_TASK_SUSPEND)) {
-                SendAudioCallBackTaskState(iter->second);
-                iter++;
-                continue;
-            }
-            if (iter->second->GetSuspendAudioTaskTimes() == 0) {
-                iter->second->suspendState_ = true;
-                iter->second->suspendAudioTaskTimes_ = 1;
-                iter->second->suspendReason_ =
-                    static_cast<int32_t>(ContinuousTaskSuspendReason::SYSTEM_SUSPEND_AUDIO_PLAYBACK_NOT_RUNNING);
-                OnContinuousTaskChanged(iter->second, ContinuousTaskEventTriggerType::TASK_SUSPEND);
-                RefreshTaskRecord();
-                iter++;
-            } else {
-                iter->second->reason_ = FREEZE_CANCEL;
-                iter->second->detailedCancelReason_ =
-                    static_cast<int32_t>(ContinuousTaskCancelReason::SYSTEM_CANCEL_AUDIO_PLAYBACK_NOT_RUNNING);
-                OnContinuousTaskChanged(iter->second, ContinuousTaskEventTriggerType::TASK_CANCEL);
-                iter = continuousTaskInfosMap_.erase(iter);
-                RefreshTaskRecord();
-            }
+    BatchOperationScope batchScope(*this);
+    for (const auto &taskKey : continuousTaskInfosMap_.GetKeysByUid(uid)) {
+        auto iter = continuousTaskInfosMap_.find(taskKey);
+        if (iter == continuousTaskInfosMap_.end() ||
+            !CommonUtils::CheckExistMode(iter->second->bgModeIds_, BackgroundMode::AUDIO_PLAYBACK)) {
+            continue;
+        }
+        iter->second->audioDetectState_ = false;
+        NotificationTools::GetInstance()->CancelNotification(iter->second->GetNotificationLabel(),
+            iter->second->GetNotificationId());
+        if (!IsExistCallback(uid, CONTINUOUS_TASK_SUSPEND)) {
+            SendAudioCallBackTaskState(iter->second);
+            continue;
+        }
+        if (iter->second->GetSuspendAudioTaskTimes() == 0) {
+            iter->second->suspendState_ = true;
+            iter->second->suspendAudioTaskTimes_ = 1;
+            iter->second->suspendReason_ =
+                static_cast<int32_t>(ContinuousTaskSuspendReason::SYSTEM_SUSPEND_AUDIO_PLAYBACK_NOT_RUNNING);
+            OnContinuousTaskChanged(iter->second, ContinuousTaskEventTriggerType::TASK_SUSPEND);
+            RefreshTaskRecord(taskKey);
         } else {
-            iter++;
+            iter->second->reason_ = FREEZE_CANCEL;
+            iter->second->detailedCancelReason_ =
+                static_cast<int32_t>(ContinuousTaskCancelReason::SYSTEM_CANCEL_AUDIO_PLAYBACK_NOT_RUNNING);
+            OnContinuousTaskChanged(iter->second, ContinuousTaskEventTriggerType::TASK_CANCEL);
+            continuousTaskInfosMap_.erase(iter);
+            RefreshTaskRecord(taskKey);
         }
     }
     HandleAppContinuousTaskStop(uid);
@@ -2642,6 +2911,12 @@ ErrCode BgContinuousTaskMgr::ShellDumpInner(const std::vector<std::string> &dump
         BgContinuousTaskDumper::GetInstance()->DumpGetTask(dumpOption, dumpInfo);
     } else if (dumpOption[1] == DUMP_INNER_TASK) {
         BgContinuousTaskDumper::GetInstance()->DebugContinuousTask(dumpOption, dumpInfo);
+    } else if (dumpOption[1] == DUMP_PARAM_PERSISTENCE) {
+        DelayedSingleton<DataStorageHelper>::GetInstance()->DumpPersistenceData(dumpInfo);
+    } else if (dumpOption[1] == DUMP_PARAM_PROGRESS) {
+        progressCoalescer_.ShellDump(dumpInfo);
+    } else if (dumpOption[1] == DUMP_PARAM_NOTIFICATION) {
+        NotificationTools::GetInstance()->ShellDump(dumpInfo);
     } else {
         BGTASK_LOGW("invalid dump param");
     }
@@ -2793,9 +3068,10 @@ bool BgContinuousTaskMgr::StopContinuousTaskByUserInner(const std::string &key,
                 NotificationTools::GetInstance()->CancelNotification(
                     record->subNotificationLabel_, record->subNotificationId_);
             }
+            std::string taskInfoMapKey = iter->first;
             iter = continuousTaskInfosMap_.erase(iter);
             HandleAppContinuousTaskStop(record->uid_);
-            RefreshTaskRecord();
+            RefreshTaskRecord(taskInfoMapKey);
         }
     }
     return true;
@@ -2860,6 +3136,8 @@ void BgContinuousTaskMgr::OnRemoteSubscriberDiedInner(const wptr<IRemoteObject>
             iter++;
         }
     }
+    DelayedSingleton<SubscriberDeliveryQueue>::GetInstance()->RemoveSubscriber(
+        DeliveryModule::CONTINUOUS_TASK, objectProxy);
     BGTASK_LOGI("continuous subscriber die, list size is %{public}d", static_cast<int>(bgTaskSubscribers_.size()));
 }
 
@@ -2882,29 +3160,29 @@ void BgContinuousTaskMgr::OnAppStopped(int32_t uid)
         BGTASK_LOGW("manager is not ready");
         return;
     }
-    auto iter = continuousTaskInfosMap_.begin();
-    while (iter != continuousTaskInfosMap_.end()) {
-        if (iter->second->uid_ == uid) {
-            auto record = iter->second;
-            BGTASK_LOGI("OnAppStopped uid: %{public}d, bundleName: %{public}s abilityName: %{public}s"
-                "bgModeId: %{public}d, abilityId: %{public}d", uid, record->bundleName_.c_str(),
-                record->abilityName_.c_str(), record->bgModeId_, record->abilityId_);
-            record->reason_ = SYSTEM_CANCEL;
-            OnContinuousTaskChanged(record, ContinuousTaskEventTriggerType::TASK_CANCEL);
-            if (record->GetNotificationId() != -1) {
-                NotificationTools::GetInstance()->CancelNotification(
-                    record->GetNotificationLabel(), record->GetNotificationId());
-            }
-            if (record->subNotificationId_ != -1 && record->isByRequestObject_) {
-                NotificationTools::GetInstance()->CancelNotification(
-                    record->subNotificationLabel_, record->subNotificationId_);
-            }
-            iter = continuousTaskInfosMap_.erase(iter);
-            HandleAppContinuousTaskStop(record->uid_);
-            RefreshTaskRecord();
-        } else {
-            iter++;
+    BatchOperationScope batchScope(*this);
+    for (const auto &taskKey : continuousTaskInfosMap_.GetKeysByUid(uid)) {
+        auto iter = continuousTaskInfosMap_.find(taskKey);
+        if (iter == continuousTaskInfosMap_.end()) {
+            continue;
+        }
+        auto record = iter->second;
+        BGTASK_LOGI("OnAppStopped uid: %{public}d, bundleName: %{public}s abilityName: %{public}s"
+            "bgModeId: %{public}d, abilityId: %{public}d", uid, record->bundleName_.c_str(),
+            record->abilityName_.c_str(), record->bgModeId_, record->abilityId_);
+        record->reason_ = SYSTEM_CANCEL;
+        OnContinuousTaskChanged(record, ContinuousTaskEventTriggerType::TASK_CANCEL);
+        if (record->GetNotificationId() != -1) {
+            NotificationTools::GetInstance()->CancelNotification(
+                record->GetNotificationLabel(), record->GetNotificationId());
         }
+        if (record->subNotificationId_ != -1 && record->isByRequestObject_) {
+            NotificationTools::GetInstance()->CancelNotification(
+                record->subNotificationLabel_, record->subNotificationId_);
+        }
+        continuousTaskInfosMap_.erase(iter);
+        HandleAppContinuousTaskStop(record->uid_);
+        RefreshTaskRecord(taskKey);
     }
     std::string stopBundleName;
     int32_t stopAppIndex;
@@ -2952,11 +3230,8 @@ void BgContinuousTaskMgr::OnAppStateChanged(int32_t uid, int32_t state, int32_t
         return;
     }
     std::vector<uint32_t> appliedModeIds {};
-    for (const auto &task : continuousTaskInfosMap_) {
-        if (!task.second || task.second->GetUid() != uid) {
-            continue;
-        }
-        std::vector<uint32_t> bgModeIds = task.second->bgModeIds_;
+    for (const auto &key : continuousTaskInfosMap_.GetKeysByUid(uid)) {
+        const std::vector<uint32_t> &bgModeIds = continuousTaskInfosMap_.at(key)->bgModeIds_;
         for (const auto &mode : bgModeIds) {
             if (!std::count(appliedModeIds.begin(), appliedModeIds.end(), mode)) {
                 appliedModeIds.push_back(mode);
@@ -2970,11 +3245,8 @@ void BgContinuousTaskMgr::OnAppStateChanged(int32_t uid, int32_t state, int32_t
 
 uint32_t BgContinuousTaskMgr::GetModeNumByTypeIds(const std::vector<uint32_t> &typeIds)
 {
-    uint32_t modeNum = 0;
-    for (auto mode : typeIds) {
-        modeNum |= (1 << (mode - 1));
-    }
-    return modeNum;
+    // 模式 id 从1开始，上报位图第0位对应模式1
+    return static_cast<uint32_t>(BgModeSet(typeIds).GetBits() >> 1);
 }
 
 bool BgContinuousTaskMgr::CanNotifyHap(const std::shared_ptr<SubscriberInfo> subscriberInfo,
@@ -3025,16 +3297,15 @@ void BgContinuousTaskMgr::NotifySubscribersTaskStart(
     const std::shared_ptr<ContinuousTaskCallbackInfo> &continuousTaskCallbackInfo)
 {
     BackgroundTaskObserver::GetInstance().OnContinuousTaskStart(continuousTaskCallbackInfo);
-    const ContinuousTaskCallbackInfo& taskCallbackInfoRef = *continuousTaskCallbackInfo;
-    for (auto iter = bgTaskSubscribers_.begin(); iter != bgTaskSubscribers_.end(); ++iter) {
-        BGTASK_LOGD("continuous task start callback trigger");
-        if (!(*iter)->isHap_ && (*iter)->subscriber_) {
-            (*iter)->subscriber_->OnContinuousTaskStart(taskCallbackInfoRef);
-        } else if ((*iter)->isHap_ && (*iter)->subscriber_) {
-            if (((*iter)->flag_ & SUBSCRIBER_BACKGROUND_TASK_STATE) > 0) {
-                (*iter)->subscriber_->OnContinuousTaskStart(taskCallbackInfoRef);
-            }
-        }
+    BGTASK_LOGD("continuous task start callback trigger");
+    auto onStart = [continuousTaskCallbackInfo](const sptr<IBackgroundTaskSubscriber> &subscriber) {
+        subscriber->OnContinuousTaskStart(*continuousTaskCallbackInfo);
+    };
+    for (const auto &subscriberInfo : bgTaskSubscribers_.GetSaSubscribers()) {
+        DeliverToSubscriber(subscriberInfo->subscriber_, onStart);
+    }
+    for (const auto &subscriberInfo : bgTaskSubscribers_.GetStateSubscribers()) {
+        DeliverToSubscriber(subscriberInfo->subscriber_, onStart);
     }
 }
 
@@ -3042,16 +3313,17 @@ void BgContinuousTaskMgr::NotifySubscribersTaskUpdate(
     const std::shared_ptr<ContinuousTaskCallbackInfo> &continuousTaskCallbackInfo)
 {
     BackgroundTaskObserver::GetInstance().OnContinuousTaskUpdate(continuousTaskCallbackInfo);
-    const ContinuousTaskCallbackInfo& taskCallbackInfoRef = *continuousTaskCallbackInfo;
-    for (auto iter = bgTaskSubscribers_.begin(); iter != bgTaskSubscribers_.end(); ++iter) {
-        BGTASK_LOGD("continuous task update callback trigger");
-        if (!(*iter)->isHap_ && (*iter)->subscriber_) {
-            (*iter)->subscriber_->OnContinuousTaskUpdate(taskCallbackInfoRef);
-        } else if ((*iter)->isHap_ && (*iter)->subscriber_) {
-            if (((*iter)->flag_ & SUBSCRIBER_BACKGROUND_TASK_STATE) > 0) {
-                (*iter)->subscriber_->OnContinuousTaskUpdate(taskCallbackInfoRef);
-            }
-        }
+    BGTASK_LOGD("continuous task update callback trigger");
+    auto onUpdate = [continuousTaskCallbackInfo](const sptr<IBackgroundTaskSubscriber> &subscriber) {
+        subscriber->OnContinuousTaskUpdate(*continuousTaskCallbackInfo);
+    };
+    // 同一任务的更新回调只需送达最新状态，队列超限时可合并
+    std::string coalesceKey = "update_" + std::to_string(continuousTaskCallbackInfo->GetContinuousTaskId());
+    for (const auto &subscriberInfo : bgTaskSubscribers_.GetSaSubscribers()) {
+        DeliverToSubscriber(subscriberInfo->subscriber_, onUpdate, coalesceKey);
+    }
+    for (const auto &subscriberInfo : bgTaskSubscribers_.GetStateSubscribers()) {
+        DeliverToSubscriber(subscriberInfo->subscriber_, onUpdate, coalesceKey);
     }
 }
 
@@ -3059,17 +3331,23 @@ void BgContinuousTaskMgr::NotifySubscribersTaskCancel(
     const std::shared_ptr<ContinuousTaskCallbackInfo> &continuousTaskCallbackInfo)
 {
     BackgroundTaskObserver::GetInstance().OnContinuousTaskStop(continuousTaskCallbackInfo);
-    ContinuousTaskCallbackInfo& taskCallbackInfoRef = *continuousTaskCallbackInfo;
-    for (auto iter = bgTaskSubscribers_.begin(); iter != bgTaskSubscribers_.end(); ++iter) {
-        BGTASK_LOGD("continuous task stop callback trigger");
-        if (!(*iter)->isHap_ && (*iter)->subscriber_) {
-            // notify all sa
-            (*iter)->subscriber_->OnContinuousTaskStop(taskCallbackInfoRef);
-        } else if ((*iter)->isHap_ && (*iter)->subscriber_) {
-            if (CanNotifyHap(*iter, continuousTaskCallbackInfo) ||
-                (((*iter)->flag_ & SUBSCRIBER_BACKGROUND_TASK_STATE) > 0)) {
-                (*iter)->subscriber_->OnContinuousTaskStop(taskCallbackInfoRef);
-            }
+    BGTASK_LOGD("continuous task stop callback trigger");
+    auto onStop = [continuousTaskCallbackInfo](const sptr<IBackgroundTaskSubscriber> &subscriber) {
+        subscriber->OnContinuousTaskStop(*continuousTaskCallbackInfo);
+    };
+    // notify all sa
+    for (const auto &subscriberInfo : bgTaskSubscribers_.GetSaSubscribers()) {
+        DeliverToSubscriber(subscriberInfo->subscriber_, onStop);
+    }
+    for (const auto &subscriberInfo : bgTaskSubscribers_.GetStateSubscribers()) {
+        DeliverToSubscriber(subscriberInfo->subscriber_, onStop);
+    }
+    // 未订阅全量状态的应用只接收自身任务的取消回调
+    int32_t creatorUid = continuousTaskCallbackInfo->GetCreatorUid();
+    for (const auto &subscriberInfo : bgTaskSubscribers_.GetHapSubscribers(creatorUid)) {
+        if ((subscriberInfo->flag_ & SUBSCRIBER_BACKGROUND_TASK_STATE) == 0 &&
+            CanNotifyHap(subscriberInfo, continuousTaskCallbackInfo)) {
+            DeliverToSubscriber(subscriberInfo->subscriber_, onStop);
         }
     }
 }
@@ -3082,25 +3360,31 @@ void BgContinuousTaskMgr::NotifySubscribersTaskSuspend(
         BackgroundTaskObserver::GetInstance().OnContinuousTaskStop(continuousTaskCallbackInfo);
     }
     const ContinuousTaskCallbackInfo& taskCallbackInfoRef = *continuousTaskCallbackInfo;
-    for (auto iter = bgTaskSubscribers_.begin(); iter != bgTaskSubscribers_.end(); ++iter) {
-        if (!(*iter)->isHap_ && (*iter)->subscriber_ && isNotStandby) {
-            // 对SA来说，长时任务暂停状态等同于取消长时任务，保持原有逻辑；功耗检测失败不回调SA
-            BGTASK_LOGD("continuous task suspend callback trigger");
-            (*iter)->subscriber_->OnContinuousTaskStop(taskCallbackInfoRef);
-        } else if ((*iter)->isHap_ && (*iter)->subscriber_) {
-            // 回调所有注册的subscriber
-            if ((((*iter)->flag_ & SUBSCRIBER_BACKGROUND_TASK_STATE) > 0) && isNotStandby) {
-                (*iter)->subscriber_->OnContinuousTaskStop(taskCallbackInfoRef);
-            }
-            if ((*iter)->uid_ == continuousTaskCallbackInfo->GetCreatorUid()) {
-                // 回调通知应用长时任务暂停
-                BGTASK_LOGI("uid %{public}d is hap and uid is same, need notify suspend, suspendReason: %{public}d"
-                    "suspendState: %{public}d", (*iter)->uid_, taskCallbackInfoRef.GetSuspendReason(),
-                    taskCallbackInfoRef.GetSuspendState());
-                (*iter)->subscriber_->OnContinuousTaskSuspend(taskCallbackInfoRef);
-            }
+    if (isNotStandby) {
+        // 对SA来说，长时任务暂停状态等同于取消长时任务，保持原有逻辑；功耗检测失败不回调SA
+        BGTASK_LOGD("continuous task suspend callback trigger");
+        auto onStop = [continuousTaskCallbackInfo](const sptr<IBackgroundTaskSubscriber> &subscriber) {
+            subscriber->OnContinuousTaskStop(*continuousTaskCallbackInfo);
+        };
+        for (const auto &subscriberInfo : bgTaskSubscribers_.GetSaSubscribers()) {
+            DeliverToSubscriber(subscriberInfo->subscriber_, onStop);
+        }
+        // 回调所有注册的subscriber
+        for (const auto &subscriberInfo : bgTaskSubscribers_.GetStateSubscribers()) {
+            DeliverToSubscriber(subscriberInfo->subscriber_, onStop);
         }
     }
+    auto onSuspend = [continuousTaskCallbackInfo](const sptr<IBackgroundTaskSubscriber> &subscriber) {
+        subscriber->OnContinuousTaskSuspend(*continuousTaskCallbackInfo);
+    };
+    int32_t creatorUid = continuousTaskCallbackInfo->GetCreatorUid();
+    for (const auto &subscriberInfo : bgTaskSubscribers_.GetHapSubscribers(creatorUid)) {
+        // 回调通知应用长时任务暂停
+        BGTASK_LOGI("uid %{public}d is hap and uid is same, need notify suspend, suspendReason: %{public}d"
+            "suspendState: %{public}d", subscriberInfo->uid_, taskCallbackInfoRef.GetSuspendReason(),
+            taskCallbackInfoRef.GetSuspendState());
+        DeliverToSubscriber(subscriberInfo->subscriber_, onSuspend);
+    }
 }
 
 void BgContinuousTaskMgr::NotifySubscribersTaskActive(
@@ -3110,23 +3394,28 @@ void BgContinuousTaskMgr::NotifySubscribersTaskActive(
     if (isNotStandby) {
         BackgroundTaskObserver::GetInstance().OnContinuousTaskStart(continuousTaskCallbackInfo);
     }
-    const ContinuousTaskCallbackInfo& taskCallbackInfoRef = *continuousTaskCallbackInfo;
-    for (auto iter = bgTaskSubscribers_.begin(); iter != bgTaskSubscribers_.end(); ++iter) {
-        BGTASK_LOGD("continuous task active callback trigger");
-        if (!(*iter)->isHap_ && (*iter)->subscriber_ && isNotStandby) {
-            // 对SA来说，长时任务激活状态等同于注册长时任务，保持原有逻辑；功耗激活不回调SA
-            (*iter)->subscriber_->OnContinuousTaskStart(taskCallbackInfoRef);
-        } else if ((*iter)->isHap_ && (*iter)->subscriber_) {
-            // 回调所有注册的subscriber
-            if ((((*iter)->flag_ & SUBSCRIBER_BACKGROUND_TASK_STATE) > 0) && isNotStandby) {
-                (*iter)->subscriber_->OnContinuousTaskStart(taskCallbackInfoRef);
-            }
-            if ((*iter)->uid_ == continuousTaskCallbackInfo->GetCreatorUid()) {
-                // 回调通知应用长时任务激活
-                BGTASK_LOGI("uid %{public}d is hap and uid is same, need notify active", (*iter)->uid_);
-                (*iter)->subscriber_->OnContinuousTaskActive(taskCallbackInfoRef);
-            }
+    BGTASK_LOGD("continuous task active callback trigger");
+    if (isNotStandby) {
+        // 对SA来说，长时任务激活状态等同于注册长时任务，保持原有逻辑；功耗激活不回调SA
+        auto onStart = [continuousTaskCallbackInfo](const sptr<IBackgroundTaskSubscriber> &subscriber) {
+            subscriber->OnContinuousTaskStart(*continuousTaskCallbackInfo);
+        };
+        for (const auto &subscriberInfo : bgTaskSubscribers_.GetSaSubscribers()) {
+            DeliverToSubscriber(subscriberInfo->subscriber_, onStart);
         }
+        // 回调所有注册的subscriber
+        for (const auto &subscriberInfo : bgTaskSubscribers_.GetStateSubscribers()) {
+            DeliverToSubscriber(subscriberInfo->subscriber_, onStart);
+        }
+    }
+    auto onActive = [continuousTaskCallbackInfo](const sptr<IBackgroundTaskSubscriber> &subscriber) {
+        subscriber->OnContinuousTaskActive(*continuousTaskCallbackInfo);
+    };
+    int32_t creatorUid = continuousTaskCallbackInfo->GetCreatorUid();
+    for (const auto &subscriberInfo : bgTaskSubscribers_.GetHapSubscribers(creatorUid)) {
+        // 回调通知应用长时任务激活
+        BGTASK_LOGI("uid %{public}d is hap and uid is same, need notify active", subscriberInfo->uid_);
+        DeliverToSubscriber(subscriberInfo->subscriber_, onActive);
     }
 }
 
@@ -3163,6 +3452,8 @@ void BgContinuousTaskMgr::OnContinuousTaskChanged(const std::shared_ptr<Continuo
         BGTASK_LOGW("ContinuousTaskRecord is null");
         return;
     }
+    // 记录状态已变化，使查询快照失效
+    continuousTaskInfosMap_.Touch();
 
     std::shared_ptr<ContinuousTaskCallbackInfo> continuousTaskCallbackInfo
         = std::make_shared<ContinuousTaskCallbackInfo>(continuousTaskInfo->GetBgModeId(),
@@ -3220,10 +3511,10 @@ void BgContinuousTaskMgr::OnBundleInfoChanged(const std::string &action, const s
         }
     } else if (action == EventFwk::CommonEventSupport::COMMON_EVENT_PACKAGE_DATA_CLEARED) {
         cachedBundleInfos_.erase(uid);
-        auto iter = continuousTaskInfosMap_.begin();
-        while (iter != continuousTaskInfosMap_.end()) {
-            if (iter->second == nullptr || iter->second->GetUid() != uid) {
-                iter++;
+        BatchOperationScope batchScope(*this);
+        for (const auto &taskKey : continuousTaskInfosMap_.GetKeysByUid(uid)) {
+            auto iter = continuousTaskInfosMap_.find(taskKey);
+            if (iter == continuousTaskInfosMap_.end()) {
                 continue;
             }
             auto record = iter->second;
@@ -3231,9 +3522,9 @@ void BgContinuousTaskMgr::OnBundleInfoChanged(const std::string &action, const s
             OnContinuousTaskChanged(record, ContinuousTaskEventTriggerType::TASK_CANCEL);
             NotificationTools::GetInstance()->CancelNotification(
                 record->GetNotificationLabel(), record->GetNotificationId());
-            iter = continuousTaskInfosMap_.erase(iter);
+            continuousTaskInfosMap_.erase(iter);
             HandleAppContinuousTaskStop(uid);
-            RefreshTaskRecord();
+            RefreshTaskRecord(taskKey);
         }
     } else {
         BGTASK_LOGW("get unregister common event!");
@@ -3258,6 +3549,7 @@ void BgContinuousTaskMgr::OnAccountsStateChanged(int32_t id)
 
 void BgContinuousTaskMgr::ClearBgOsAccountTask(const std::vector<int32_t> &activatedOsAccountIds)
 {
+    BatchOperationScope batchScope(*this);
 #ifdef HAS_OS_ACCOUNT_CAR
     ClearBgOsAccountTaskInCar();
 #else // HAS_OS_ACCOUNT_CAR
@@ -3270,9 +3562,10 @@ void BgContinuousTaskMgr::ClearBgOsAccountTask(const std::vector<int32_t> &activ
             OnContinuousTaskChanged(record, ContinuousTaskEventTriggerType::TASK_CANCEL);
             NotificationTools::GetInstance()->CancelNotification(
                 record->GetNotificationLabel(), record->GetNotificationId());
+            std::string taskInfoMapKey = iter->first;
             iter = continuousTaskInfosMap_.erase(iter);
             HandleAppContinuousTaskStop(record->uid_);
-            RefreshTaskRecord();
+            RefreshTaskRecord(taskInfoMapKey);
         } else {
             iter++;
         }
@@ -3304,9 +3597,10 @@ void BgContinuousTaskMgr::ClearBgOsAccountTaskInCar()
             OnContinuousTaskChanged(record, ContinuousTaskEventTriggerType::TASK_CANCEL);
             NotificationTools::GetInstance()->CancelNotification(
                 record->GetNotificationLabel(), record->GetNotificationId());
+            std::string taskInfoMapKey = iter->first;
             iter = continuousTaskInfosMap_.erase(iter);
             HandleAppContinuousTaskStop(record->uid_);
-            RefreshTaskRecord();
+            RefreshTaskRecord(taskInfoMapKey);
             BGTASK_LOGI("uid:%{public}d not in foreground OsAccounts, clear", record->uid_);
         } else {
             iter++;
@@ -3317,24 +3611,31 @@ void BgContinuousTaskMgr::ClearBgOsAccountTaskInCar()
 
 void BgContinuousTaskMgr::HandleAppContinuousTaskStop(int32_t uid)
 {
-    auto findUid = [uid](const auto &target) {
-        return uid == target.second->GetUid();
-    };
-    auto findUidIter = find_if(continuousTaskInfosMap_.begin(), continuousTaskInfosMap_.end(), findUid);
-    if (findUidIter != continuousTaskInfosMap_.end()) {
+    if (batchDepth_ > 0) {
+        batchStoppedUids_.insert(uid);
+        return;
+    }
+    if (continuousTaskInfosMap_.HasUid(uid)) {
         return;
     }
     BGTASK_LOGI("All continuous task has stopped of uid: %{public}d, so notify related subsystem", uid);
-    for (auto iter = bgTaskSubscribers_.begin(); iter != bgTaskSubscribers_.end(); iter++) {
-        if (!(*iter)->isHap_ && (*iter)->subscriber_) {
-            (*iter)->subscriber_->OnAppContinuousTaskStop(uid);
-        }
+    auto onAppStop = [uid](const sptr<IBackgroundTaskSubscriber> &subscriber) {
+        subscriber->OnAppContinuousTaskStop(uid);
+    };
+    for (const auto &subscriberInfo : bgTaskSubscribers_.GetSaSubscribers()) {
+        DeliverToSubscriber(subscriberInfo->subscriber_, onAppStop);
     }
 }
 
 int32_t BgContinuousTaskMgr::RefreshTaskRecord()
 {
-    int32_t ret = DelayedSingleton<DataStorageHelper>::GetInstance()->RefreshTaskRecord(continuousTaskInfosMap_);
+    continuousTaskInfosMap_.Touch();
+    if (batchDepth_ > 0) {
+        batchRecordDirty_ = true;
+        return ERR_OK;
+    }
+    int32_t ret = DelayedSingleton<DataStorageHelper>::GetInstance()->RefreshTaskRecord(
+        continuousTaskInfosMap_.GetRecords());
     if (ret != ERR_OK) {
         BGTASK_LOGE("refresh data failed");
         return ret;
@@ -3342,6 +3643,22 @@ int32_t BgContinuousTaskMgr::RefreshTaskRecord()
     return ERR_OK;
 }
 
+int32_t BgContinuousTaskMgr::RefreshTaskRecord(const std::string &taskInfoMapKey)
+{
+    continuousTaskInfosMap_.Touch();
+    if (batchDepth_ > 0) {
+        batchRecordDirty_ = true;
+        return ERR_OK;
+    }
+    int32_t ret = DelayedSingleton<DataStorageHelper>::GetInstance()->RefreshTaskRecord(taskInfoMapKey,
+        continuousTaskInfosMap_.GetRecords());
+    if (ret != ERR_OK) {
+        BGTASK_LOGE("refresh data failed, key: %{public}s", taskInfoMapKey.c_str());
+        return ret;
+    }
+    return ERR_OK;
+}
+
 std::string BgContinuousTaskMgr::GetMainAbilityLabel(const std::string &bundleName, int32_t userId)
 {
     BgTaskHiTraceChain traceChain(__func__);
@@ -3366,6 +3683,7 @@ std::string BgContinuousTaskMgr::GetNotificationText(const std::shared_ptr<Conti
 
 void BgContinuousTaskMgr::HandleRemoveTaskByMode(uint32_t mode)
 {
+    BatchOperationScope batchScope(*this);
     auto iter = continuousTaskInfosMap_.begin();
     while (iter != continuousTaskInfosMap_.end()) {
         auto record = iter->second;
@@ -3375,9 +3693,10 @@ void BgContinuousTaskMgr::HandleRemoveTaskByMode(uint32_t mode)
                 record->abilityName_.c_str(), mode, record->abilityId_);
             record->reason_ = SYSTEM_CANCEL;
             OnContinuousTaskChanged(record, ContinuousTaskEventTriggerType::TASK_CANCEL);
+            std::string taskInfoMapKey = iter->first;
             iter = continuousTaskInfosMap_.erase(iter);
             HandleAppContinuousTaskStop(record->uid_);
-            RefreshTaskRecord();
+            RefreshTaskRecord(taskInfoMapKey);
             auto result = CancelNotification(record);
             BGTASK_LOGI("Cancel notification, uid: %{public}d, result: %{public}d", record->uid_, result);
         } else {
@@ -3556,29 +3875,29 @@ ErrCode BgContinuousTaskMgr::SendLiveViewAndOtherNotification(std::shared_ptr<Co
     subRecord->continuousTaskId_ = record->continuousTaskId_;
     subRecord->isNewApi_ = record->isNewApi_;
     subRecord->isByRequestObject_ = true;
-    subRecord->bgModeIds_.clear();
     subRecord->bgModeId_ = BackgroundMode::DATA_TRANSFER;
-    subRecord->bgModeIds_.push_back(BackgroundMode::DATA_TRANSFER);
+    subRecord->SetBgModeIds({BackgroundMode::DATA_TRANSFER});
     ErrCode ret = SendNotification(subRecord, record, appName, false);
     if (ret != ERR_OK) {
         return ret;
     }
-    subRecord->bgModeIds_.clear();
+    subRecord->SetBgModeIds({});
     for (size_t index = 0; index < record->bgModeIds_.size(); index++) {
         uint32_t mode = record->bgModeIds_[index];
         if (mode == BackgroundMode::DATA_TRANSFER) {
             continue;
         }
-        subRecord->bgModeIds_.push_back(mode);
+        subRecord->AddBgModeId(mode);
         if (index < record->bgSubModeIds_.size()) {
             uint32_t subMode = record->bgSubModeIds_[index];
-            subRecord->bgSubModeIds_.push_back(subMode);
+            subRecord->AddBgSubModeId(subMode);
         }
     }
     subRecord->bgModeId_ = subRecord->bgModeIds_[0];
     ret = SendNotification(subRecord, record, appName, true);
     if (ret != ERR_OK) {
         if (record->GetNotificationId() != -1) {
+            record->ResetNotificationFingerprint();
             NotificationTools::GetInstance()->CancelNotification(record->GetNotificationLabel(),
                 record->GetNotificationId());
         }
@@ -3768,13 +4087,7 @@ ErrCode BgContinuousTaskMgr::RequestAuthFromUserInner(std::shared_ptr<Continuous
 bool BgContinuousTaskMgr::FormatBannerNotificationContext(const std::string &appName,
     std::string &bannerContent)
 {
-    AppExecFwk::BundleInfo bundleInfo;
-    if (!BundleManagerHelper::GetInstance()->GetBundleInfo(BG_TASK_RES_BUNDLE_NAME,
-        AppExecFwk::BundleFlag::GET_BUNDLE_WITH_ABILITIES, bundleInfo)) {
-        BGTASK_LOGE("get background task res: %{public}s bundle info failed", BG_TASK_RES_BUNDLE_NAME);
-        return false;
-    }
-    auto resourceManager = GetBundleResMgr(bundleInfo);
+    auto resourceManager = GetBgTaskResMgr();
     if (resourceManager == nullptr) {
         BGTASK_LOGE("Get bgtask resource hap manager failed");
         return false;
@@ -4130,8 +4443,11 @@ void BgContinuousTaskMgr::SetLiveViewInfo(int32_t uid, bool isLiveViewPublish, c
 
 bool BgContinuousTaskMgr::CheckLiveViewInfoModes(std::shared_ptr<ContinuousTaskRecord> record)
 {
-    if (CommonUtils::CheckExistMode(record->bgModeIds_, BackgroundMode::LOCATION) &&
-        !CommonUtils::CheckExistOtherMode(record->bgModeIds_, BackgroundMode::LOCATION, g_liveViewTypes)) {
+    const BgModeSet &modes = record->GetBgModeSet();
+    bool existOtherMode = modes.IsRepresentable() ?
+        CommonUtils::CheckExistOtherMode(modes, BackgroundMode::LOCATION, g_liveViewTypes) :
+        CommonUtils::CheckExistOtherMode(record->bgModeIds_, BackgroundMode::LOCATION, g_liveViewTypes);
+    if (modes.Contains(BackgroundMode::LOCATION) && !existOtherMode) {
         BGTASK_LOGD("continuous task has liveView");
         return true;
     }
@@ -4164,7 +4480,7 @@ void BgContinuousTaskMgr::CancelBgTaskNotificationInner(int32_t uid)
             NotificationTools::GetInstance()->CancelNotification(
                 task.second->GetNotificationLabel(), task.second->GetNotificationId());
             task.second->notificationId_ = -1;
-            RefreshTaskRecord();
+            RefreshTaskRecord(task.first);
             BGTASK_LOGI("uid: %{public}d has live view notification , cancel continuous notification", uid);
             continue;
         }
@@ -4192,7 +4508,7 @@ void BgContinuousTaskMgr::SendNotificationByLiveViewCancelInner(int32_t uid)
         if (task.second->GetNotificationId() == -1) {
             auto record = task.second;
             SendContinuousTaskNotification(record);
-            RefreshTaskRecord();
+            RefreshTaskRecord(task.first);
         }
     }
 }
@@ -4266,11 +4582,15 @@ ErrCode BgContinuousTaskMgr::GetAllContinuousTasksBySystem(std::vector<std::shar
         BGTASK_LOGW("manager is not ready");
         return ERR_BGTASK_SYS_NOT_READY;
     }
-    ErrCode ret = ERR_OK;
-    handler_->PostSyncTask([this, &list, &ret]() {
-        ret = this->GetAllContinuousTasksInner(-1, list, false, true);
+    auto snapshot = GetValidSnapshot();
+    if (snapshot != nullptr) {
+        snapshot->GetTasks(-1, false, true, list);
+        return ERR_OK;
+    }
+    handler_->PostSyncTask([this, &list]() {
+        this->PublishSnapshot()->GetTasks(-1, false, true, list);
         }, AppExecFwk::EventQueue::Priority::HIGH);
-    return ret;
+    return ERR_OK;
 }
 
 void BgContinuousTaskMgr::OnBundleResourcesChanged()
@@ -4290,17 +4610,17 @@ bool BgContinuousTaskMgr::InitSubNotificationRecord(const std::shared_ptr<Contin
         BGTASK_LOGE("record or subRecord is null.");
         return false;
     }
-    subRecord->bgModeIds_.clear();
-    subRecord->bgSubModeIds_.clear();
+    subRecord->SetBgModeIds({});
+    subRecord->SetBgSubModeIds({});
     for (size_t index = 0; index < record->bgModeIds_.size(); index++) {
         uint32_t mode = record->bgModeIds_[index];
         if (mode == BackgroundMode::DATA_TRANSFER) {
             continue;
         }
-        subRecord->bgModeIds_.push_back(mode);
+        subRecord->AddBgModeId(mode);
         if (index < record->bgSubModeIds_.size()) {
             uint32_t subMode = record->bgSubModeIds_[index];
-            subRecord->bgSubModeIds_.push_back(subMode);
+            subRecord->AddBgSubModeId(subMode);
         }
     }
     if (!subRecord->bgSubModeIds_.empty()) {
@@ -4317,6 +4637,8 @@ void BgContinuousTaskMgr::OnBundleResourcesChangedInner()
     auto iter = continuousTaskInfosMap_.begin();
     while (iter != continuousTaskInfosMap_.end()) {
         auto record = iter->second;
+        // 语言切换后通知内容整体刷新，原有内容指纹失效
+        record->ResetNotificationFingerprint();
         if (record->subNotificationId_ != -1 && record->subNotificationLabel_ != "") {
             // 长时任务存在子通知时（data_transfer+其他类型）
             std::shared_ptr<ContinuousTaskRecord> subRecord = std::make_shared<ContinuousTaskRecord>(*record);
@@ -4338,7 +4660,9 @@ void BgContinuousTaskMgr::OnBundleResourcesChangedInner()
         iter++;
     }
     NotificationTools::GetInstance()->RefreshContinuousNotifications(newPromptInfos, bgTaskUid_);
-    // 语言切换，刷新横幅通知
+    // 语言切换，刷新横幅通知，一次查询激活态通知后统一刷新
+    std::map<std::string, std::pair<std::string, std::string>> newBannerPromptInfos;
+    std::map<std::string, std::shared_ptr<BannerNotificationRecord>> bannerNotifications;
     for (const auto &iter : bannerNotificationRecord_) {
         std::string bannerNotificationText {""};
         std::string appName = GetMainAbilityLabel(iter.second->GetBundleName(), iter.second->GetUserId());
@@ -4352,10 +4676,12 @@ void BgContinuousTaskMgr::OnBundleResourcesChangedInner()
         BGTASK_LOGI("bannerNotificationLabel: %{public}s, mainAbilityLabel: %{public}s, "
             "notificationText: %{public}s,", bannerNotificationLabel.c_str(), appName.c_str(),
             bannerNotificationText.c_str());
-        std::map<std::string, std::pair<std::string, std::string>> newBannerPromptInfos;
         newBannerPromptInfos.emplace(bannerNotificationLabel, std::make_pair(appName, bannerNotificationText));
+        bannerNotifications.emplace(bannerNotificationLabel, iter.second);
+    }
+    if (!newBannerPromptInfos.empty()) {
         NotificationTools::GetInstance()->RefreshBannerNotifications(bannerNotificationBtn_, newBannerPromptInfos,
-            iter.second, bgTaskUid_);
+            bannerNotifications, bgTaskUid_);
     }
 }
 
@@ -4365,12 +4691,16 @@ ErrCode BgContinuousTaskMgr::GetAllContinuousTaskApps(std::vector<std::shared_pt
         BGTASK_LOGW("manager is not ready");
         return ERR_BGTASK_SYS_NOT_READY;
     }
-    ErrCode result = ERR_OK;
-    handler_->PostSyncTask([this, &list, &result]() {
-        result = this->GetContinuousTaskAppsInner(list, -1, true);
+    auto snapshot = GetValidSnapshot();
+    if (snapshot != nullptr) {
+        snapshot->GetApps(-1, true, list);
+        return ERR_OK;
+    }
+    handler_->PostSyncTask([this, &list]() {
+        this->PublishSnapshot()->GetApps(-1, true, list);
         }, AppExecFwk::EventQueue::Priority::HIGH);
 
-    return result;
+    return ERR_OK;
 }
 
 ErrCode BgContinuousTaskMgr::SendNotificationByDeteTask(const std::set<std::string> &taskKeys)
@@ -4523,6 +4853,7 @@ void BgContinuousTaskMgr::NotifyAudioStartInner(const int32_t uid)
         return;
     }
     std::map<std::string, std::pair<std::string, std::string>> newPromptInfos;
+    std::vector<std::string> changedKeys;
     for (const auto &task : continuousTaskInfosMap_) {
         if (!task.second) {
             continue;
@@ -4542,16 +4873,20 @@ void BgContinuousTaskMgr::NotifyAudioStartInner(const int32_t uid)
         }
         task.second->audioPlayState_ = true;
         newPromptInfos.emplace(task.second->notificationLabel_, std::make_pair(appName, notificationText));
+        changedKeys.emplace_back(task.first);
     }
     if (!newPromptInfos.empty()) {
         NotificationTools::GetInstance()->RefreshContinuousNotifications(newPromptInfos, bgTaskUid_);
-        RefreshTaskRecord();
+        for (const auto &key : changedKeys) {
+            RefreshTaskRecord(key);
+        }
     }
 }
 
 ErrCode BgContinuousTaskMgr::CancelNotification(const std::shared_ptr<ContinuousTaskRecord> continuousTaskInfo)
 {
     ErrCode result = ERR_OK;
+    continuousTaskInfo->ResetNotificationFingerprint();
     int32_t notificationId = continuousTaskInfo->GetNotificationId();
     if (notificationId != -1) {
         std::string notificationLabel = continuousTaskInfo->GetNotificationLabel();
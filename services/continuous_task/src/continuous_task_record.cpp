@@ -58,6 +58,7 @@ ContinuousTaskRecord::ContinuousTaskRecord(const std::string &bundleName, const
     } else {
         bgModeIds_.push_back(bgModeId);
     }
+    bgModeSet_ = BgModeSet(bgModeIds_);
 }
 
 std::string ContinuousTaskRecord::GetBundleName() const
@@ -186,9 +187,55 @@ bool ContinuousTaskRecord::IsFromComponent() const
     return isFromComponent_;
 }
 
+void ContinuousTaskRecord::ResetNotificationFingerprint()
+{
+    notificationFingerprint_ = 0;
+    subNotificationFingerprint_ = 0;
+}
+
+void ContinuousTaskRecord::SetBgModeIds(const std::vector<uint32_t> &bgModeIds)
+{
+    bgModeIds_ = bgModeIds;
+    bgModeSet_ = BgModeSet(bgModeIds_);
+}
+
+void ContinuousTaskRecord::AddBgModeId(uint32_t bgModeId)
+{
+    bgModeIds_.push_back(bgModeId);
+    bgModeSet_.Add(bgModeId);
+}
+
+void ContinuousTaskRecord::SetBgSubModeIds(const std::vector<uint32_t> &bgSubModeIds)
+{
+    bgSubModeIds_ = bgSubModeIds;
+    bgSubModeSet_ = BgModeSet(bgSubModeIds_);
+}
+
+void ContinuousTaskRecord::AddBgSubModeId(uint32_t bgSubModeId)
+{
+    bgSubModeIds_.push_back(bgSubModeId);
+    bgSubModeSet_.Add(bgSubModeId);
+}
+
+const BgModeSet &ContinuousTaskRecord::GetBgModeSet() const
+{
+    return bgModeSet_;
+}
+
+const BgModeSet &ContinuousTaskRecord::GetBgSubModeSet() const
+{
+    return bgSubModeSet_;
+}
+
 std::string ContinuousTaskRecord::ParseToJsonStr()
 {
     nlohmann::json root;
+    ParseToJson(root);
+    return root.dump(CommonUtils::jsonFormat_);
+}
+
+void ContinuousTaskRecord::ParseToJson(nlohmann::json &root)
+{
     root["bundleName"] = bundleName_;
     root["abilityName"] = abilityName_;
     root["userId"] = userId_;
@@ -224,14 +271,7 @@ std::string ContinuousTaskRecord::ParseToJsonStr()
     root["isStandby"] = isStandby_;
     root["audioPlayState"] = audioPlayState_;
     root["isStandbySuspend"] = isStandbySuspend_;
-    if (progressInfo_ != nullptr) {
-        nlohmann::json progressJson = nlohmann::json::parse(progressInfo_->ParseToJsonStr());
-        if (!progressJson.is_discarded()) {
-            root["progressInfo"] = progressJson;
-        }
-    }
     root["isFromComponent"] = isFromComponent_;
-    return root.dump(CommonUtils::jsonFormat_);
 }
 
 bool CheckContinuousRecod(const nlohmann::json &value)
@@ -282,13 +322,7 @@ bool ContinuousTaskRecord::ParseFromJson(const nlohmann::json &value)
     if (value.contains("notificationId") && value["notificationId"].is_number_integer()) {
         this->notificationId_ = value.at("notificationId").get<int32_t>();
     }
-    if (value.contains("progressInfo") && value["progressInfo"].is_object()) {
-        this->progressInfo_ = std::make_shared<ProgressInfo>();
-        if (!this->progressInfo_->ParseFromJson(value["progressInfo"])) {
-            BGTASK_LOGE("parse progressInfo from json failed");
-            this->progressInfo_ = nullptr;
-        }
-    }
+    // 进度为瞬时状态不持久化，旧版本文件中残留的 progressInfo 直接忽略
     return true;
 }
 
@@ -320,11 +354,11 @@ void ContinuousTaskRecord::SetRecordValue(const nlohmann::json &value)
     }
     if (value.contains("bgModeIds") && value["bgModeIds"].is_string()) {
         auto modes = value.at("bgModeIds").get<std::string>();
-        this->bgModeIds_ = ToVector(modes);
+        SetBgModeIds(ToVector(modes));
     }
     if (value.contains("bgSubModeIds") && value["bgSubModeIds"].is_string()) {
         auto subModes = value.at("bgSubModeIds").get<std::string>();
-        this->bgSubModeIds_ = ToVector(subModes);
+        SetBgSubModeIds(ToVector(subModes));
     }
     this->detailedCancelReason_ = value.at("detailedCancelReason").get<int32_t>();
     this->isStandby_ = value.at("isStandby").get<bool>();
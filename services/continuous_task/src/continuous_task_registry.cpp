@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "continuous_task_registry.h"
+
+namespace OHOS {
+namespace BackgroundTaskMgr {
+ContinuousTaskRegistry::iterator ContinuousTaskRegistry::begin()
+{
+    return records_.begin();
+}
+
+ContinuousTaskRegistry::iterator ContinuousTaskRegistry::end()
+{
+    return records_.end();
+}
+
+ContinuousTaskRegistry::const_iterator ContinuousTaskRegistry::begin() const
+{
+    return records_.begin();
+}
+
+ContinuousTaskRegistry::const_iterator ContinuousTaskRegistry::end() const
+{
+    return records_.end();
+}
+
+bool ContinuousTaskRegistry::empty() const
+{
+    return records_.empty();
+}
+
+size_t ContinuousTaskRegistry::size() const
+{
+    return records_.size();
+}
+
+ContinuousTaskRegistry::iterator ContinuousTaskRegistry::find(const std::string &key)
+{
+    return records_.find(key);
+}
+
+ContinuousTaskRegistry::const_iterator ContinuousTaskRegistry::find(const std::string &key) const
+{
+    return records_.find(key);
+}
+
+const std::shared_ptr<ContinuousTaskRecord> &ContinuousTaskRegistry::at(const std::string &key) const
+{
+    return records_.at(key);
+}
+
+std::shared_ptr<ContinuousTaskRecord> &ContinuousTaskRegistry::operator[](const std::string &key)
+{
+    // 返回的引用可能被直接赋值，索引延迟到下次查询时重建
+    indexDirty_ = true;
+    Touch();
+    return records_[key];
+}
+
+std::pair<ContinuousTaskRegistry::iterator, bool> ContinuousTaskRegistry::emplace(const std::string &key,
+    const std::shared_ptr<ContinuousTaskRecord> &record)
+{
+    auto result = records_.emplace(key, record);
+    if (!result.second) {
+        return result;
+    }
+    Touch();
+    if (!indexDirty_) {
+        AddIndex(key, record);
+    }
+    return result;
+}
+
+ContinuousTaskRegistry::iterator ContinuousTaskRegistry::erase(iterator iter)
+{
+    if (!indexDirty_) {
+        RemoveIndex(iter->first);
+    }
+    Touch();
+    return records_.erase(iter);
+}
+
+size_t ContinuousTaskRegistry::erase(const std::string &key)
+{
+    auto iter = records_.find(key);
+    if (iter == records_.end()) {
+        return 0;
+    }
+    erase(iter);
+    return 1;
+}
+
+void ContinuousTaskRegistry::clear()
+{
+    records_.clear();
+    indexedKeys_.clear();
+    uidIndex_.clear();
+    abilityIdIndex_.clear();
+    taskIdIndex_.clear();
+    indexDirty_ = false;
+    Touch();
+}
+
+ContinuousTaskRegistry::RecordMap &ContinuousTaskRegistry::GetMutableRecords()
+{
+    indexDirty_ = true;
+    Touch();
+    return records_;
+}
+
+const ContinuousTaskRegistry::RecordMap &ContinuousTaskRegistry::GetRecords() const
+{
+    return records_;
+}
+
+std::vector<std::string> ContinuousTaskRegistry::GetKeysByUid(int32_t uid)
+{
+    CheckAndRebuildIndex();
+    return CollectKeys(uidIndex_, uid);
+}
+
+std::vector<std::string> ContinuousTaskRegistry::GetKeysByAbilityId(int32_t abilityId)
+{
+    CheckAndRebuildIndex();
+    return CollectKeys(abilityIdIndex_, abilityId);
+}
+
+ContinuousTaskRegistry::iterator ContinuousTaskRegistry::FindByTaskId(int32_t continuousTaskId)
+{
+    CheckAndRebuildIndex();
+    auto iter = taskIdIndex_.find(continuousTaskId);
+    if (iter == taskIdIndex_.end()) {
+        return records_.end();
+    }
+    return records_.find(iter->second);
+}
+
+bool ContinuousTaskRegistry::HasUid(int32_t uid)
+{
+    CheckAndRebuildIndex();
+    return uidIndex_.find(uid) != uidIndex_.end();
+}
+
+uint64_t ContinuousTaskRegistry::GetVersion() const
+{
+    return version_.load(std::memory_order_acquire);
+}
+
+void ContinuousTaskRegistry::Touch()
+{
+    version_.fetch_add(1, std::memory_order_release);
+}
+
+void ContinuousTaskRegistry::AddIndex(const std::string &key, const std::shared_ptr<ContinuousTaskRecord> &record)
+{
+    if (!record) {
+        return;
+    }
+    IndexEntry entry;
+    entry.uid = record->GetUid();
+    entry.abilityId = record->GetAbilityId();
+    entry.continuousTaskId = record->GetContinuousTaskId();
+    indexedKeys_[key] = entry;
+    uidIndex_[entry.uid].insert(key);
+    abilityIdIndex_[entry.abilityId].insert(key);
+    taskIdIndex_[entry.continuousTaskId] = key;
+}
+
+void ContinuousTaskRegistry::RemoveIndex(const std::string &key)
+{
+    auto entryIter = indexedKeys_.find(key);
+    if (entryIter == indexedKeys_.end()) {
+        return;
+    }
+    const IndexEntry &entry = entryIter->second;
+    auto uidIter = uidIndex_.find(entry.uid);
+    if (uidIter != uidIndex_.end()) {
+        uidIter->second.erase(key);
+        if (uidIter->second.empty()) {
+            uidIndex_.erase(uidIter);
+        }
+    }
+    auto abilityIter = abilityIdIndex_.find(entry.abilityId);
+    if (abilityIter != abilityIdIndex_.end()) {
+        abilityIter->second.erase(key);
+        if (abilityIter->second.empty()) {
+            abilityIdIndex_.erase(abilityIter);
+        }
+    }
+    auto taskIter = taskIdIndex_.find(entry.continuousTaskId);
+    if (taskIter != taskIdIndex_.end() && taskIter->second == key) {
+        taskIdIndex_.erase(taskIter);
+    }
+    indexedKeys_.erase(entryIter);
+}
+
+void ContinuousTaskRegistry::CheckAndRebuildIndex()
+{
+    if (!indexDirty_) {
+        return;
+    }
+    indexedKeys_.clear();
+    uidIndex_.clear();
+    abilityIdIndex_.clear();
+    taskIdIndex_.clear();
+    for (const auto &record : records_) {
+        AddIndex(record.first, record.second);
+    }
+    indexDirty_ = false;
+}
+
+std::vector<std::string> ContinuousTaskRegistry::CollectKeys(
+    const std::unordered_map<int32_t, std::unordered_set<std::string>> &index, int32_t id)
+{
+    auto iter = index.find(id);
+    if (iter == index.end()) {
+        return {};
+    }
+    return std::vector<std::string>(iter->second.begin(), iter->second.end());
+}
+}  // namespace BackgroundTaskMgr
+}  // namespace OHOS
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "continuous_task_snapshot.h"
+
+namespace OHOS {
+namespace BackgroundTaskMgr {
+ContinuousTaskSnapshot::ContinuousTaskSnapshot(const ContinuousTaskRegistry &registry, uint64_t version)
+    : version_(version)
+{
+    entries_.reserve(registry.size());
+    for (const auto &item : registry) {
+        const auto &record = item.second;
+        if (record == nullptr) {
+            continue;
+        }
+        Entry entry;
+        entry.suspended_ = record->suspendState_;
+        entry.taskInfo_ = MakeTaskInfo(record);
+        entry.appInfo_ = MakeAppInfo(record);
+        uidIndex_[record->uid_].push_back(entries_.size());
+        allTasks_.push_back(entry.taskInfo_);
+        allApps_.push_back(entry.appInfo_);
+        if (!entry.suspended_) {
+            activeTasks_.push_back(entry.taskInfo_);
+            activeApps_.push_back(entry.appInfo_);
+        }
+        entries_.emplace_back(std::move(entry));
+    }
+}
+
+uint64_t ContinuousTaskSnapshot::GetVersion() const
+{
+    return version_;
+}
+
+size_t ContinuousTaskSnapshot::Size() const
+{
+    return entries_.size();
+}
+
+template<typename T>
+void ContinuousTaskSnapshot::AppendAll(const std::vector<std::shared_ptr<T>> &cached,
+    std::vector<std::shared_ptr<T>> &list)
+{
+    if (list.empty()) {
+        list = cached;
+        return;
+    }
+    list.insert(list.end(), cached.begin(), cached.end());
+}
+
+void ContinuousTaskSnapshot::GetTasks(int32_t uid, bool includeSuspended, bool exemptUid,
+    std::vector<std::shared_ptr<ContinuousTaskInfo>> &list) const
+{
+    if (exemptUid) {
+        AppendAll(includeSuspended ? allTasks_ : activeTasks_, list);
+        return;
+    }
+    auto iter = uidIndex_.find(uid);
+    if (iter == uidIndex_.end()) {
+        return;
+    }
+    for (auto index : iter->second) {
+        if (includeSuspended || !entries_[index].suspended_) {
+            list.push_back(entries_[index].taskInfo_);
+        }
+    }
+}
+
+void ContinuousTaskSnapshot::GetApps(int32_t uid, bool includeSuspended,
+    std::vector<std::shared_ptr<ContinuousTaskCallbackInfo>> &list) const
+{
+    if (uid == -1) {
+        AppendAll(includeSuspended ? allApps_ : activeApps_, list);
+        return;
+    }
+    auto iter = uidIndex_.find(uid);
+    if (iter == uidIndex_.end()) {
+        return;
+    }
+    for (auto index : iter->second) {
+        if (includeSuspended || !entries_[index].suspended_) {
+            list.push_back(entries_[index].appInfo_);
+        }
+    }
+}
+
+std::shared_ptr<ContinuousTaskInfo> ContinuousTaskSnapshot::MakeTaskInfo(
+    const std::shared_ptr<ContinuousTaskRecord> &record)
+{
+    std::string wantAgentBundleName {"NULL"};
+    std::string wantAgentAbilityName {"NULL"};
+    if (record->wantAgentInfo_ != nullptr) {
+        wantAgentBundleName = record->wantAgentInfo_->bundleName_;
+        wantAgentAbilityName = record->wantAgentInfo_->abilityName_;
+    }
+    auto info = std::make_shared<ContinuousTaskInfo>(record->abilityName_, record->uid_,
+        record->pid_, record->isFromWebview_, record->bgModeIds_, record->bgSubModeIds_,
+        record->notificationId_, record->continuousTaskId_, record->abilityId_,
+        wantAgentBundleName, wantAgentAbilityName);
+    info->SetBundleName(record->bundleName_);
+    info->SetAppIndex(record->appIndex_);
+    info->SetByRequestObject(record->isByRequestObject_);
+    return info;
+}
+
+std::shared_ptr<ContinuousTaskCallbackInfo> ContinuousTaskSnapshot::MakeAppInfo(
+    const std::shared_ptr<ContinuousTaskRecord> &record)
+{
+    auto appInfo = std::make_shared<ContinuousTaskCallbackInfo>(record->bgModeId_, record->uid_,
+        record->pid_, record->abilityName_, record->isFromWebview_, record->isBatchApi_,
+        record->bgModeIds_, record->abilityId_, record->fullTokenId_);
+    appInfo->SetContinuousTaskId(record->continuousTaskId_);
+    appInfo->SetByRequestObject(record->isByRequestObject_);
+    appInfo->SetSuspendState(record->suspendState_);
+    appInfo->SetSuspendReason(record->suspendReason_);
+    return appInfo;
+}
+}  // namespace BackgroundTaskMgr
+}  // namespace OHOS
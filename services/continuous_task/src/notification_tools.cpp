@@ -50,6 +50,9 @@ static constexpr uint32_t SOUND_FLAG = 1 << 0;
 static constexpr uint32_t VIBRATION_FLAG = 1 << 4;
 static constexpr int32_t MIN_PROGRESS_VALUE = 0;
 static constexpr int32_t MAX_PROGRESS_VALUE = 100;
+static constexpr uint64_t FINGERPRINT_HASH_MAGIC = 0x9e3779b97f4a7c15ULL;
+static constexpr uint32_t FINGERPRINT_LEFT_SHIFT = 6;
+static constexpr uint32_t FINGERPRINT_RIGHT_SHIFT = 2;
 #endif
 }
 
@@ -63,6 +66,77 @@ void NotificationTools::SetNotificationIdIndex(const int32_t id)
     notificationIdIndex_ = id;
 }
 
+WEAK_FUNC void NotificationTools::BeginBatchOperation()
+{
+    std::lock_guard<std::mutex> lock(batchMutex_);
+    batchDepth_++;
+}
+
+WEAK_FUNC void NotificationTools::EndBatchOperation()
+{
+    std::set<std::pair<std::string, int32_t>> pendingCancels;
+    {
+        std::lock_guard<std::mutex> lock(batchMutex_);
+        if (batchDepth_ <= 0 || --batchDepth_ > 0) {
+            return;
+        }
+        pendingCancels.swap(pendingCancels_);
+    }
+    FlushPendingCancels(pendingCancels);
+}
+
+bool NotificationTools::DeferCancelNotification(const std::string &label, int32_t id)
+{
+    std::lock_guard<std::mutex> lock(batchMutex_);
+    if (batchDepth_ <= 0) {
+        return false;
+    }
+    pendingCancels_.emplace(label, id);
+    return true;
+}
+
+void NotificationTools::DropPendingCancel(const std::string &label, int32_t id)
+{
+    std::lock_guard<std::mutex> lock(batchMutex_);
+    if (batchDepth_ > 0) {
+        // 批量期间先取消后重新发布同一通知，以发布为准
+        pendingCancels_.erase(std::make_pair(label, id));
+    }
+}
+
+void NotificationTools::FlushPendingCancels(std::set<std::pair<std::string, int32_t>> &pendingCancels)
+{
+#ifdef DISTRIBUTED_NOTIFICATION_ENABLE
+    if (pendingCancels.empty()) {
+        return;
+    }
+    // ANS 未提供按 label 批量取消的接口，此处仅对去重后的取消请求逐条下发
+    for (const auto &item : pendingCancels) {
+        if (Notification::NotificationHelper::CancelNotification(item.first, item.second) != ERR_OK) {
+            BGTASK_LOGE("CancelNotification error label %{public}s, id %{public}d", item.first.c_str(), item.second);
+        }
+    }
+    BGTASK_LOGI("flush batch cancel notification, size: %{public}zu", pendingCancels.size());
+#endif
+}
+
+bool NotificationTools::SkipUnchangedNotification(uint64_t lastFingerprint, uint64_t fingerprint)
+{
+    if (lastFingerprint == 0 || lastFingerprint != fingerprint) {
+        return false;
+    }
+    skippedCount_++;
+    return true;
+}
+
+WEAK_FUNC void NotificationTools::ShellDump(std::vector<std::string> &dumpInfo)
+{
+    std::stringstream stream;
+    stream << "notification publish, published: " << publishedCount_.load() << ", skipped: "
+        << skippedCount_.load() << "\n";
+    dumpInfo.emplace_back(stream.str());
+}
+
 std::string CreateNotificationLabel(int32_t uid, const std::string &abilityName, int32_t abilityId,
     bool isByRequestObject, const int32_t continuousTaskId)
 {
@@ -164,6 +238,48 @@ static void SetNotificationSlotType(const std::shared_ptr<ContinuousTaskRecord>
         notificationRequest.SetTapDismissed(false);
     }
 }
+
+static void CombineFingerprint(uint64_t &fingerprint, size_t value)
+{
+    fingerprint ^= static_cast<uint64_t>(value) + FINGERPRINT_HASH_MAGIC + (fingerprint << FINGERPRINT_LEFT_SHIFT) +
+        (fingerprint >> FINGERPRINT_RIGHT_SHIFT);
+}
+
+// 通知内容指纹，覆盖标签、id、槽位、文本、模式、wantAgent 跳转目标及进度信息
+static uint64_t CreateNotificationFingerprint(const Notification::NotificationRequest &notificationRequest,
+    const std::string &appName, const std::string &prompt, const std::vector<uint32_t> &bgModeIds,
+    const std::shared_ptr<WantAgentInfo> &wantAgentInfo, const std::shared_ptr<ProgressInfo> &progressInfo)
+{
+    uint64_t fingerprint = 0;
+    CombineFingerprint(fingerprint, std::hash<std::string>()(notificationRequest.GetLabel()));
+    CombineFingerprint(fingerprint, std::hash<int32_t>()(notificationRequest.GetNotificationId()));
+    CombineFingerprint(fingerprint, std::hash<int32_t>()(static_cast<int32_t>(notificationRequest.GetSlotType())));
+    CombineFingerprint(fingerprint, std::hash<int32_t>()(notificationRequest.GetCreatorUid()));
+    CombineFingerprint(fingerprint, std::hash<int32_t>()(notificationRequest.GetOwnerUid()));
+    CombineFingerprint(fingerprint, std::hash<std::string>()(appName));
+    CombineFingerprint(fingerprint, std::hash<std::string>()(prompt));
+    for (uint32_t bgModeId : bgModeIds) {
+        CombineFingerprint(fingerprint, std::hash<uint32_t>()(bgModeId));
+    }
+    if (wantAgentInfo != nullptr) {
+        CombineFingerprint(fingerprint, std::hash<std::string>()(wantAgentInfo->bundleName_));
+        CombineFingerprint(fingerprint, std::hash<std::string>()(wantAgentInfo->abilityName_));
+    }
+    if (progressInfo != nullptr) {
+        CombineFingerprint(fingerprint, std::hash<std::string>()(progressInfo->GetTitle()));
+        CombineFingerprint(fingerprint, std::hash<std::string>()(progressInfo->GetFileName()));
+        CombineFingerprint(fingerprint, std::hash<int32_t>()(progressInfo->GetProgressValue()));
+        CombineFingerprint(fingerprint, std::hash<bool>()(progressInfo->IsMute()));
+    }
+    // 0 表示未发布
+    return fingerprint == 0 ? 1 : fingerprint;
+}
+
+static bool IsSameNotificationContent(const std::shared_ptr<Notification::NotificationBasicContent> &normalContent,
+    const std::pair<std::string, std::string> &promptInfo)
+{
+    return normalContent->GetTitle() == promptInfo.first && normalContent->GetText() == promptInfo.second;
+}
 #endif
 
 WEAK_FUNC ErrCode NotificationTools::PublishNotification(
@@ -203,11 +319,22 @@ WEAK_FUNC ErrCode NotificationTools::PublishNotification(
     } else {
         notificationRequest.SetNotificationId(continuousTaskRecord->GetNotificationId());
     }
+    DropPendingCancel(notificationLabel, notificationRequest.GetNotificationId());
+    uint64_t fingerprint = CreateNotificationFingerprint(notificationRequest, appName, prompt,
+        continuousTaskRecord->bgModeIds_, continuousTaskRecord->wantAgentInfo_,
+        continuousTaskRecord->GetProgressInfo());
+    // 数据传输通知已由进度合并器限频，且需周期刷新以免 ANS 判定实况通知过期，不做跳过
+    if (!isDataTransfer && continuousTaskRecord->GetNotificationId() != -1 &&
+        SkipUnchangedNotification(continuousTaskRecord->notificationFingerprint_, fingerprint)) {
+        return ERR_OK;
+    }
     if (Notification::NotificationHelper::PublishNotification(notificationRequest) != ERR_OK) {
         BGTASK_LOGE("publish notification error, %{public}s, %{public}d", notificationLabel.c_str(),
             continuousTaskRecord->notificationId_);
         return ERR_BGTASK_NOTIFICATION_ERR;
     }
+    publishedCount_++;
+    continuousTaskRecord->notificationFingerprint_ = fingerprint;
     continuousTaskRecord->notificationLabel_ = notificationLabel;
     if (continuousTaskRecord->GetNotificationId() == -1) {
         continuousTaskRecord->notificationId_ = notificationIdIndex_;
@@ -219,6 +346,12 @@ WEAK_FUNC ErrCode NotificationTools::PublishNotification(
 WEAK_FUNC ErrCode NotificationTools::CancelNotification(const std::string &label, int32_t id)
 {
 #ifdef DISTRIBUTED_NOTIFICATION_ENABLE
+    if (label.empty() && id == -1) {
+        return ERR_OK;
+    }
+    if (DeferCancelNotification(label, id)) {
+        return ERR_OK;
+    }
     if (Notification::NotificationHelper::CancelNotification(label, id) != ERR_OK) {
         BGTASK_LOGE("CancelNotification error label %{public}s, id %{public}d", label.c_str(), id);
         return ERR_BGTASK_NOTIFICATION_ERR;
@@ -262,7 +395,14 @@ WEAK_FUNC void NotificationTools::RefreshContinuousNotifications(
             continue;
         }
         auto &content = var->GetContent();
+        if (!content || !content->GetNotificationContent()) {
+            continue;
+        }
         auto const &normalContent = content->GetNotificationContent();
+        // 内容未变化时不重复发布，避免通知中心无效刷新
+        if (IsSameNotificationContent(normalContent, newPromptInfos.at(label))) {
+            continue;
+        }
         normalContent->SetTitle(newPromptInfos.at(label).first);
         normalContent->SetText(newPromptInfos.at(label).second);
         if (Notification::NotificationHelper::PublishContinuousTaskNotification(*var) != ERR_OK) {
@@ -277,6 +417,8 @@ WEAK_FUNC ErrCode NotificationTools::RefreshContinuousNotificationWantAndContext
     const std::shared_ptr<ContinuousTaskRecord> continuousTaskRecord, bool updateContent)
 {
 #ifdef DISTRIBUTED_NOTIFICATION_ENABLE
+    // 直接修改已发布的通知，原有内容指纹失效
+    continuousTaskRecord->ResetNotificationFingerprint();
     std::vector<sptr<Notification::NotificationRequest>> notificationRequests;
     ErrCode ret = Notification::NotificationHelper::GetActiveNotifications(notificationRequests);
     if (ret != ERR_OK) {
@@ -368,11 +510,21 @@ WEAK_FUNC ErrCode NotificationTools::PublishMainNotification(const std::shared_p
     } else {
         notificationRequest.SetNotificationId(mainRecord->GetNotificationId());
     }
+    DropPendingCancel(notificationLabel, notificationRequest.GetNotificationId());
+    uint64_t fingerprint = CreateNotificationFingerprint(notificationRequest, appName, prompt,
+        subRecord->bgModeIds_, subRecord->wantAgentInfo_, mainRecord->progressInfo_);
+    // 携带进度的数据传输通知同样不做跳过
+    if (mainRecord->progressInfo_ == nullptr && mainRecord->GetNotificationId() != -1 &&
+        SkipUnchangedNotification(mainRecord->notificationFingerprint_, fingerprint)) {
+        return ERR_OK;
+    }
     if (Notification::NotificationHelper::PublishNotification(notificationRequest) != ERR_OK) {
         BGTASK_LOGE("publish notification error, %{public}s, %{public}d", notificationLabel.c_str(),
             mainRecord->notificationId_);
         return ERR_BGTASK_NOTIFICATION_ERR;
     }
+    publishedCount_++;
+    mainRecord->notificationFingerprint_ = fingerprint;
     mainRecord->notificationLabel_ = notificationLabel;
     if (mainRecord->GetNotificationId() == -1) {
         mainRecord->notificationId_ = notificationIdIndex_;
@@ -424,11 +576,20 @@ WEAK_FUNC ErrCode NotificationTools::PublishSubNotification(const std::shared_pt
     } else {
         notificationRequest.SetNotificationId(mainRecord->GetSubNotificationId());
     }
+    DropPendingCancel(notificationLabel, notificationRequest.GetNotificationId());
+    uint64_t fingerprint = CreateNotificationFingerprint(notificationRequest, appName, prompt,
+        subRecord->bgModeIds_, subRecord->wantAgentInfo_, nullptr);
+    if (mainRecord->GetSubNotificationId() != -1 &&
+        SkipUnchangedNotification(mainRecord->subNotificationFingerprint_, fingerprint)) {
+        return ERR_OK;
+    }
     if (Notification::NotificationHelper::PublishNotification(notificationRequest) != ERR_OK) {
         BGTASK_LOGE("publish notification error, %{public}s, %{public}d", notificationLabel.c_str(),
             notificationIdIndex_);
         return ERR_BGTASK_NOTIFICATION_ERR;
     }
+    publishedCount_++;
+    mainRecord->subNotificationFingerprint_ = fingerprint;
     mainRecord->subNotificationLabel_ = notificationLabel;
     if (mainRecord->GetSubNotificationId() == -1) {
         mainRecord->subNotificationId_ = notificationIdIndex_;
@@ -479,6 +640,25 @@ static bool SetActionButton(const std::shared_ptr<BannerNotificationRecord> &ban
     notificationRequest.AddActionButton(actionButtonDeal);
     return true;
 }
+
+static bool IsSameBannerNotification(const Notification::NotificationRequest &request,
+    const std::shared_ptr<Notification::NotificationBasicContent> &normalContent,
+    const std::pair<std::string, std::string> &promptInfo, const std::vector<std::string> &bannerNotificationBtn)
+{
+    if (!IsSameNotificationContent(normalContent, promptInfo)) {
+        return false;
+    }
+    auto actionButtons = request.GetActionButtons();
+    if (actionButtons.size() != static_cast<size_t>(BGTASK_BANNER_NOTIFICATION_BTN_ALLOW_ALLOWED + 1)) {
+        return false;
+    }
+    for (size_t index = 0; index < actionButtons.size(); index++) {
+        if (!actionButtons[index] || actionButtons[index]->GetTitle() != bannerNotificationBtn.at(index)) {
+            return false;
+        }
+    }
+    return true;
+}
 #endif
 
 WEAK_FUNC std::string NotificationTools::CreateBannerNotificationLabel(const std::string &bundleName, int32_t userId,
@@ -549,6 +729,17 @@ WEAK_FUNC ErrCode NotificationTools::PublishBannerNotification(
 WEAK_FUNC void NotificationTools::RefreshBannerNotifications(const std::vector<std::string> &bannerNotificationBtn,
     const std::map<std::string, std::pair<std::string, std::string>> &newPromptInfos,
     const std::shared_ptr<BannerNotificationRecord> bannerNotification, int32_t serviceUid)
+{
+    std::map<std::string, std::shared_ptr<BannerNotificationRecord>> bannerNotifications;
+    for (const auto &promptInfo : newPromptInfos) {
+        bannerNotifications.emplace(promptInfo.first, bannerNotification);
+    }
+    RefreshBannerNotifications(bannerNotificationBtn, newPromptInfos, bannerNotifications, serviceUid);
+}
+
+WEAK_FUNC void NotificationTools::RefreshBannerNotifications(const std::vector<std::string> &bannerNotificationBtn,
+    const std::map<std::string, std::pair<std::string, std::string>> &newPromptInfos,
+    const std::map<std::string, std::shared_ptr<BannerNotificationRecord>> &bannerNotifications, int32_t serviceUid)
 {
     if (bannerNotificationBtn.size() <= BGTASK_BANNER_NOTIFICATION_BTN_ALLOW_ALLOWED) {
         BGTASK_LOGE("bannerNotificationBtn index fail.");
@@ -562,23 +753,30 @@ WEAK_FUNC void NotificationTools::RefreshBannerNotifications(const std::vector<s
         return;
     }
     for (Notification::NotificationRequest *var : notificationRequests) {
+        // 单条横幅异常时跳过，不影响其余横幅刷新
         if (!var) {
             BGTASK_LOGE("NotificationRequest is null!");
-            return;
+            continue;
         }
         std::string label = var->GetLabel();
-        if (newPromptInfos.count(label) == 0 || var->GetCreatorUid() != serviceUid) {
+        auto bannerIter = bannerNotifications.find(label);
+        if (newPromptInfos.count(label) == 0 || bannerIter == bannerNotifications.end() ||
+            var->GetCreatorUid() != serviceUid) {
             continue;
         }
+        const auto &bannerNotification = bannerIter->second;
         auto &content = var->GetContent();
         if (!content) {
-            BGTASK_LOGE("content is null!");
-            return;
+            BGTASK_LOGE("content is null, label: %{public}s", label.c_str());
+            continue;
         }
         auto const &normalContent = content->GetNotificationContent();
         if (!normalContent) {
-            BGTASK_LOGE("normalContent is null!");
-            return;
+            BGTASK_LOGE("normalContent is null, label: %{public}s", label.c_str());
+            continue;
+        }
+        if (IsSameBannerNotification(*var, normalContent, newPromptInfos.at(label), bannerNotificationBtn)) {
+            continue;
         }
         normalContent->SetTitle(newPromptInfos.at(label).first);
         normalContent->SetText(newPromptInfos.at(label).second);
@@ -586,15 +784,17 @@ WEAK_FUNC void NotificationTools::RefreshBannerNotifications(const std::vector<s
         std::string allowTimeBtnName = bannerNotificationBtn.at(BGTASK_BANNER_NOTIFICATION_BTN_ALLOW_TIME);
         if (!SetActionButton(bannerNotification, allowTimeBtnName, *var,
             BGTASK_BANNER_NOTIFICATION_BTN_ALLOW_TIME, label)) {
-            return;
+            BGTASK_LOGE("set allow time button fail, label: %{public}s", label.c_str());
+            continue;
         }
         std::string allowAllowed = bannerNotificationBtn.at(BGTASK_BANNER_NOTIFICATION_BTN_ALLOW_ALLOWED);
         if (!SetActionButton(bannerNotification, allowAllowed, *var,
             BGTASK_BANNER_NOTIFICATION_BTN_ALLOW_ALLOWED, label)) {
-            return;
+            BGTASK_LOGE("set allow allowed button fail, label: %{public}s", label.c_str());
+            continue;
         }
         if (Notification::NotificationHelper::PublishNotification(*var) != ERR_OK) {
-            BGTASK_LOGE("refresh notification error");
+            BGTASK_LOGE("refresh notification error, label: %{public}s", label.c_str());
         }
     }
 #endif
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "progress_coalescer.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+
+#include <parameters.h>
+
+#include "time_provider.h"
+
+namespace OHOS {
+namespace BackgroundTaskMgr {
+namespace {
+// 两次进度通知的最小间隔，单位毫秒
+static constexpr int32_t PROGRESS_MIN_INTERVAL_DEFAULT = 1000;
+// 进度值变化小于该值时不重新发布通知
+static constexpr int32_t PROGRESS_SIGNIFICANT_DELTA_DEFAULT = 1;
+static constexpr int32_t PROGRESS_COMPLETE_VALUE = 100;
+// 发布失败后的最小重试间隔，单位 ms，每次重试翻倍
+static constexpr int64_t PROGRESS_RETRY_INTERVAL = 1000;
+static constexpr int32_t PROGRESS_MAX_RETRY_TIMES = 3;
+static constexpr char PROGRESS_MIN_INTERVAL_PARAM[] = "persist.sys.bgtask_progress_interval";
+static constexpr char PROGRESS_SIGNIFICANT_DELTA_PARAM[] = "persist.sys.bgtask_progress_delta";
+}
+
+ProgressCoalescer::ProgressCoalescer()
+{
+    minInterval_ = std::max(OHOS::system::GetIntParameter(PROGRESS_MIN_INTERVAL_PARAM,
+        PROGRESS_MIN_INTERVAL_DEFAULT), 0);
+    significantDelta_ = std::max(OHOS::system::GetIntParameter(PROGRESS_SIGNIFICANT_DELTA_PARAM,
+        PROGRESS_SIGNIFICANT_DELTA_DEFAULT), 1);
+}
+
+bool ProgressCoalescer::OnProgressUpdate(int32_t taskId,
+    const std::shared_ptr<ProgressInfo> &progressInfo, bool isChanged, int64_t &delayTime)
+{
+    delayTime = -1;
+    auto iter = states_.find(taskId);
+    if (iter == states_.end()) {
+        states_.emplace(taskId, ProgressState());
+        return true;
+    }
+    auto &state = iter->second;
+    if (!isChanged && !IsSignificant(state, progressInfo)) {
+        // 已有待发布的更新时，延迟发布会带上最新值
+        if (state.pending_) {
+            mergedCount_++;
+            return false;
+        }
+        if (progressInfo == nullptr || progressInfo->GetProgressValue() == state.lastValue_) {
+            droppedCount_++;
+            return false;
+        }
+        // 变化不明显的更新不立即发布，但可能是最后一次更新，间隔后无论变化大小都补发
+        state.pending_ = true;
+        mergedCount_++;
+        if (!state.flushScheduled_) {
+            state.flushScheduled_ = true;
+            delayTime = minInterval_;
+        }
+        return false;
+    }
+    int64_t elapsed = TimeProvider::GetCurrentTime(ClockType::CLOCK_TYPE_MONOTONIC) - state.lastPublishTime_;
+    if (!state.pending_ && elapsed >= minInterval_) {
+        return true;
+    }
+    state.pending_ = true;
+    mergedCount_++;
+    if (!state.flushScheduled_) {
+        state.flushScheduled_ = true;
+        delayTime = std::max(minInterval_ - elapsed, static_cast<int64_t>(0));
+    }
+    return false;
+}
+
+void ProgressCoalescer::OnPublished(int32_t taskId, const std::shared_ptr<ProgressInfo> &progressInfo)
+{
+    auto &state = states_[taskId];
+    state.lastPublishTime_ = TimeProvider::GetCurrentTime(ClockType::CLOCK_TYPE_MONOTONIC);
+    state.pending_ = false;
+    state.retryTimes_ = 0;
+    if (progressInfo != nullptr) {
+        state.lastValue_ = progressInfo->GetProgressValue();
+        state.lastTitle_ = progressInfo->GetTitle();
+        state.lastFileName_ = progressInfo->GetFileName();
+        state.lastMute_ = progressInfo->IsMute();
+    }
+    publishedCount_++;
+}
+
+bool ProgressCoalescer::TakePending(int32_t taskId)
+{
+    auto iter = states_.find(taskId);
+    if (iter == states_.end()) {
+        return false;
+    }
+    iter->second.flushScheduled_ = false;
+    if (!iter->second.pending_) {
+        return false;
+    }
+    iter->second.pending_ = false;
+    return true;
+}
+
+void ProgressCoalescer::OnPublishFailed(int32_t taskId, int64_t &delayTime)
+{
+    delayTime = -1;
+    auto iter = states_.find(taskId);
+    if (iter == states_.end()) {
+        return;
+    }
+    auto &state = iter->second;
+    if (state.retryTimes_ >= PROGRESS_MAX_RETRY_TIMES) {
+        // 放弃本次更新，后续进度更新重新触发发布
+        failedCount_++;
+        state.retryTimes_ = 0;
+        return;
+    }
+    // 最新进度未送达，保留待发布状态并延迟重试，期间的新进度继续合并
+    state.pending_ = true;
+    if (!state.flushScheduled_) {
+        state.flushScheduled_ = true;
+        delayTime = std::max(minInterval_, PROGRESS_RETRY_INTERVAL) << state.retryTimes_;
+        state.retryTimes_++;
+    }
+}
+
+void ProgressCoalescer::RemoveTask(int32_t taskId)
+{
+    states_.erase(taskId);
+}
+
+void ProgressCoalescer::RemoveIf(const std::function<bool(int32_t)> &fun)
+{
+    for (auto iter = states_.begin(); iter != states_.end();) {
+        if (fun(iter->first)) {
+            iter = states_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+size_t ProgressCoalescer::Size() const
+{
+    return states_.size();
+}
+
+bool ProgressCoalescer::IsSignificant(const ProgressState &state,
+    const std::shared_ptr<ProgressInfo> &progressInfo) const
+{
+    if (progressInfo == nullptr) {
+        return false;
+    }
+    if (progressInfo->GetTitle() != state.lastTitle_ || progressInfo->GetFileName() != state.lastFileName_ ||
+        progressInfo->IsMute() != state.lastMute_) {
+        return true;
+    }
+    int32_t value = progressInfo->GetProgressValue();
+    if (value == PROGRESS_COMPLETE_VALUE && state.lastValue_ != PROGRESS_COMPLETE_VALUE) {
+        return true;
+    }
+    return std::abs(value - state.lastValue_) >= significantDelta_;
+}
+
+void ProgressCoalescer::ShellDump(std::vector<std::string> &dumpInfo)
+{
+    std::stringstream stream;
+    stream << "data transfer progress, tasks: " << states_.size() << ", interval: " << minInterval_
+        << "ms, delta: " << significantDelta_ << ", published: " << publishedCount_
+        << ", merged: " << mergedCount_ << ", dropped: " << droppedCount_ << ", failed: " << failedCount_ << "\n";
+    dumpInfo.emplace_back(stream.str());
+}
+}  // namespace BackgroundTaskMgr
+}  // namespace OHOS
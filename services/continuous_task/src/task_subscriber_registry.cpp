@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "task_subscriber_registry.h"
+
+#include "common_utils.h"
+
+namespace OHOS {
+namespace BackgroundTaskMgr {
+TaskSubscriberRegistry::iterator TaskSubscriberRegistry::begin()
+{
+    return subscribers_.begin();
+}
+
+TaskSubscriberRegistry::iterator TaskSubscriberRegistry::end()
+{
+    return subscribers_.end();
+}
+
+TaskSubscriberRegistry::const_iterator TaskSubscriberRegistry::begin() const
+{
+    return subscribers_.begin();
+}
+
+TaskSubscriberRegistry::const_iterator TaskSubscriberRegistry::end() const
+{
+    return subscribers_.end();
+}
+
+bool TaskSubscriberRegistry::empty() const
+{
+    return subscribers_.empty();
+}
+
+size_t TaskSubscriberRegistry::size() const
+{
+    return subscribers_.size();
+}
+
+void TaskSubscriberRegistry::emplace_back(const std::shared_ptr<SubscriberInfo> &subscriberInfo)
+{
+    subscribers_.emplace_back(subscriberInfo);
+    bucketDirty_ = true;
+}
+
+TaskSubscriberRegistry::iterator TaskSubscriberRegistry::erase(iterator iter)
+{
+    bucketDirty_ = true;
+    return subscribers_.erase(iter);
+}
+
+void TaskSubscriberRegistry::clear()
+{
+    subscribers_.clear();
+    bucketDirty_ = true;
+}
+
+void TaskSubscriberRegistry::UpdateFlag(iterator iter, uint32_t flag)
+{
+    if ((*iter)->flag_ == flag) {
+        return;
+    }
+    (*iter)->flag_ = flag;
+    bucketDirty_ = true;
+}
+
+const TaskSubscriberRegistry::SubscriberBucket &TaskSubscriberRegistry::GetSaSubscribers()
+{
+    CheckAndRebuildBuckets();
+    return saSubscribers_;
+}
+
+const TaskSubscriberRegistry::SubscriberBucket &TaskSubscriberRegistry::GetStateSubscribers()
+{
+    CheckAndRebuildBuckets();
+    return stateSubscribers_;
+}
+
+const TaskSubscriberRegistry::SubscriberBucket &TaskSubscriberRegistry::GetHapSubscribers(int32_t uid)
+{
+    static const SubscriberBucket emptyBucket {};
+    CheckAndRebuildBuckets();
+    auto iter = hapSubscribers_.find(uid);
+    if (iter == hapSubscribers_.end()) {
+        return emptyBucket;
+    }
+    return iter->second;
+}
+
+bool TaskSubscriberRegistry::HasHapSubscriber(int32_t uid, uint32_t flag)
+{
+    for (const auto &subscriberInfo : GetHapSubscribers(uid)) {
+        if ((subscriberInfo->flag_ & flag) > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void TaskSubscriberRegistry::CheckAndRebuildBuckets()
+{
+    if (!bucketDirty_) {
+        return;
+    }
+    saSubscribers_.clear();
+    stateSubscribers_.clear();
+    hapSubscribers_.clear();
+    for (const auto &subscriberInfo : subscribers_) {
+        if (!subscriberInfo || !subscriberInfo->subscriber_) {
+            continue;
+        }
+        if (!subscriberInfo->isHap_) {
+            saSubscribers_.emplace_back(subscriberInfo);
+            continue;
+        }
+        if ((subscriberInfo->flag_ & SUBSCRIBER_BACKGROUND_TASK_STATE) > 0) {
+            stateSubscribers_.emplace_back(subscriberInfo);
+        }
+        hapSubscribers_[subscriberInfo->uid_].emplace_back(subscriberInfo);
+    }
+    bucketDirty_ = false;
+}
+}  // namespace BackgroundTaskMgr
+}  // namespace OHOS
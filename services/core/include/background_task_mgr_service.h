@@ -114,6 +114,15 @@ public:
     ErrCode GetAllContinuousTaskApps(std::vector<ContinuousTaskCallbackInfo> &list) override;
     ErrCode SendNotificationByDeteTask(const std::set<std::string> &taskKeys) override;
     ErrCode RemoveAuthRecord(const ContinuousTaskParam &taskParam) override;
+    ErrCode StopContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+        std::vector<int32_t> &results) override;
+    ErrCode SuspendContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+        std::vector<int32_t> &results) override;
+    ErrCode ActiveContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+        std::vector<int32_t> &results) override;
+    ErrCode PauseTransientTaskTimesForInner(const std::vector<int32_t> &uids, std::vector<int32_t> &results) override;
+    ErrCode RequestGetContinuousTasksByUidsForInner(const std::vector<int32_t> &uids,
+        std::vector<ContinuousTaskInfo> &list) override;
     int32_t Dump(int32_t fd, const std::vector<std::u16string> &args) override;
 
     void ForceCancelSuspendDelay(int32_t requestId);
@@ -123,18 +132,22 @@ public:
 
 private:
     void Init();
+    void CreateRunners();
     void DumpUsage(std::string &result);
     bool AllowDump();
     bool CheckCallingToken();
     bool CheckHapCalling(bool &isHap, uint32_t flag = 0);
     bool CheckCallingProcess();
     bool CheckAtomicService();
+    ErrCode CheckBatchCalling(const char *func, size_t batchSize);
     void OnAddSystemAbility(int32_t systemAbilityId, const std::string& deviceId) override;
     void OnRemoveSystemAbility(int32_t systemAbilityId, const std::string& deviceId) override;
 
 private:
     ServiceRunningState state_ {ServiceRunningState::STATE_NOT_START};
     std::shared_ptr<AppExecFwk::EventRunner> runner_ {nullptr};
+    std::shared_ptr<AppExecFwk::EventRunner> efficiencyRunner_ {nullptr};
+    std::shared_ptr<AppExecFwk::EventRunner> continuousRunner_ {nullptr};
     std::mutex readyMutex_;
     uint32_t dependsReady_ {0};
 };
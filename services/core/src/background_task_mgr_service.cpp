@@ -17,6 +17,7 @@
 #include "background_mode.h"
 #include "bgtask_config.h"
 #include "bgtask_hitrace_chain.h"
+#include "bundle_name_cache.h"
 #include "bundle_manager_helper.h"
 #include <functional>
 #include "ability_manager_client.h"
@@ -35,6 +36,8 @@
 #include "bgtaskmgr_log_wrapper.h"
 #include <parameters.h>
 #include "bgtask_plugin_mgr.h"
+#include "subscriber_delivery_queue.h"
+#include "timer_wheel.h"
 
 namespace OHOS {
 namespace BackgroundTaskMgr {
@@ -42,11 +45,15 @@ namespace {
 static constexpr int32_t NO_DUMP_PARAM_NUMS = 0;
 static constexpr int32_t RESOURCE_SCHEDULE_SERVICE_UID = 1096;
 static constexpr uint32_t CHECK_TIMEOUT = 10;
+static constexpr size_t MAX_BATCH_OPERATION_SIZE = 1000;
 static constexpr char BGMODE_PERMISSION[] = "ohos.permission.KEEP_BACKGROUND_RUNNING";
 static constexpr char SET_BACKGROUND_TASK_STATE_PERMISSION[] = "ohos.permission.SET_BACKGROUND_TASK_STATE";
 static constexpr char GET_BACKGROUND_TASK_INFO_PERMISSION[] = "ohos.permission.GET_BACKGROUND_TASK_INFO";
 const int32_t ENG_MODE = OHOS::system::GetIntParameter("const.debuggable", 0);
 const std::string BGTASK_SERVICE_NAME = "BgtaskMgrService";
+static constexpr char BGTASK_EFFICIENCY_RUNNER_NAME[] = "BgtaskEfficiency";
+static constexpr char BGTASK_CONTINUOUS_RUNNER_NAME[] = "BgtaskContinuous";
+static constexpr char SPLIT_RUNNER_PARAM[] = "persist.sys.bgtask_split_runner";
 static constexpr char EXTENSION_BACKUP[] = "backup";
 static constexpr char EXTENSION_RESTORE[] = "restore";
 const bool REGISTER_RESULT = SystemAbility::MakeAndRegisterAbility(
@@ -132,10 +139,26 @@ void BackgroundTaskMgrService::OnRemoveSystemAbility(int32_t systemAbilityId, co
 void BackgroundTaskMgrService::Init()
 {
     BgTaskHiTraceChain traceChain(__func__);
-    runner_ = AppExecFwk::EventRunner::Create(BGTASK_SERVICE_NAME);
+    CreateRunners();
     DelayedSingleton<BgTransientTaskMgr>::GetInstance()->Init(runner_);
-    DelayedSingleton<BgEfficiencyResourcesMgr>::GetInstance()->Init(runner_);
-    BgContinuousTaskMgr::GetInstance()->Init(runner_);
+    DelayedSingleton<BgEfficiencyResourcesMgr>::GetInstance()->Init(efficiencyRunner_);
+    BgContinuousTaskMgr::GetInstance()->Init(continuousRunner_);
+}
+
+void BackgroundTaskMgrService::CreateRunners()
+{
+    runner_ = AppExecFwk::EventRunner::Create(BGTASK_SERVICE_NAME);
+    // 各子系统使用独立线程，长时任务的通知发布和持久化不再阻塞短时任务超时和能效资源重置
+    if (OHOS::system::GetBoolParameter(SPLIT_RUNNER_PARAM, true)) {
+        efficiencyRunner_ = AppExecFwk::EventRunner::Create(BGTASK_EFFICIENCY_RUNNER_NAME);
+        continuousRunner_ = AppExecFwk::EventRunner::Create(BGTASK_CONTINUOUS_RUNNER_NAME);
+    }
+    if (efficiencyRunner_ == nullptr) {
+        efficiencyRunner_ = runner_;
+    }
+    if (continuousRunner_ == nullptr) {
+        continuousRunner_ = runner_;
+    }
 }
 
 void BackgroundTaskMgrService::OnStop()
@@ -143,6 +166,8 @@ void BackgroundTaskMgrService::OnStop()
     BgTaskHiTraceChain traceChain(__func__);
     BgContinuousTaskMgr::GetInstance()->Clear();
     DelayedSingleton<BgEfficiencyResourcesMgr>::GetInstance()->Clear();
+    // 退出前写入尚在合并窗口内的持久化数据
+    DelayedSingleton<DataStorageHelper>::GetInstance()->FlushPersistenceData();
     state_ = ServiceRunningState::STATE_NOT_START;
     BGTASK_LOGI("background task manager stop");
 }
@@ -588,6 +613,91 @@ ErrCode BackgroundTaskMgrService::ActiveContinuousTask(
     return ERR_OK;
 }
 
+ErrCode BackgroundTaskMgrService::CheckBatchCalling(const char *func, size_t batchSize)
+{
+    if (!CheckCallingToken() || !CheckCallingProcess()) {
+        BGTASK_LOGW("%{public}s not allowed", func);
+        return ERR_BGTASK_PERMISSION_DENIED;
+    }
+    if (batchSize > MAX_BATCH_OPERATION_SIZE) {
+        BGTASK_LOGW("%{public}s batch size %{public}zu exceeds limit", func, batchSize);
+        return ERR_BGTASK_INVALID_PARAM;
+    }
+    return ERR_OK;
+}
+
+ErrCode BackgroundTaskMgrService::StopContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+    std::vector<int32_t> &results)
+{
+    BgTaskHiTraceChain traceChain(__func__);
+    ErrCode ret = CheckBatchCalling(__func__, operations.size());
+    if (ret != ERR_OK) {
+        return ret;
+    }
+    return BgContinuousTaskMgr::GetInstance()->StopContinuousTasks(operations, results);
+}
+
+ErrCode BackgroundTaskMgrService::SuspendContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+    std::vector<int32_t> &results)
+{
+    BgTaskHiTraceChain traceChain(__func__);
+    ErrCode ret = CheckBatchCalling(__func__, operations.size());
+    if (ret != ERR_OK) {
+        return ret;
+    }
+    return BgContinuousTaskMgr::GetInstance()->SuspendContinuousTasks(operations, results);
+}
+
+ErrCode BackgroundTaskMgrService::ActiveContinuousTasks(const std::vector<ContinuousTaskOperation> &operations,
+    std::vector<int32_t> &results)
+{
+    BgTaskHiTraceChain traceChain(__func__);
+    ErrCode ret = CheckBatchCalling(__func__, operations.size());
+    if (ret != ERR_OK) {
+        return ret;
+    }
+    return BgContinuousTaskMgr::GetInstance()->ActiveContinuousTasks(operations, results);
+}
+
+ErrCode BackgroundTaskMgrService::PauseTransientTaskTimesForInner(const std::vector<int32_t> &uids,
+    std::vector<int32_t> &results)
+{
+    BgTaskHiTraceChain traceChain(__func__);
+    if (!CheckCallingToken()) {
+        BGTASK_LOGW("PauseTransientTaskTimesForInner not allowed");
+        return ERR_BGTASK_PERMISSION_DENIED;
+    }
+    if (uids.size() > MAX_BATCH_OPERATION_SIZE) {
+        BGTASK_LOGW("PauseTransientTaskTimesForInner batch size %{public}zu exceeds limit", uids.size());
+        return ERR_BGTASK_INVALID_PARAM;
+    }
+    return DelayedSingleton<BgTransientTaskMgr>::GetInstance()->PauseTransientTaskTimesForInner(uids, results);
+}
+
+ErrCode BackgroundTaskMgrService::RequestGetContinuousTasksByUidsForInner(const std::vector<int32_t> &uids,
+    std::vector<ContinuousTaskInfo> &list)
+{
+    BgTaskHiTraceChain traceChain(__func__);
+    if (!CheckCallingToken()) {
+        BGTASK_LOGW("RequestGetContinuousTasksByUidsForInner not allowed");
+        return ERR_BGTASK_PERMISSION_DENIED;
+    }
+    if (uids.size() > MAX_BATCH_OPERATION_SIZE) {
+        BGTASK_LOGW("RequestGetContinuousTasksByUidsForInner batch size %{public}zu exceeds limit", uids.size());
+        return ERR_BGTASK_INVALID_PARAM;
+    }
+    std::vector<std::shared_ptr<ContinuousTaskInfo>> tasksList;
+    ErrCode result = BgContinuousTaskMgr::GetInstance()->RequestGetContinuousTasksByUidsForInner(uids, tasksList);
+    if (result == ERR_OK) {
+        for (const auto& ptr : tasksList) {
+            if (ptr != nullptr) {
+                list.push_back(*ptr);
+            }
+        }
+    }
+    return result;
+}
+
 ErrCode BackgroundTaskMgrService::AVSessionNotifyUpdateNotification(int32_t uid, int32_t pid, bool isPublish)
 {
     if (!CheckCallingToken()) {
@@ -889,6 +999,10 @@ int32_t BackgroundTaskMgrService::Dump(int32_t fd, const std::vector<std::u16str
             ret = BgContinuousTaskMgr::GetInstance()->ShellDump(argsInStr, infos);
         } else if (argsInStr[0] == "-E") {
             ret = DelayedSingleton<BgEfficiencyResourcesMgr>::GetInstance()->ShellDump(argsInStr, infos);
+        } else if (argsInStr[0] == "-S") {
+            DelayedSingleton<SubscriberDeliveryQueue>::GetInstance()->ShellDump(infos);
+            DelayedSingleton<BundleNameCache>::GetInstance()->ShellDump(infos);
+            DelayedSingleton<TimerWheel>::GetInstance()->ShellDump(infos);
         } else {
             infos.emplace_back("Error params.\n");
             ret = ERR_BGTASK_INVALID_PARAM;
@@ -916,15 +1030,20 @@ void BackgroundTaskMgrService::DumpUsage(std::string &result)
     "        BATTARY_OKAY                         battary okay mode\n"
     "        DUMP_CANCEL                          cancel dump mode\n"
     "        All                                  list all request\n"
+    "        STATE                                transient app state size and evictions\n"
     "    -C                                   continuous task commands:\n"
     "        --all                                list all running continuous task infos\n"
     "        --cancel_all                         cancel all running continuous task\n"
     "        --cancel {continuous task key}       cancel one task by specifying task key\n"
+    "        --persistence                        export persisted records as json\n"
+    "        --progress                           data transfer progress coalescing statistics\n"
+    "        --notification                       notification published and skipped statistics\n"
     "    -E                                   efficiency resources commands;\n"
     "        --all                                list all efficiency resource aplications\n"
     "        --reset_all                          reset all efficiency resource aplications\n"
     "        --resetapp {uid} {resources}          reset one application of uid by specifying \n"
-    "        --resetproc {pid} {resources}         reset one application of pid by specifying \n";
+    "        --resetproc {pid} {resources}         reset one application of pid by specifying \n"
+    "    -S                                   subscriber delivery, bundle name cache and timer wheel statistics\n";
 
     result.append(dumpHelpMsg);
 }  // namespace
@@ -96,11 +96,11 @@ private:
         std::shared_ptr<ResourceApplicationRecord>> &infoMap, std::vector<std::string> &dumpInfo,
         std::stringstream &stream, const char *headInfo);
     void ResetTimeOutResource(int32_t mapKey, bool isProcess);
+    void ScheduleResetTimeOut(int32_t mapKey, bool isProcess, const std::shared_ptr<ResourceApplicationRecord> &record);
     bool RemoveTargetResourceRecord(std::unordered_map<int32_t,
         std::shared_ptr<ResourceApplicationRecord>> &infoMap, int32_t mapKey,
         const std::shared_ptr<ResourceCallbackInfo> &resourcecallbackInfo,
         EfficiencyResourcesEventType type, CancelReason cancelType);
-    bool GetBundleNamesForUid(int32_t uid, std::string &bundleName);
     bool IsCallingInfoLegal(int32_t uid, int32_t pid, std::string &bundleName);
     void EraseRecordIf(ResourceRecordMap &infoMap, const std::function<bool(ResourceRecordPair)> &fun);
     void RecoverDelayedTask(bool isProcess, ResourceRecordMap& infoMap);
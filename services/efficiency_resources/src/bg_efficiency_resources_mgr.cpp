@@ -29,6 +29,7 @@
 
 #include "resource_type.h"
 #include "time_provider.h"
+#include "timer_wheel.h"
 #include "bundle_manager_helper.h"
 #include "efficiency_resource_log.h"
 #include "tokenid_kit.h"
@@ -228,20 +229,8 @@ __attribute__((no_sanitize("cfi"))) void BgEfficiencyResourcesMgr::RecoverDelaye
     ResourceRecordMap& infoMap)
 {
     BGTASK_LOGD("start to recovery delayed task");
-    const auto &mgr = shared_from_this();
     for (auto iter = infoMap.begin(); iter != infoMap.end(); iter ++) {
-        auto &resourceList = iter->second->resourceUnitList_;
-        int32_t mapKey = iter->first;
-        for (auto resourceIter = resourceList.begin(); resourceIter != resourceList.end(); resourceIter++) {
-            if (resourceIter->isPersist_) {
-                continue;
-            }
-            auto task = [mgr, mapKey, isProcess] () {
-                mgr->ResetTimeOutResource(mapKey, isProcess);
-            };
-            int32_t timeOut = static_cast<int32_t>(resourceIter->endTime_ - TimeProvider::GetCurrentTime());
-            handler_->PostTask(task, std::max(0, timeOut));
-        }
+        ScheduleResetTimeOut(iter->first, isProcess, iter->second);
     }
 }
 
@@ -554,11 +543,32 @@ __attribute__((no_sanitize("cfi"))) void BgEfficiencyResourcesMgr::UpdateResourc
     }
     const bool isProcess = resourceInfo->IsProcess();
     int32_t mapKey = isProcess ? callbackInfo->GetPid() : callbackInfo->GetUid();
-    const auto& mgr = shared_from_this();
+    ScheduleResetTimeOut(mapKey, isProcess, record);
+}
+
+void BgEfficiencyResourcesMgr::ScheduleResetTimeOut(int32_t mapKey, bool isProcess,
+    const std::shared_ptr<ResourceApplicationRecord> &record)
+{
+    // 每条申请记录只保留一个定时器，到期时间取最早过期的非持久化资源
+    auto module = isProcess ? TimerWheelModule::EFFICIENCY_PROC_TIMEOUT : TimerWheelModule::EFFICIENCY_APP_TIMEOUT;
+    int64_t endTime = 0;
+    if (record != nullptr) {
+        for (const auto &resourceUnit : record->resourceUnitList_) {
+            if (!resourceUnit.isPersist_ && (endTime == 0 || resourceUnit.endTime_ < endTime)) {
+                endTime = resourceUnit.endTime_;
+            }
+        }
+    }
+    if (endTime == 0) {
+        DelayedSingleton<TimerWheel>::GetInstance()->RemoveTimer(module, mapKey);
+        return;
+    }
+    const auto &mgr = shared_from_this();
     auto task = [mgr, mapKey, isProcess] () {
         mgr->ResetTimeOutResource(mapKey, isProcess);
     };
-    handler_->PostTask(task, resourceInfo->GetTimeOut());
+    int64_t timeOut = std::max(endTime - TimeProvider::GetCurrentTime(), static_cast<int64_t>(0));
+    DelayedSingleton<TimerWheel>::GetInstance()->AddTimer(module, mapKey, timeOut, task, handler_);
 }
 
 void BgEfficiencyResourcesMgr::UpdateQuotaIfCpuReset(
@@ -619,10 +629,12 @@ void BgEfficiencyResourcesMgr::ResetTimeOutResource(int32_t mapKey, bool isProce
         eraseBit, resourceRecord->resourceNumber_, resourceRecord->resourceNumber_ ^ eraseBit);
     if (eraseBit == 0) {
         BGTASK_LOGD("try to reset time out resources, but find nothing to reset");
+        ScheduleResetTimeOut(mapKey, isProcess, resourceRecord);
         return;
     }
     resourceRecord->resourceNumber_ ^= eraseBit;
     RemoveListRecord(resourceRecord->resourceUnitList_, eraseBit);
+    ScheduleResetTimeOut(mapKey, isProcess, resourceRecord);
     auto callbackInfo = std::make_shared<ResourceCallbackInfo>(resourceRecord->uid_, resourceRecord->pid_, eraseBit,
         resourceRecord->bundleName_);
     callbackInfo->SetCpuLevel(resourceRecord->cpuLevel_);
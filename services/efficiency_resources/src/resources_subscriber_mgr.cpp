@@ -17,6 +17,7 @@
 #include "efficiency_resource_log.h"
 #include "hisysevent.h"
 #include "background_task_observer.h"
+#include "subscriber_delivery_queue.h"
 
 namespace OHOS {
 namespace BackgroundTaskMgr {
@@ -86,6 +87,8 @@ ErrCode ResourcesSubscriberMgr::RemoveSubscriber(const sptr<IBackgroundTaskSubsc
     }
     subscriberList_.erase(subscriberIter);
     remote->RemoveDeathRecipient(deathRecipient_);
+    DelayedSingleton<SubscriberDeliveryQueue>::GetInstance()->RemoveSubscriber(
+        DeliveryModule::EFFICIENCY_RESOURCES, remote);
     BGTASK_LOGD("remove subscriber from efficiency resources succeed");
     return ERR_OK;
 }
@@ -99,37 +102,42 @@ void ResourcesSubscriberMgr::OnResourceChanged(const std::shared_ptr<ResourceCal
         return;
     }
     std::lock_guard<std::mutex> subcriberLock(subscriberLock_);
-    const ResourceCallbackInfo& callbackInfoRef = *callbackInfo;
+    SubscriberDeliveryQueue::DeliveryTask task;
     switch (type) {
         case EfficiencyResourcesEventType::APP_RESOURCE_APPLY:
             BGTASK_LOGD("start callback function of app resources application");
             BackgroundTaskObserver::GetInstance().OnAppEfficiencyResourcesApply(callbackInfo);
-            for (auto iter = subscriberList_.begin(); iter != subscriberList_.end(); ++iter) {
-                (*iter)->OnAppEfficiencyResourcesApply(callbackInfoRef);
-            }
+            task = [callbackInfo](const sptr<IBackgroundTaskSubscriber> &subscriber) {
+                subscriber->OnAppEfficiencyResourcesApply(*callbackInfo);
+            };
             break;
         case EfficiencyResourcesEventType::RESOURCE_APPLY:
             BGTASK_LOGD("start callback function of proc resources application");
             BackgroundTaskObserver::GetInstance().OnProcEfficiencyResourcesApply(callbackInfo);
-            for (auto iter = subscriberList_.begin(); iter != subscriberList_.end(); ++iter) {
-                (*iter)->OnProcEfficiencyResourcesApply(callbackInfoRef);
-            }
+            task = [callbackInfo](const sptr<IBackgroundTaskSubscriber> &subscriber) {
+                subscriber->OnProcEfficiencyResourcesApply(*callbackInfo);
+            };
             break;
         case EfficiencyResourcesEventType::APP_RESOURCE_RESET:
             BGTASK_LOGD("start callback function of app resources reset");
             BackgroundTaskObserver::GetInstance().OnAppEfficiencyResourcesReset(callbackInfo);
-            for (auto iter = subscriberList_.begin(); iter != subscriberList_.end(); ++iter) {
-                (*iter)->OnAppEfficiencyResourcesReset(callbackInfoRef);
-            }
+            task = [callbackInfo](const sptr<IBackgroundTaskSubscriber> &subscriber) {
+                subscriber->OnAppEfficiencyResourcesReset(*callbackInfo);
+            };
             break;
         case EfficiencyResourcesEventType::RESOURCE_RESET:
             BGTASK_LOGD("start callback function of proc resources reset");
             BackgroundTaskObserver::GetInstance().OnProcEfficiencyResourcesReset(callbackInfo);
-            for (auto iter = subscriberList_.begin(); iter != subscriberList_.end(); ++iter) {
-                (*iter)->OnProcEfficiencyResourcesReset(callbackInfoRef);
-            }
+            task = [callbackInfo](const sptr<IBackgroundTaskSubscriber> &subscriber) {
+                subscriber->OnProcEfficiencyResourcesReset(*callbackInfo);
+            };
             break;
     }
+    // 远端订阅者的回调只入队，由投递线程批量发送，不在持锁期间做跨进程调用
+    auto deliveryQueue = DelayedSingleton<SubscriberDeliveryQueue>::GetInstance();
+    for (auto iter = subscriberList_.begin(); iter != subscriberList_.end(); ++iter) {
+        deliveryQueue->Deliver(DeliveryModule::EFFICIENCY_RESOURCES, *iter, task);
+    }
     BGTASK_LOGD("efficiency resources on resources changed function succeed");
 }
 
@@ -154,6 +162,8 @@ void ResourcesSubscriberMgr::HandleSubscriberDeath(const wptr<IRemoteObject>& re
         return;
     }
     subscriberList_.erase(subscriberIter);
+    DelayedSingleton<SubscriberDeliveryQueue>::GetInstance()->RemoveSubscriber(
+        DeliveryModule::EFFICIENCY_RESOURCES, proxy);
     BGTASK_LOGD("suscriber death, remove it from list");
 }
 
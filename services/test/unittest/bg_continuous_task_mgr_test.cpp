@@ -16,6 +16,7 @@
 #include <functional>
 #include <chrono>
 #include <thread>
+#include <unistd.h>
 
 #include "gtest/gtest.h"
 #include "bgtask_common.h"
@@ -35,6 +36,8 @@
 #include "background_task_observer.h"
 #include "progress_info.h"
 #include "data_transfer_progress.h"
+#include "progress_coalescer.h"
+#include "subscriber_delivery_queue.h"
 #ifdef GAME_PRE_LAUNCH_ENABLE
 #include "game_pre_launch_mgr.h"
 #endif
@@ -146,7 +149,7 @@ std::shared_ptr<ContinuousTaskRecord> CreateTestTaskRecord(
     record->bundleName_ = bundleName;
     record->abilityName_ = abilityName;
     record->abilityId_ = 0;
-    record->bgModeIds_.push_back(bgModeId);
+    record->AddBgModeId(bgModeId);
     record->isFromWebview_ = false;
     return record;
 }
@@ -520,8 +523,8 @@ HWTEST_F(BgContinuousTaskMgrTest, BgTaskManagerUnitTest_005, TestSize.Level1)
 {
     std::shared_ptr<ContinuousTaskRecord> continuousTaskRecord = std::make_shared<ContinuousTaskRecord>();
     continuousTaskRecord->bgModeId_ = 1;
-    continuousTaskRecord->bgModeIds_.clear();
-    continuousTaskRecord->bgModeIds_.push_back(continuousTaskRecord->bgModeId_);
+    continuousTaskRecord->SetBgModeIds({});
+    continuousTaskRecord->AddBgModeId(continuousTaskRecord->bgModeId_);
     continuousTaskRecord->isNewApi_ = false;
     EXPECT_EQ(bgContinuousTaskMgr_->SendContinuousTaskNotification(continuousTaskRecord),
         ERR_BGTASK_NOTIFICATION_VERIFY_FAILED);
@@ -529,8 +532,8 @@ HWTEST_F(BgContinuousTaskMgrTest, BgTaskManagerUnitTest_005, TestSize.Level1)
     EXPECT_EQ(bgContinuousTaskMgr_->SendContinuousTaskNotification(continuousTaskRecord),
         ERR_BGTASK_NOTIFICATION_VERIFY_FAILED);
     continuousTaskRecord->bgModeId_ = INVALID_BGMODE_ID;
-    continuousTaskRecord->bgModeIds_.clear();
-    continuousTaskRecord->bgModeIds_.push_back(continuousTaskRecord->bgModeId_);
+    continuousTaskRecord->SetBgModeIds({});
+    continuousTaskRecord->AddBgModeId(continuousTaskRecord->bgModeId_);
     EXPECT_EQ(bgContinuousTaskMgr_->SendContinuousTaskNotification(continuousTaskRecord),
         ERR_BGTASK_NOTIFICATION_VERIFY_FAILED);
 
@@ -542,8 +545,8 @@ HWTEST_F(BgContinuousTaskMgrTest, BgTaskManagerUnitTest_005, TestSize.Level1)
     EXPECT_EQ(bgContinuousTaskMgr_->SendContinuousTaskNotification(continuousTaskRecord),
         ERR_BGTASK_NOTIFICATION_VERIFY_FAILED);
     continuousTaskRecord->bgModeId_ = 1;
-    continuousTaskRecord->bgModeIds_.clear();
-    continuousTaskRecord->bgModeIds_.push_back(continuousTaskRecord->bgModeId_);
+    continuousTaskRecord->SetBgModeIds({});
+    continuousTaskRecord->AddBgModeId(continuousTaskRecord->bgModeId_);
     EXPECT_EQ(bgContinuousTaskMgr_->SendContinuousTaskNotification(continuousTaskRecord), ERR_OK);
 }
 
@@ -902,7 +905,7 @@ HWTEST_F(BgContinuousTaskMgrTest, BgTaskManagerUnitTest_035, TestSize.Level1)
 
     std::shared_ptr<ContinuousTaskRecord> continuousTaskRecord1 = std::make_shared<ContinuousTaskRecord>();
     continuousTaskRecord1->uid_ = 1;
-    continuousTaskRecord1->bgModeIds_ = {1};
+    continuousTaskRecord1->SetBgModeIds({1});
     bgContinuousTaskMgr_->continuousTaskInfosMap_["key1"] = continuousTaskRecord1;
     EXPECT_EQ(bgContinuousTaskMgr_->continuousTaskInfosMap_.size(), 1);
 
@@ -1069,13 +1072,13 @@ HWTEST_F(BgContinuousTaskMgrTest, BgTaskManagerUnitTest_046, TestSize.Level1)
 HWTEST_F(BgContinuousTaskMgrTest, BgTaskManagerUnitTest_047, TestSize.Level1)
 {
     std::shared_ptr<ContinuousTaskRecord> continuousTaskRecord = std::make_shared<ContinuousTaskRecord>();
-    continuousTaskRecord->bgModeIds_.push_back(2);
+    continuousTaskRecord->AddBgModeId(2);
     EXPECT_NE(bgContinuousTaskMgr_->GetNotificationText(continuousTaskRecord), "");
 
-    continuousTaskRecord->bgModeIds_.push_back(1);
+    continuousTaskRecord->AddBgModeId(1);
     EXPECT_NE(bgContinuousTaskMgr_->GetNotificationText(continuousTaskRecord), "");
 
-    continuousTaskRecord->bgSubModeIds_.push_back(1);
+    continuousTaskRecord->AddBgSubModeId(1);
     EXPECT_NE(bgContinuousTaskMgr_->GetNotificationText(continuousTaskRecord), "");
 }
 
@@ -1092,14 +1095,14 @@ HWTEST_F(BgContinuousTaskMgrTest, BgTaskManagerUnitTest_048, TestSize.Level1)
     EXPECT_EQ(bgContinuousTaskMgr_->CheckSubMode(want, continuousTaskRecord), ERR_OK);
 
     want->SetParam(BG_TASK_SUB_MODE_TYPE, 0);
-    continuousTaskRecord->bgModeIds_.push_back(1);
+    continuousTaskRecord->AddBgModeId(1);
     EXPECT_EQ(bgContinuousTaskMgr_->CheckSubMode(want, continuousTaskRecord), ERR_BGTASK_CHECK_TASK_PARAM);
 
     want->SetParam(BG_TASK_SUB_MODE_TYPE, 1);
-    continuousTaskRecord->bgModeIds_.push_back(1);
+    continuousTaskRecord->AddBgModeId(1);
     EXPECT_EQ(bgContinuousTaskMgr_->CheckSubMode(want, continuousTaskRecord), ERR_BGTASK_CHECK_TASK_PARAM);
 
-    continuousTaskRecord->bgModeIds_.push_back(5);
+    continuousTaskRecord->AddBgModeId(5);
     EXPECT_EQ(bgContinuousTaskMgr_->CheckSubMode(want, continuousTaskRecord), ERR_OK);
 }
 
@@ -1113,19 +1116,19 @@ HWTEST_F(BgContinuousTaskMgrTest, BgTaskManagerUnitTest_049, TestSize.Level1)
 {
     std::string notificationText {""};
     std::shared_ptr<ContinuousTaskRecord> record = std::make_shared<ContinuousTaskRecord>();
-    record->bgModeIds_.clear();
-    record->bgModeIds_.push_back(2);
+    record->SetBgModeIds({});
+    record->AddBgModeId(2);
     EXPECT_EQ(bgContinuousTaskMgr_->CheckNotificationText(notificationText, record), ERR_OK);
 
-    record->bgModeIds_.clear();
-    record->bgModeIds_.push_back(100);
+    record->SetBgModeIds({});
+    record->AddBgModeId(100);
     bgContinuousTaskMgr_->continuousTaskText_.clear();
     EXPECT_EQ(bgContinuousTaskMgr_->CheckNotificationText(notificationText, record),
         ERR_BGTASK_NOTIFICATION_VERIFY_FAILED);
 
-    record->bgModeIds_.clear();
-    record->bgModeIds_.push_back(5);
-    record->bgSubModeIds_.push_back(1);
+    record->SetBgModeIds({});
+    record->AddBgModeId(5);
+    record->AddBgSubModeId(1);
     bgContinuousTaskMgr_->continuousTaskSubText_.clear();
     std::fill_n(std::back_inserter(bgContinuousTaskMgr_->continuousTaskText_), PROMPT_NUMS, "bgmmode_test");
     EXPECT_EQ(bgContinuousTaskMgr_->CheckNotificationText(notificationText, record),
@@ -1137,18 +1140,18 @@ HWTEST_F(BgContinuousTaskMgrTest, BgTaskManagerUnitTest_049, TestSize.Level1)
     std::fill_n(std::back_inserter(bgContinuousTaskMgr_->continuousTaskSubText_), PROMPT_NUMS, "bgmsubmode_test");
     EXPECT_EQ(bgContinuousTaskMgr_->CheckNotificationText(notificationText, record), ERR_OK);
 
-    record->bgModeIds_.clear();
-    record->bgModeIds_.push_back(11);
-    record->bgSubModeIds_.clear();
-    record->bgSubModeIds_.push_back(9);
+    record->SetBgModeIds({});
+    record->AddBgModeId(11);
+    record->SetBgSubModeIds({});
+    record->AddBgSubModeId(9);
     bgContinuousTaskMgr_->continuousTaskSubText_.clear();
     std::fill_n(std::back_inserter(bgContinuousTaskMgr_->continuousTaskSubText_), PROMPT_NUMS, "bgmsubmode_test");
     EXPECT_EQ(bgContinuousTaskMgr_->CheckNotificationText(notificationText, record), ERR_OK);
 
-    record->bgModeIds_.clear();
-    record->bgModeIds_.push_back(11);
-    record->bgSubModeIds_.clear();
-    record->bgSubModeIds_.push_back(10);
+    record->SetBgModeIds({});
+    record->AddBgModeId(11);
+    record->SetBgSubModeIds({});
+    record->AddBgSubModeId(10);
     bgContinuousTaskMgr_->continuousTaskSubText_.clear();
     std::fill_n(std::back_inserter(bgContinuousTaskMgr_->continuousTaskSubText_), PROMPT_NUMS, "bgmsubmode_test");
     EXPECT_EQ(bgContinuousTaskMgr_->CheckNotificationText(notificationText, record), ERR_OK);
@@ -1263,8 +1266,8 @@ HWTEST_F(BgContinuousTaskMgrTest, GetAllContinuousTasks_001, TestSize.Level1)
     continuousTaskRecord1->abilityName_ = "abilityName";
     continuousTaskRecord1->uid_ = 1;
     continuousTaskRecord1->bgModeId_ = TEST_NUM_TWO;
-    continuousTaskRecord1->bgModeIds_.push_back(TEST_NUM_TWO);
-    continuousTaskRecord1->bgSubModeIds_.push_back(TEST_NUM_TWO);
+    continuousTaskRecord1->AddBgModeId(TEST_NUM_TWO);
+    continuousTaskRecord1->AddBgSubModeId(TEST_NUM_TWO);
     continuousTaskRecord1->notificationId_ = 1;
     continuousTaskRecord1->continuousTaskId_ = 1;
     continuousTaskRecord1->abilityId_ = 1;
@@ -1298,8 +1301,8 @@ HWTEST_F(BgContinuousTaskMgrTest, GetAllContinuousTasks_002, TestSize.Level1)
     continuousTaskRecord1->abilityName_ = "abilityName";
     continuousTaskRecord1->uid_ = 1;
     continuousTaskRecord1->bgModeId_ = TEST_NUM_TWO;
-    continuousTaskRecord1->bgModeIds_.push_back(TEST_NUM_TWO);
-    continuousTaskRecord1->bgSubModeIds_.push_back(TEST_NUM_TWO);
+    continuousTaskRecord1->AddBgModeId(TEST_NUM_TWO);
+    continuousTaskRecord1->AddBgSubModeId(TEST_NUM_TWO);
     continuousTaskRecord1->notificationId_ = 1;
     continuousTaskRecord1->continuousTaskId_ = 1;
     continuousTaskRecord1->abilityId_ = 1;
@@ -1329,8 +1332,8 @@ HWTEST_F(BgContinuousTaskMgrTest, GetAllContinuousTasksInner_001, TestSize.Level
     continuousTaskRecord1->abilityName_ = "abilityName";
     continuousTaskRecord1->uid_ = 1;
     continuousTaskRecord1->bgModeId_ = TEST_NUM_TWO;
-    continuousTaskRecord1->bgModeIds_.push_back(TEST_NUM_TWO);
-    continuousTaskRecord1->bgSubModeIds_.push_back(TEST_NUM_TWO);
+    continuousTaskRecord1->AddBgModeId(TEST_NUM_TWO);
+    continuousTaskRecord1->AddBgSubModeId(TEST_NUM_TWO);
     continuousTaskRecord1->notificationId_ = 1;
     continuousTaskRecord1->continuousTaskId_ = 1;
     continuousTaskRecord1->abilityId_ = 1;
@@ -1368,8 +1371,8 @@ HWTEST_F(BgContinuousTaskMgrTest, RequestGetContinuousTasksByUidForInner_001, Te
     continuousTaskRecord1->abilityName_ = "abilityName";
     continuousTaskRecord1->uid_ = 1;
     continuousTaskRecord1->bgModeId_ = TEST_NUM_TWO;
-    continuousTaskRecord1->bgModeIds_.push_back(TEST_NUM_TWO);
-    continuousTaskRecord1->bgSubModeIds_.push_back(TEST_NUM_TWO);
+    continuousTaskRecord1->AddBgModeId(TEST_NUM_TWO);
+    continuousTaskRecord1->AddBgSubModeId(TEST_NUM_TWO);
     continuousTaskRecord1->notificationId_ = 1;
     continuousTaskRecord1->continuousTaskId_ = 1;
     continuousTaskRecord1->abilityId_ = 1;
@@ -1451,10 +1454,10 @@ HWTEST_F(BgContinuousTaskMgrTest, AVSessionNotifyUpdateNotification_003, TestSiz
     uid = 1;
     std::shared_ptr<ContinuousTaskRecord> continuousTaskRecord1 = std::make_shared<ContinuousTaskRecord>();
     continuousTaskRecord1->uid_ = uid;
-    continuousTaskRecord1->bgModeIds_.push_back(BGMODE_AUDIO_PLAYBACK_ID);
+    continuousTaskRecord1->AddBgModeId(BGMODE_AUDIO_PLAYBACK_ID);
     bgContinuousTaskMgr_->continuousTaskInfosMap_["key1"] = continuousTaskRecord1;
     EXPECT_EQ(bgContinuousTaskMgr_->AVSessionNotifyUpdateNotificationInner(uid, pid, false), ERR_OK);
-    continuousTaskRecord1->bgModeIds_.push_back(LOCATION_BGMODE_ID);
+    continuousTaskRecord1->AddBgModeId(LOCATION_BGMODE_ID);
     EXPECT_EQ(bgContinuousTaskMgr_->AVSessionNotifyUpdateNotificationInner(uid, pid, false), ERR_OK);
 }
 
@@ -1474,7 +1477,7 @@ HWTEST_F(BgContinuousTaskMgrTest, AVSessionNotifyUpdateNotification_004, TestSiz
     std::shared_ptr<ContinuousTaskRecord> continuousTaskRecord1 = std::make_shared<ContinuousTaskRecord>();
     continuousTaskRecord1->uid_ = uid;
     continuousTaskRecord1->audioDetectState_ = false;
-    continuousTaskRecord1->bgModeIds_.push_back(BGMODE_AUDIO_PLAYBACK_ID);
+    continuousTaskRecord1->AddBgModeId(BGMODE_AUDIO_PLAYBACK_ID);
     bgContinuousTaskMgr_->continuousTaskInfosMap_["key1"] = continuousTaskRecord1;
     EXPECT_EQ(bgContinuousTaskMgr_->AVSessionNotifyUpdateNotificationInner(uid, pid, false), ERR_OK);
 }
@@ -1495,8 +1498,8 @@ HWTEST_F(BgContinuousTaskMgrTest, BgTaskManagerUnitTest_054, TestSize.Level1)
     bgContinuousTaskMgr_->cachedBundleInfos_.emplace(1, info);
     continuousTaskRecord->uid_ = 1;
     continuousTaskRecord->bgModeId_ = 2;
-    continuousTaskRecord->bgModeIds_.clear();
-    continuousTaskRecord->bgModeIds_.push_back(continuousTaskRecord->bgModeId_);
+    continuousTaskRecord->SetBgModeIds({});
+    continuousTaskRecord->AddBgModeId(continuousTaskRecord->bgModeId_);
     bgContinuousTaskMgr_->continuousTaskInfosMap_["key1"] = continuousTaskRecord;
     EXPECT_EQ(bgContinuousTaskMgr_->SendContinuousTaskNotification(continuousTaskRecord), ERR_OK);
 }
@@ -1531,7 +1534,7 @@ HWTEST_F(BgContinuousTaskMgrTest, BgTaskManagerUnitTest_058, TestSize.Level1)
     std::shared_ptr<ContinuousTaskRecord> continuousTaskRecord = std::make_shared<ContinuousTaskRecord>();
     continuousTaskRecord->uid_ = TEST_NUM_ONE;
     continuousTaskRecord->bgModeId_ = 2;
-    continuousTaskRecord->bgModeIds_.push_back(continuousTaskRecord->bgModeId_);
+    continuousTaskRecord->AddBgModeId(continuousTaskRecord->bgModeId_);
     bgContinuousTaskMgr_->continuousTaskInfosMap_["key1"] = continuousTaskRecord;
     bgContinuousTaskMgr_->HandleSuspendContinuousAudioTask(1);
     EXPECT_EQ(bgContinuousTaskMgr_->continuousTaskInfosMap_.size(), 1);
@@ -1551,7 +1554,7 @@ HWTEST_F(BgContinuousTaskMgrTest, BgTaskManagerUnitTest_059, TestSize.Level1)
     continuousTaskRecord->uid_ = TEST_NUM_ONE;
     continuousTaskRecord->bgModeId_ = 2;
     continuousTaskRecord->isByRequestObject_ = true;
-    continuousTaskRecord->bgModeIds_.push_back(continuousTaskRecord->bgModeId_);
+    continuousTaskRecord->AddBgModeId(continuousTaskRecord->bgModeId_);
     // 不需要合并
     EXPECT_EQ(bgContinuousTaskMgr_->CheckCombinedTaskNotification(continuousTaskRecord, sendNotification), ERR_OK);
 
@@ -1566,7 +1569,7 @@ HWTEST_F(BgContinuousTaskMgrTest, BgTaskManagerUnitTest_059, TestSize.Level1)
     std::shared_ptr<ContinuousTaskRecord> continuousTaskRecord2 = std::make_shared<ContinuousTaskRecord>();
     continuousTaskRecord2->uid_ = TEST_NUM_ONE + 1;
     continuousTaskRecord2->bgModeId_ = 2;
-    continuousTaskRecord2->bgModeIds_.push_back(continuousTaskRecord->bgModeId_);
+    continuousTaskRecord2->AddBgModeId(continuousTaskRecord->bgModeId_);
     bgContinuousTaskMgr_->continuousTaskInfosMap_["key1"] = continuousTaskRecord2;
     // 需要合并，任务uid不相等
     EXPECT_EQ(bgContinuousTaskMgr_->CheckCombinedTaskNotification(continuousTaskRecord, sendNotification),
@@ -1611,21 +1614,21 @@ HWTEST_F(BgContinuousTaskMgrTest, BgTaskManagerUnitTest_060, TestSize.Level1)
         ERR_BGTASK_CONTINUOUS_NOT_MERGE_NOTIFICATION_NOT_EXIST);
     bgContinuousTaskMgr_->continuousTaskInfosMap_.clear();
     continuousTaskRecord->bgModeId_ = 2;
-    continuousTaskRecord->bgModeIds_.clear();
-    continuousTaskRecord->bgModeIds_.push_back(2);
+    continuousTaskRecord->SetBgModeIds({});
+    continuousTaskRecord->AddBgModeId(2);
     continuousTaskRecord2->bgModeId_ = 3;
-    continuousTaskRecord2->bgModeIds_.clear();
-    continuousTaskRecord2->bgModeIds_.push_back(3);
+    continuousTaskRecord2->SetBgModeIds({});
+    continuousTaskRecord2->AddBgModeId(3);
     continuousTaskRecord2->notificationId_ = 1;
     bgContinuousTaskMgr_->continuousTaskInfosMap_["key1"] = continuousTaskRecord2;
     // 需要合并，任务主类型不相等
     EXPECT_EQ(bgContinuousTaskMgr_->CheckCombinedTaskNotification(continuousTaskRecord, sendNotification),
         ERR_BGTASK_CONTINUOUS_MODE_OR_SUBMODE_TYPE_MISMATCH);
     bgContinuousTaskMgr_->continuousTaskInfosMap_.clear();
-    continuousTaskRecord->bgSubModeIds_.clear();
-    continuousTaskRecord->bgSubModeIds_.push_back(2);
-    continuousTaskRecord2->bgSubModeIds_.clear();
-    continuousTaskRecord2->bgSubModeIds_.push_back(3);
+    continuousTaskRecord->SetBgSubModeIds({});
+    continuousTaskRecord->AddBgSubModeId(2);
+    continuousTaskRecord2->SetBgSubModeIds({});
+    continuousTaskRecord2->AddBgSubModeId(3);
     bgContinuousTaskMgr_->continuousTaskInfosMap_["key1"] = continuousTaskRecord2;
     // 需要合并，任务子类型不相等
     EXPECT_EQ(bgContinuousTaskMgr_->CheckCombinedTaskNotification(continuousTaskRecord, sendNotification),
@@ -1647,10 +1650,10 @@ HWTEST_F(BgContinuousTaskMgrTest, BgTaskManagerUnitTest_061, TestSize.Level1)
     continuousTaskRecord->combinedNotificationTaskId_ = TEST_NUM_ONE;
     continuousTaskRecord->isCombinedTaskNotification_ = true;
     continuousTaskRecord->bgModeId_ = 1;
-    continuousTaskRecord->bgModeIds_.clear();
-    continuousTaskRecord->bgModeIds_.push_back(1);
-    continuousTaskRecord->bgSubModeIds_.clear();
-    continuousTaskRecord->bgSubModeIds_.push_back(2);
+    continuousTaskRecord->SetBgModeIds({});
+    continuousTaskRecord->AddBgModeId(1);
+    continuousTaskRecord->SetBgSubModeIds({});
+    continuousTaskRecord->AddBgSubModeId(2);
     continuousTaskRecord->isByRequestObject_ = true;
 
     std::shared_ptr<ContinuousTaskRecord> continuousTaskRecord2 = std::make_shared<ContinuousTaskRecord>();
@@ -1658,10 +1661,10 @@ HWTEST_F(BgContinuousTaskMgrTest, BgTaskManagerUnitTest_061, TestSize.Level1)
     continuousTaskRecord2->continuousTaskId_ = TEST_NUM_ONE;
     continuousTaskRecord2->isCombinedTaskNotification_ = true;
     continuousTaskRecord2->bgModeId_ = 1;
-    continuousTaskRecord2->bgModeIds_.clear();
-    continuousTaskRecord2->bgModeIds_.push_back(1);
-    continuousTaskRecord2->bgSubModeIds_.clear();
-    continuousTaskRecord2->bgSubModeIds_.push_back(2);
+    continuousTaskRecord2->SetBgModeIds({});
+    continuousTaskRecord2->AddBgModeId(1);
+    continuousTaskRecord2->SetBgSubModeIds({});
+    continuousTaskRecord2->AddBgSubModeId(2);
     continuousTaskRecord2->notificationId_ = 1;
     bgContinuousTaskMgr_->continuousTaskInfosMap_["key1"] = continuousTaskRecord2;
     // 需要合并，任务类型包含上传下载，申请失败
@@ -1724,10 +1727,10 @@ HWTEST_F(BgContinuousTaskMgrTest, BgTaskManagerUnitTest_063, TestSize.Level1)
 
     bgContinuousTaskMgr_->continuousTaskInfosMap_.clear();
     continuousTaskRecord->bgModeId_ = 1;
-    continuousTaskRecord->bgModeIds_.clear();
-    continuousTaskRecord->bgModeIds_.push_back(1);
-    continuousTaskRecord->bgSubModeIds_.clear();
-    continuousTaskRecord->bgSubModeIds_.push_back(3);
+    continuousTaskRecord->SetBgModeIds({});
+    continuousTaskRecord->AddBgModeId(1);
+    continuousTaskRecord->SetBgSubModeIds({});
+    continuousTaskRecord->AddBgSubModeId(3);
     continuousTaskRecord->abilityName_ = "ability1";
     continuousTaskRecord->bundleName_ = "Entry";
     bgContinuousTaskMgr_->continuousTaskInfosMap_["key1"] = continuousTaskRecord;
@@ -1767,10 +1770,10 @@ HWTEST_F(BgContinuousTaskMgrTest, BgTaskManagerUnitTest_064, TestSize.Level1)
     bgContinuousTaskMgr_->cachedBundleInfos_.emplace(1, info);
     bgContinuousTaskMgr_->continuousTaskInfosMap_.clear();
     continuousTaskRecord->bgModeId_ = 4;
-    continuousTaskRecord->bgModeIds_.clear();
-    continuousTaskRecord->bgModeIds_.push_back(4);
-    continuousTaskRecord->bgSubModeIds_.clear();
-    continuousTaskRecord->bgSubModeIds_.push_back(2);
+    continuousTaskRecord->SetBgModeIds({});
+    continuousTaskRecord->AddBgModeId(4);
+    continuousTaskRecord->SetBgSubModeIds({});
+    continuousTaskRecord->AddBgSubModeId(2);
     continuousTaskRecord->isCombinedTaskNotification_ = false;
     std::shared_ptr<WantAgentInfo> wantInfo = std::make_shared<WantAgentInfo>();
     wantInfo->bundleName_ = "wantAgentBundleName";
@@ -1821,10 +1824,10 @@ HWTEST_F(BgContinuousTaskMgrTest, BgTaskManagerUnitTest_065, TestSize.Level1)
     bgContinuousTaskMgr_->cachedBundleInfos_.emplace(1, info);
     bgContinuousTaskMgr_->continuousTaskInfosMap_.clear();
     continuousTaskRecord->bgModeId_ = 4;
-    continuousTaskRecord->bgModeIds_.clear();
-    continuousTaskRecord->bgModeIds_.push_back(4);
-    continuousTaskRecord->bgSubModeIds_.clear();
-    continuousTaskRecord->bgSubModeIds_.push_back(2);
+    continuousTaskRecord->SetBgModeIds({});
+    continuousTaskRecord->AddBgModeId(4);
+    continuousTaskRecord->SetBgSubModeIds({});
+    continuousTaskRecord->AddBgSubModeId(2);
     continuousTaskRecord->isCombinedTaskNotification_ = true;
     std::shared_ptr<WantAgentInfo> wantInfo = std::make_shared<WantAgentInfo>();
     wantInfo->bundleName_ = "wantAgentBundleName";
@@ -2151,12 +2154,12 @@ HWTEST_F(BgContinuousTaskMgrTest, CheckLiveViewInfo_001, TestSize.Level1)
     uid = 1;
     record->uid_ = uid;
     record->bgModeId_ = 4;
-    record->bgModeIds_.clear();
-    record->bgModeIds_.push_back(4);
+    record->SetBgModeIds({});
+    record->AddBgModeId(4);
     EXPECT_TRUE(bgContinuousTaskMgr_->CheckLiveViewInfo(record));
-    record->bgModeIds_.push_back(2);
+    record->AddBgModeId(2);
     EXPECT_TRUE(bgContinuousTaskMgr_->CheckLiveViewInfo(record));
-    record->bgModeIds_.push_back(3);
+    record->AddBgModeId(3);
     EXPECT_FALSE(bgContinuousTaskMgr_->CheckLiveViewInfo(record));
 }
 
@@ -2182,8 +2185,8 @@ HWTEST_F(BgContinuousTaskMgrTest, CancelBgTaskNotification_001, TestSize.Level1)
 
     record->notificationId_ = 1;
     record->bgModeId_ = 4;
-    record->bgModeIds_.push_back(4);
-    record->bgModeIds_.push_back(3);
+    record->AddBgModeId(4);
+    record->AddBgModeId(3);
     bgContinuousTaskMgr_->continuousTaskInfosMap_["key1"] = record;
     bgContinuousTaskMgr_->CancelBgTaskNotification(uid);
     EXPECT_EQ(record->GetNotificationId(), 1);
@@ -2232,6 +2235,8 @@ HWTEST_F(BgContinuousTaskMgrTest, OnBackup_001, TestSize.Level1)
     bgContinuousTaskMgr_->bannerNotificationRecord_.emplace(label, bannerNotification);
     bgContinuousTaskMgr_->RefreshAuthRecord();
     EXPECT_EQ(bgContinuousTaskMgr_->OnBackup(data, reply), ERR_OK);
+    // 备份导出文件交给调用方后即删除
+    EXPECT_NE(access("/data/service/el1/public/background_task_mgr/auth_record_backup", F_OK), 0);
 }
 
 /**
@@ -2300,8 +2305,8 @@ HWTEST_F(BgContinuousTaskMgrTest, GetAllContinuousTasksBySystem_001, TestSize.Le
     continuousTaskRecord1->abilityName_ = "abilityName";
     continuousTaskRecord1->uid_ = 1;
     continuousTaskRecord1->bgModeId_ = TEST_NUM_TWO;
-    continuousTaskRecord1->bgModeIds_.push_back(TEST_NUM_TWO);
-    continuousTaskRecord1->bgSubModeIds_.push_back(TEST_NUM_TWO);
+    continuousTaskRecord1->AddBgModeId(TEST_NUM_TWO);
+    continuousTaskRecord1->AddBgSubModeId(TEST_NUM_TWO);
     continuousTaskRecord1->notificationId_ = 1;
     continuousTaskRecord1->continuousTaskId_ = 1;
     continuousTaskRecord1->abilityId_ = 1;
@@ -2330,11 +2335,11 @@ HWTEST_F(BgContinuousTaskMgrTest, OnBundleResourcesChanged_001, TestSize.Level1)
     bgContinuousTaskMgr_->OnBundleResourcesChanged();
     std::shared_ptr<ContinuousTaskRecord> record = std::make_shared<ContinuousTaskRecord>();
     bgContinuousTaskMgr_->continuousTaskInfosMap_["key1"] = record;
-    record->bgSubModeIds_.push_back(BackgroundMode::LOCATION);
+    record->AddBgSubModeId(BackgroundMode::LOCATION);
     record->bundleName_ = "bundleName";
     record->userId_ = 1;
     bgContinuousTaskMgr_->OnBundleResourcesChanged();
-    record->bgSubModeIds_.push_back(BackgroundMode::DATA_TRANSFER);
+    record->AddBgSubModeId(BackgroundMode::DATA_TRANSFER);
     bgContinuousTaskMgr_->OnBundleResourcesChanged();
     EXPECT_FALSE(bgContinuousTaskMgr_->continuousTaskInfosMap_.empty());
 }
@@ -2353,16 +2358,16 @@ HWTEST_F(BgContinuousTaskMgrTest, CheckSpecialNotificationText_001, TestSize.Lev
     bgContinuousTaskMgr_->continuousTaskSubText_ = {"test"};
     EXPECT_EQ(bgContinuousTaskMgr_->CheckSpecialNotificationText(notificationText, record,
         BackgroundMode::BLUETOOTH_INTERACTION), ERR_BGTASK_NOTIFICATION_VERIFY_FAILED);
-    record->bgSubModeIds_.push_back(BackgroundTaskSubmode::SUBMODE_NORMAL_NOTIFICATION);
+    record->AddBgSubModeId(BackgroundTaskSubmode::SUBMODE_NORMAL_NOTIFICATION);
     EXPECT_EQ(bgContinuousTaskMgr_->CheckSpecialNotificationText(notificationText, record,
         BackgroundMode::BLUETOOTH_INTERACTION), ERR_BGTASK_NOTIFICATION_VERIFY_FAILED);
-    record->bgSubModeIds_.push_back(BackgroundTaskSubmode::SUBMODE_WORK_OUT_NORMAL_NOTIFICATION);
+    record->AddBgSubModeId(BackgroundTaskSubmode::SUBMODE_WORK_OUT_NORMAL_NOTIFICATION);
     EXPECT_EQ(bgContinuousTaskMgr_->CheckSpecialNotificationText(notificationText, record,
         BackgroundMode::BLUETOOTH_INTERACTION), ERR_BGTASK_NOTIFICATION_VERIFY_FAILED);
-    record->bgSubModeIds_.push_back(BackgroundTaskSubmode::SUBMODE_VIDEO_BROADCAST_NORMAL_NOTIFICATION);
+    record->AddBgSubModeId(BackgroundTaskSubmode::SUBMODE_VIDEO_BROADCAST_NORMAL_NOTIFICATION);
     EXPECT_EQ(bgContinuousTaskMgr_->CheckSpecialNotificationText(notificationText, record,
         BackgroundMode::BLUETOOTH_INTERACTION), ERR_BGTASK_NOTIFICATION_VERIFY_FAILED);
-    record->bgSubModeIds_.push_back(BackgroundTaskSubmode::SUBMODE_MEDIA_PROCESS_NORMAL_NOTIFICATION);
+    record->AddBgSubModeId(BackgroundTaskSubmode::SUBMODE_MEDIA_PROCESS_NORMAL_NOTIFICATION);
     EXPECT_EQ(bgContinuousTaskMgr_->CheckSpecialNotificationText(notificationText, record,
         BackgroundMode::BLUETOOTH_INTERACTION), ERR_BGTASK_NOTIFICATION_VERIFY_FAILED);
 }
@@ -2378,13 +2383,13 @@ HWTEST_F(BgContinuousTaskMgrTest, CheckSpecialNotificationText_002, TestSize.Lev
     bgContinuousTaskMgr_->continuousTaskSubText_ = {"test", "test1", "test2", "test3"};
     std::string notificationText = "";
     std::shared_ptr<ContinuousTaskRecord> record = std::make_shared<ContinuousTaskRecord>();
-    record->bgSubModeIds_.push_back(BackgroundTaskSubmode::SUBMODE_WORK_OUT_NORMAL_NOTIFICATION);
+    record->AddBgSubModeId(BackgroundTaskSubmode::SUBMODE_WORK_OUT_NORMAL_NOTIFICATION);
     EXPECT_EQ(bgContinuousTaskMgr_->CheckSpecialNotificationText(notificationText, record,
         BackgroundMode::BLUETOOTH_INTERACTION), ERR_OK);
-    record->bgSubModeIds_.push_back(BackgroundTaskSubmode::SUBMODE_VIDEO_BROADCAST_NORMAL_NOTIFICATION);
+    record->AddBgSubModeId(BackgroundTaskSubmode::SUBMODE_VIDEO_BROADCAST_NORMAL_NOTIFICATION);
     EXPECT_EQ(bgContinuousTaskMgr_->CheckSpecialNotificationText(notificationText, record,
         BackgroundMode::BLUETOOTH_INTERACTION), ERR_OK);
-    record->bgSubModeIds_.push_back(BackgroundTaskSubmode::SUBMODE_MEDIA_PROCESS_NORMAL_NOTIFICATION);
+    record->AddBgSubModeId(BackgroundTaskSubmode::SUBMODE_MEDIA_PROCESS_NORMAL_NOTIFICATION);
     EXPECT_EQ(bgContinuousTaskMgr_->CheckSpecialNotificationText(notificationText, record,
         BackgroundMode::BLUETOOTH_INTERACTION), ERR_OK);
 }
@@ -2753,7 +2758,7 @@ HWTEST_F(BgContinuousTaskMgrTest, NotifyAudioStart_001, TestSize.Level1)
     continuousTaskRecord1->abilityName_ = "abilityName";
     continuousTaskRecord1->uid_ = 1;
     continuousTaskRecord1->bgModeId_ = BGMODE_AUDIO_PLAYBACK_ID;
-    continuousTaskRecord1->bgModeIds_.push_back(BGMODE_AUDIO_PLAYBACK_ID);
+    continuousTaskRecord1->AddBgModeId(BGMODE_AUDIO_PLAYBACK_ID);
     continuousTaskRecord1->notificationId_ = 1;
     continuousTaskRecord1->continuousTaskId_ = 1;
     continuousTaskRecord1->abilityId_ = 1;
@@ -2788,7 +2793,7 @@ HWTEST_F(BgContinuousTaskMgrTest, NotifyAudioStart_002, TestSize.Level1)
     continuousTaskRecord1->abilityName_ = "abilityName";
     continuousTaskRecord1->uid_ = 1;
     continuousTaskRecord1->bgModeId_ = BGMODE_AUDIO_PLAYBACK_ID;
-    continuousTaskRecord1->bgModeIds_.push_back(BGMODE_AUDIO_PLAYBACK_ID);
+    continuousTaskRecord1->AddBgModeId(BGMODE_AUDIO_PLAYBACK_ID);
     continuousTaskRecord1->notificationId_ = 1;
     continuousTaskRecord1->continuousTaskId_ = 1;
     continuousTaskRecord1->abilityId_ = 1;
@@ -2802,7 +2807,7 @@ HWTEST_F(BgContinuousTaskMgrTest, NotifyAudioStart_002, TestSize.Level1)
     continuousTaskRecord2->abilityName_ = "abilityName";
     continuousTaskRecord2->uid_ = 1;
     continuousTaskRecord2->bgModeId_ = BGMODE_AUDIO_PLAYBACK_ID;
-    continuousTaskRecord2->bgModeIds_.push_back(BGMODE_AUDIO_PLAYBACK_ID);
+    continuousTaskRecord2->AddBgModeId(BGMODE_AUDIO_PLAYBACK_ID);
     continuousTaskRecord2->notificationId_ = 1;
     continuousTaskRecord2->continuousTaskId_ = 1;
     continuousTaskRecord2->abilityId_ = 1;
@@ -3345,12 +3350,12 @@ HWTEST_F(BgContinuousTaskMgrTest, InitSubNotificationRecord_001, TestSize.Level1
     EXPECT_FALSE(ret);
 
     std::shared_ptr<ContinuousTaskRecord> record = std::make_shared<ContinuousTaskRecord>();
-    record->bgModeIds_.push_back(1);
-    record->bgModeIds_.push_back(2);
-    record->bgModeIds_.push_back(4);
-    record->bgSubModeIds_.push_back(1);
-    record->bgSubModeIds_.push_back(1);
-    record->bgSubModeIds_.push_back(1);
+    record->AddBgModeId(1);
+    record->AddBgModeId(2);
+    record->AddBgModeId(4);
+    record->AddBgSubModeId(1);
+    record->AddBgSubModeId(1);
+    record->AddBgSubModeId(1);
     ret = bgContinuousTaskMgr_->InitSubNotificationRecord(record, nullptr);
     EXPECT_FALSE(ret);
 
@@ -3533,7 +3538,7 @@ HWTEST_F(BgContinuousTaskMgrTest, UpdateDataTransferProgress_006, TestSize.Level
 
 /**
  * @tc.name: ContinuousTaskRecord_ProgressInfo_Json_001
- * @tc.desc: test ContinuousTaskRecord JSON round-trip with progressInfo.
+ * @tc.desc: test ContinuousTaskRecord JSON does not persist progressInfo and ignores a stale one.
  * @tc.type: FUNC
  */
 HWTEST_F(BgContinuousTaskMgrTest, ContinuousTaskRecord_ProgressInfo_Json_001, TestSize.Level1)
@@ -3546,14 +3551,13 @@ HWTEST_F(BgContinuousTaskMgrTest, ContinuousTaskRecord_ProgressInfo_Json_001, Te
     record->progressInfo_->SetIsMute(true);
 
     std::string jsonStr = record->ParseToJsonStr();
-    EXPECT_NE(jsonStr.find("\"progressInfo\""), std::string::npos);
+    EXPECT_EQ(jsonStr.find("\"progressInfo\""), std::string::npos);
 
     nlohmann::json root = nlohmann::json::parse(jsonStr);
+    record->progressInfo_->ParseToJson(root["progressInfo"]);
     auto readRecord = std::make_shared<ContinuousTaskRecord>();
     EXPECT_TRUE(readRecord->ParseFromJson(root));
-    EXPECT_EQ(readRecord->progressInfo_->GetTitle(), "downloading");
-    EXPECT_EQ(readRecord->progressInfo_->GetProgressValue(), 60);
-    EXPECT_TRUE(readRecord->progressInfo_->IsMute());
+    EXPECT_EQ(readRecord->progressInfo_, nullptr);
 }
 
 /**
@@ -3828,5 +3832,513 @@ HWTEST_F(BgContinuousTaskMgrTest, SendContinuousTaskNotification_InnerApiCompone
     record->isFromComponent_ = true;
     EXPECT_EQ(bgContinuousTaskMgr_->SendContinuousTaskNotification(record), ERR_OK);
 }
+
+/**
+ * @tc.name: ContinuousTaskRegistry_001
+ * @tc.desc: test ContinuousTaskRegistry keeps secondary index in sync with records.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgContinuousTaskMgrTest, ContinuousTaskRegistry_001, TestSize.Level1)
+{
+    ContinuousTaskRegistry registry;
+    auto record1 = CreateTestTaskRecord(100, "com.test", "MainAbility", BackgroundMode::AUDIO_PLAYBACK);
+    record1->abilityId_ = 1;
+    record1->continuousTaskId_ = 1;
+    auto record2 = CreateTestTaskRecord(100, "com.test", "SecondAbility", BackgroundMode::LOCATION);
+    record2->abilityId_ = 2;
+    record2->continuousTaskId_ = 2;
+    registry.emplace("key1", record1);
+    registry.emplace("key2", record2);
+    EXPECT_EQ((int32_t)registry.GetKeysByUid(100).size(), 2);
+    EXPECT_EQ((int32_t)registry.GetKeysByAbilityId(2).size(), 1);
+    EXPECT_TRUE(registry.HasUid(100));
+    EXPECT_EQ(registry.FindByTaskId(2)->first, "key2");
+
+    registry.erase(registry.find("key1"));
+    EXPECT_EQ((int32_t)registry.GetKeysByUid(100).size(), 1);
+    EXPECT_TRUE(registry.FindByTaskId(1) == registry.end());
+    EXPECT_EQ((int32_t)registry.erase("key2"), 1);
+    EXPECT_FALSE(registry.HasUid(100));
+
+    // 通过下标写入的记录在下次查询时建立索引
+    registry["key3"] = nullptr;
+    EXPECT_TRUE(registry.GetKeysByUid(-1).empty());
+    registry["key3"] = record1;
+    EXPECT_EQ(registry.FindByTaskId(1)->second, record1);
+    registry.GetMutableRecords().emplace("key4", record2);
+    EXPECT_EQ((int32_t)registry.GetKeysByUid(100).size(), 2);
+
+    registry.clear();
+    EXPECT_FALSE(registry.HasUid(100));
+    EXPECT_TRUE(registry.FindByTaskId(1) == registry.end());
+}
+
+/**
+ * @tc.name: ContinuousTaskRegistry_002
+ * @tc.desc: test uid and taskId lookup of BgContinuousTaskMgr with 1000 continuous tasks.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgContinuousTaskMgrTest, ContinuousTaskRegistry_002, TestSize.Level1)
+{
+    constexpr int32_t taskCount = 1000;
+    constexpr int32_t uidCount = 100;
+    bgContinuousTaskMgr_->continuousTaskInfosMap_.clear();
+    for (int32_t index = 0; index < taskCount; index++) {
+        auto record = CreateTestTaskRecord(index % uidCount, "com.test", "MainAbility",
+            BackgroundMode::DATA_TRANSFER);
+        record->abilityId_ = index;
+        record->continuousTaskId_ = index + 1;
+        record->isByRequestObject_ = true;
+        bgContinuousTaskMgr_->continuousTaskInfosMap_.emplace("key" + std::to_string(index), record);
+    }
+    auto startTime = std::chrono::steady_clock::now();
+    for (int32_t uid = 0; uid < uidCount; uid++) {
+        std::vector<std::shared_ptr<ContinuousTaskCallbackInfo>> list;
+        EXPECT_EQ(bgContinuousTaskMgr_->GetContinuousTaskAppsInner(list, uid, true), ERR_OK);
+        EXPECT_EQ((int32_t)list.size(), taskCount / uidCount);
+    }
+    auto costTime = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+    GTEST_LOG_(INFO) << "query " << uidCount << " uids in " << taskCount << " tasks cost " << costTime << "us";
+
+    for (int32_t index = 0; index < taskCount; index += TEST_NUM_TWO) {
+        EXPECT_EQ(bgContinuousTaskMgr_->StopBackgroundRunningInner(index % uidCount, "MainAbility", index, index + 1),
+            ERR_OK);
+    }
+    EXPECT_EQ((int32_t)bgContinuousTaskMgr_->continuousTaskInfosMap_.size(), taskCount / TEST_NUM_TWO);
+    bgContinuousTaskMgr_->RemoveContinuousTaskRecordByUid(1);
+    EXPECT_FALSE(bgContinuousTaskMgr_->continuousTaskInfosMap_.HasUid(1));
+    EXPECT_TRUE(bgContinuousTaskMgr_->continuousTaskInfosMap_.FindByTaskId(TEST_NUM_TWO) ==
+        bgContinuousTaskMgr_->continuousTaskInfosMap_.end());
+    bgContinuousTaskMgr_->continuousTaskInfosMap_.clear();
+}
+
+/**
+ * @tc.name: TaskSubscriberRegistry_001
+ * @tc.desc: test TaskSubscriberRegistry buckets subscribers by type, flag and uid.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgContinuousTaskMgrTest, TaskSubscriberRegistry_001, TestSize.Level1)
+{
+    TestBackgroundTaskSubscriber subscriber1 = TestBackgroundTaskSubscriber();
+    TestBackgroundTaskSubscriber subscriber2 = TestBackgroundTaskSubscriber();
+    TestBackgroundTaskSubscriber subscriber3 = TestBackgroundTaskSubscriber();
+    auto saInfo = std::make_shared<SubscriberInfo>(subscriber1.GetImpl(), TEST_NUM_ONE, TEST_NUM_ONE, false, 0);
+    auto stateInfo = std::make_shared<SubscriberInfo>(subscriber2.GetImpl(), TEST_NUM_TWO, TEST_NUM_TWO, true,
+        SUBSCRIBER_BACKGROUND_TASK_STATE);
+    auto hapInfo = std::make_shared<SubscriberInfo>(subscriber3.GetImpl(), TEST_NUM_TWO, TEST_NUM_TWO, true, 2);
+    TaskSubscriberRegistry registry;
+    registry.emplace_back(saInfo);
+    registry.emplace_back(stateInfo);
+    registry.emplace_back(hapInfo);
+    EXPECT_EQ((int32_t)registry.GetSaSubscribers().size(), 1);
+    EXPECT_EQ((int32_t)registry.GetStateSubscribers().size(), 1);
+    EXPECT_EQ((int32_t)registry.GetHapSubscribers(TEST_NUM_TWO).size(), 2);
+    EXPECT_TRUE(registry.GetHapSubscribers(TEST_NUM_ONE).empty());
+    EXPECT_TRUE(registry.HasHapSubscriber(TEST_NUM_TWO, 2));
+    EXPECT_FALSE(registry.HasHapSubscriber(TEST_NUM_TWO, 4));
+
+    auto iter = std::next(registry.begin(), TEST_NUM_TWO);
+    registry.UpdateFlag(iter, hapInfo->flag_ | SUBSCRIBER_BACKGROUND_TASK_STATE);
+    EXPECT_EQ((int32_t)registry.GetStateSubscribers().size(), 2);
+    registry.erase(registry.begin());
+    EXPECT_TRUE(registry.GetSaSubscribers().empty());
+    registry.clear();
+    EXPECT_TRUE(registry.GetStateSubscribers().empty());
+    EXPECT_FALSE(registry.HasHapSubscriber(TEST_NUM_TWO, 2));
+}
+
+/**
+ * @tc.name: TaskSubscriberRegistry_002
+ * @tc.desc: test subscriber flag changes of BgContinuousTaskMgr are visible to IsExistCallback.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgContinuousTaskMgrTest, TaskSubscriberRegistry_002, TestSize.Level1)
+{
+    bgContinuousTaskMgr_->bgTaskSubscribers_.clear();
+    TestBackgroundTaskSubscriber subscriber = TestBackgroundTaskSubscriber();
+    auto info = std::make_shared<SubscriberInfo>(subscriber.GetImpl(), TEST_NUM_ONE, TEST_NUM_ONE, true, 2);
+    EXPECT_EQ(bgContinuousTaskMgr_->AddSubscriberInner(info), ERR_OK);
+    EXPECT_TRUE(bgContinuousTaskMgr_->IsExistCallback(TEST_NUM_ONE, 2));
+    EXPECT_FALSE(bgContinuousTaskMgr_->IsExistCallback(TEST_NUM_ONE, 4));
+
+    auto newInfo = std::make_shared<SubscriberInfo>(subscriber.GetImpl(), TEST_NUM_ONE, TEST_NUM_ONE, true, 4);
+    EXPECT_EQ(bgContinuousTaskMgr_->AddSubscriberInner(newInfo), ERR_BGTASK_OBJECT_EXISTS);
+    EXPECT_TRUE(bgContinuousTaskMgr_->IsExistCallback(TEST_NUM_ONE, 4));
+
+    EXPECT_EQ(bgContinuousTaskMgr_->RemoveSubscriberInner(subscriber.GetImpl(), 2), ERR_OK);
+    EXPECT_FALSE(bgContinuousTaskMgr_->IsExistCallback(TEST_NUM_ONE, 2));
+    EXPECT_TRUE(bgContinuousTaskMgr_->IsExistCallback(TEST_NUM_ONE, 4));
+    EXPECT_EQ(bgContinuousTaskMgr_->RemoveSubscriberInner(subscriber.GetImpl(), 4), ERR_OK);
+    EXPECT_TRUE(bgContinuousTaskMgr_->bgTaskSubscribers_.empty());
+}
+
+/**
+ * @tc.name: SubscriberDeliveryQueue_001
+ * @tc.desc: test local subscriber is delivered inline and dump of SubscriberDeliveryQueue.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgContinuousTaskMgrTest, SubscriberDeliveryQueue_001, TestSize.Level1)
+{
+    auto deliveryQueue = DelayedSingleton<SubscriberDeliveryQueue>::GetInstance();
+    TestBackgroundTaskSubscriber subscriber = TestBackgroundTaskSubscriber();
+    int32_t deliverCount = 0;
+    auto task = [&deliverCount](const sptr<IBackgroundTaskSubscriber> &) { deliverCount++; };
+    deliveryQueue->Deliver(DeliveryModule::CONTINUOUS_TASK, nullptr, task);
+    deliveryQueue->Deliver(DeliveryModule::CONTINUOUS_TASK, subscriber.GetImpl(), nullptr);
+    EXPECT_EQ(deliverCount, 0);
+    for (int32_t i = 0; i < TEST_NUM_TWO; i++) {
+        deliveryQueue->Deliver(DeliveryModule::CONTINUOUS_TASK, subscriber.GetImpl(), task);
+    }
+    EXPECT_EQ(deliverCount, TEST_NUM_TWO);
+    EXPECT_TRUE(deliveryQueue->queues_.find(std::make_pair(DeliveryModule::CONTINUOUS_TASK,
+        subscriber.GetImpl()->AsObject().GetRefPtr())) == deliveryQueue->queues_.end());
+
+    deliveryQueue->RemoveSubscriber(DeliveryModule::CONTINUOUS_TASK, nullptr);
+    deliveryQueue->RemoveSubscriber(DeliveryModule::CONTINUOUS_TASK, subscriber.GetImpl()->AsObject());
+    std::vector<std::string> dumpInfo;
+    deliveryQueue->ShellDump(dumpInfo);
+    EXPECT_EQ((int32_t)dumpInfo.size(), 1);
+    EXPECT_NE(dumpInfo[0].find("subscriber delivery"), std::string::npos);
+}
+
+/**
+ * @tc.name: SubscriberDeliveryQueue_002
+ * @tc.desc: test queues are isolated per module and overflow only coalesces keyed update callbacks.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgContinuousTaskMgrTest, SubscriberDeliveryQueue_002, TestSize.Level1)
+{
+    auto deliveryQueue = DelayedSingleton<SubscriberDeliveryQueue>::GetInstance();
+    TestBackgroundTaskSubscriber subscriber = TestBackgroundTaskSubscriber();
+    sptr<IRemoteObject> remote = subscriber.GetImpl()->AsObject();
+    auto continuousQueue = std::make_shared<SubscriberDeliveryQueue::SubscriberQueue>();
+    continuousQueue->scheduled_ = true;
+    continuousQueue->tasks_.emplace_back(SubscriberDeliveryQueue::PendingTask {"", nullptr});
+    auto transientQueue = std::make_shared<SubscriberDeliveryQueue::SubscriberQueue>();
+    transientQueue->scheduled_ = true;
+    deliveryQueue->queues_[std::make_pair(DeliveryModule::CONTINUOUS_TASK, remote.GetRefPtr())] = continuousQueue;
+    deliveryQueue->queues_[std::make_pair(DeliveryModule::TRANSIENT_TASK, remote.GetRefPtr())] = transientQueue;
+
+    // 短时任务取消订阅不影响长时任务模块欠该订阅者的回调
+    deliveryQueue->RemoveSubscriber(DeliveryModule::TRANSIENT_TASK, remote);
+    EXPECT_TRUE(transientQueue->removed_);
+    EXPECT_FALSE(continuousQueue->removed_);
+    EXPECT_EQ((int32_t)continuousQueue->tasks_.size(), 1);
+
+    int32_t lastValue = 0;
+    auto updateTask = [&lastValue](int32_t value) {
+        return [&lastValue, value](const sptr<IBackgroundTaskSubscriber> &) { lastValue = value; };
+    };
+    continuousQueue->tasks_.emplace_back(SubscriberDeliveryQueue::PendingTask {"update_1", updateTask(1)});
+    continuousQueue->tasks_.emplace_back(SubscriberDeliveryQueue::PendingTask {"update_2", updateTask(TEST_NUM_TWO)});
+    EXPECT_TRUE(deliveryQueue->CoalesceLocked(continuousQueue, "update_1", updateTask(TEST_NUM_THREE)));
+    EXPECT_EQ((int32_t)continuousQueue->tasks_.size(), TEST_NUM_THREE);
+    continuousQueue->tasks_[1].task_(nullptr);
+    EXPECT_EQ(lastValue, TEST_NUM_THREE);
+    // 不能越过生命周期回调合并
+    continuousQueue->tasks_.emplace_back(SubscriberDeliveryQueue::PendingTask {"", nullptr});
+    EXPECT_FALSE(deliveryQueue->CoalesceLocked(continuousQueue, "update_1", updateTask(1)));
+    EXPECT_EQ((int32_t)continuousQueue->coalescedCount_, 1);
+
+    deliveryQueue->RemoveSubscriber(DeliveryModule::CONTINUOUS_TASK, remote);
+    EXPECT_TRUE(continuousQueue->removed_);
+    EXPECT_TRUE(deliveryQueue->queues_.find(std::make_pair(DeliveryModule::CONTINUOUS_TASK, remote.GetRefPtr())) ==
+        deliveryQueue->queues_.end());
+}
+
+/**
+ * @tc.name: SubscriberDeliveryQueue_003
+ * @tc.desc: test hanging subscriber is demoted while in flight and detached subscriber drops its backlog.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgContinuousTaskMgrTest, SubscriberDeliveryQueue_003, TestSize.Level1)
+{
+    auto deliveryQueue = DelayedSingleton<SubscriberDeliveryQueue>::GetInstance();
+    TestBackgroundTaskSubscriber subscriber = TestBackgroundTaskSubscriber();
+    sptr<IRemoteObject> remote = subscriber.GetImpl()->AsObject();
+    auto sharedWorker = deliveryQueue->GetWorkerLocked(0);
+    ASSERT_NE(sharedWorker, nullptr);
+    uint32_t dedicatedNum = deliveryQueue->dedicatedWorkerNum_;
+
+    auto hangingQueue = std::make_shared<SubscriberDeliveryQueue::SubscriberQueue>();
+    hangingQueue->workerIndex_ = 0;
+    hangingQueue->scheduled_ = true;
+    auto waitingQueue = std::make_shared<SubscriberDeliveryQueue::SubscriberQueue>();
+    waitingQueue->id_ = 1;
+    waitingQueue->workerIndex_ = 0;
+    waitingQueue->scheduled_ = true;
+    deliveryQueue->queues_[std::make_pair(DeliveryModule::CONTINUOUS_TASK, remote.GetRefPtr())] = hangingQueue;
+    deliveryQueue->queues_[std::make_pair(DeliveryModule::TRANSIENT_TASK, remote.GetRefPtr())] = waitingQueue;
+
+    // 回调未返回时看门狗立即降级，共享线程交给该订阅者独占，其他订阅者迁移到新线程
+    deliveryQueue->BeginCallLocked(hangingQueue);
+    deliveryQueue->CheckInFlightCall(hangingQueue, hangingQueue->callSeq_ + 1);
+    EXPECT_FALSE(hangingQueue->demoted_);
+    deliveryQueue->CheckInFlightCall(hangingQueue, hangingQueue->callSeq_);
+    EXPECT_TRUE(hangingQueue->demoted_);
+    EXPECT_EQ(hangingQueue->dedicatedWorker_, sharedWorker);
+    EXPECT_NE(deliveryQueue->GetWorkerLocked(0), sharedWorker);
+    EXPECT_FALSE(waitingQueue->scheduled_);
+    EXPECT_EQ(deliveryQueue->dedicatedWorkerNum_, dedicatedNum + 1);
+
+    deliveryQueue->EndCallLocked(hangingQueue, 0);
+    EXPECT_FALSE(hangingQueue->inFlight_);
+    EXPECT_TRUE(hangingQueue->demoted_);
+
+    // 超过硬上限的订阅者被摘除，积压全部丢弃
+    uint64_t dropped = deliveryQueue->totalDropped_;
+    waitingQueue->tasks_.emplace_back(SubscriberDeliveryQueue::PendingTask {"", nullptr});
+    deliveryQueue->DetachLocked(waitingQueue);
+    EXPECT_TRUE(waitingQueue->detached_);
+    EXPECT_TRUE(waitingQueue->tasks_.empty());
+    EXPECT_EQ(deliveryQueue->totalDropped_, dropped + 1);
+
+    deliveryQueue->RemoveSubscriber(DeliveryModule::CONTINUOUS_TASK, remote);
+    deliveryQueue->RemoveSubscriber(DeliveryModule::TRANSIENT_TASK, remote);
+    EXPECT_FALSE(hangingQueue->demoted_);
+    EXPECT_EQ(deliveryQueue->dedicatedWorkerNum_, dedicatedNum);
+}
+
+/**
+ * @tc.name: ProgressCoalescer_001
+ * @tc.desc: test ProgressCoalescer drop, merge and flush of progress updates.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgContinuousTaskMgrTest, ProgressCoalescer_001, TestSize.Level1)
+{
+    ProgressCoalescer coalescer;
+    coalescer.minInterval_ = 1000;
+    coalescer.significantDelta_ = 5;
+    auto progressInfo = std::make_shared<ProgressInfo>();
+    progressInfo->SetTitle("downloading");
+    progressInfo->SetProgressValue(10);
+    int64_t delayTime = -1;
+    EXPECT_TRUE(coalescer.OnProgressUpdate(1, progressInfo, false, delayTime));
+    coalescer.OnPublished(1, progressInfo);
+
+    EXPECT_FALSE(coalescer.OnProgressUpdate(1, progressInfo, false, delayTime));
+    EXPECT_EQ(delayTime, -1);
+    EXPECT_EQ((int32_t)coalescer.droppedCount_, 1);
+
+    // 变化不明显的更新可能是最后一次更新，间隔后补发
+    progressInfo->SetProgressValue(12);
+    EXPECT_FALSE(coalescer.OnProgressUpdate(1, progressInfo, false, delayTime));
+    EXPECT_EQ(delayTime, 1000);
+    progressInfo->SetProgressValue(30);
+    EXPECT_FALSE(coalescer.OnProgressUpdate(1, progressInfo, false, delayTime));
+    EXPECT_EQ(delayTime, -1);
+    progressInfo->SetProgressValue(40);
+    EXPECT_FALSE(coalescer.OnProgressUpdate(1, progressInfo, false, delayTime));
+    EXPECT_EQ(delayTime, -1);
+    EXPECT_EQ((int32_t)coalescer.mergedCount_, 3);
+    EXPECT_TRUE(coalescer.TakePending(1));
+    EXPECT_FALSE(coalescer.TakePending(1));
+    coalescer.OnPublished(1, progressInfo);
+
+    // 发布失败按退避间隔重试，超过重试次数后放弃并计入失败
+    coalescer.OnPublishFailed(1, delayTime);
+    EXPECT_EQ(delayTime, 1000);
+    coalescer.OnPublishFailed(1, delayTime);
+    EXPECT_EQ(delayTime, -1);
+    EXPECT_TRUE(coalescer.TakePending(1));
+    coalescer.OnPublishFailed(1, delayTime);
+    EXPECT_EQ(delayTime, 2000);
+    EXPECT_TRUE(coalescer.TakePending(1));
+    coalescer.OnPublishFailed(1, delayTime);
+    EXPECT_EQ(delayTime, 4000);
+    EXPECT_EQ((int32_t)coalescer.failedCount_, 0);
+    EXPECT_TRUE(coalescer.TakePending(1));
+    coalescer.OnPublishFailed(1, delayTime);
+    EXPECT_EQ(delayTime, -1);
+    EXPECT_EQ((int32_t)coalescer.failedCount_, 1);
+    EXPECT_FALSE(coalescer.TakePending(1));
+
+    coalescer.states_[1].lastPublishTime_ = 0;
+    progressInfo->SetProgressValue(100);
+    EXPECT_TRUE(coalescer.OnProgressUpdate(1, progressInfo, false, delayTime));
+    coalescer.RemoveIf([](int32_t taskId) { return taskId == 1; });
+    EXPECT_EQ((int32_t)coalescer.Size(), 0);
+    std::vector<std::string> dumpInfo;
+    coalescer.ShellDump(dumpInfo);
+    EXPECT_EQ((int32_t)dumpInfo.size(), 1);
+}
+
+/**
+ * @tc.name: ContinuousTaskSnapshot_001
+ * @tc.desc: test continuous task queries are served from the published snapshot until records change.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgContinuousTaskMgrTest, ContinuousTaskSnapshot_001, TestSize.Level1)
+{
+    bgContinuousTaskMgr_->isSysReady_.store(true);
+    bgContinuousTaskMgr_->continuousTaskInfosMap_.clear();
+    auto record1 = CreateTestTaskRecord(1, "com.test", "MainAbility", BackgroundMode::DATA_TRANSFER);
+    record1->continuousTaskId_ = 1;
+    auto record2 = CreateTestTaskRecord(2, "com.test2", "MainAbility", BackgroundMode::AUDIO_PLAYBACK);
+    record2->continuousTaskId_ = 2;
+    bgContinuousTaskMgr_->continuousTaskInfosMap_.emplace("key1", record1);
+    bgContinuousTaskMgr_->continuousTaskInfosMap_.emplace("key2", record2);
+    EXPECT_EQ(bgContinuousTaskMgr_->GetValidSnapshot(), nullptr);
+
+    std::vector<std::shared_ptr<ContinuousTaskCallbackInfo>> list1;
+    EXPECT_EQ(bgContinuousTaskMgr_->GetContinuousTaskApps(list1), ERR_OK);
+    EXPECT_EQ((int32_t)list1.size(), 2);
+    auto snapshot = bgContinuousTaskMgr_->GetValidSnapshot();
+    EXPECT_NE(snapshot, nullptr);
+
+    // 记录未变化时复用同一快照及查询结果
+    std::vector<std::shared_ptr<ContinuousTaskCallbackInfo>> list2;
+    EXPECT_EQ(bgContinuousTaskMgr_->GetContinuousTaskApps(list2), ERR_OK);
+    EXPECT_EQ(bgContinuousTaskMgr_->GetValidSnapshot(), snapshot);
+    EXPECT_EQ((int32_t)list2.size(), 2);
+    EXPECT_EQ(list2[0], list1[0]);
+    std::vector<std::shared_ptr<ContinuousTaskInfo>> tasks;
+    EXPECT_EQ(bgContinuousTaskMgr_->GetAllContinuousTasksBySystem(tasks), ERR_OK);
+    EXPECT_EQ((int32_t)tasks.size(), 2);
+    tasks.clear();
+    EXPECT_EQ(bgContinuousTaskMgr_->RequestGetContinuousTasksByUidForInner(2, tasks), ERR_OK);
+    EXPECT_EQ((int32_t)tasks.size(), 1);
+
+    record2->suspendState_ = true;
+    bgContinuousTaskMgr_->OnContinuousTaskChanged(record2, ContinuousTaskEventTriggerType::TASK_SUSPEND);
+    EXPECT_EQ(bgContinuousTaskMgr_->GetValidSnapshot(), nullptr);
+    std::vector<std::shared_ptr<ContinuousTaskCallbackInfo>> list3;
+    EXPECT_EQ(bgContinuousTaskMgr_->GetContinuousTaskApps(list3), ERR_OK);
+    EXPECT_EQ((int32_t)list3.size(), 1);
+    std::vector<std::shared_ptr<ContinuousTaskCallbackInfo>> list4;
+    EXPECT_EQ(bgContinuousTaskMgr_->GetAllContinuousTaskApps(list4), ERR_OK);
+    EXPECT_EQ((int32_t)list4.size(), 2);
+
+    bgContinuousTaskMgr_->continuousTaskInfosMap_.erase("key1");
+    std::vector<std::shared_ptr<ContinuousTaskCallbackInfo>> list5;
+    EXPECT_EQ(bgContinuousTaskMgr_->GetAllContinuousTaskApps(list5), ERR_OK);
+    EXPECT_EQ((int32_t)list5.size(), 1);
+    bgContinuousTaskMgr_->continuousTaskInfosMap_.clear();
+}
+
+/**
+ * @tc.name: BatchOperation_001
+ * @tc.desc: test batched stop/active/query continuous task operations return per item results.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgContinuousTaskMgrTest, BatchOperation_001, TestSize.Level1)
+{
+    std::vector<ContinuousTaskOperation> operations;
+    operations.emplace_back(1, 1, "key1");
+    operations.emplace_back(3, 3, "key3");
+    std::vector<int32_t> results;
+    bgContinuousTaskMgr_->isSysReady_.store(false);
+    EXPECT_EQ(bgContinuousTaskMgr_->StopContinuousTasks(operations, results), ERR_BGTASK_SYS_NOT_READY);
+    EXPECT_EQ((int32_t)results.size(), 2);
+
+    bgContinuousTaskMgr_->isSysReady_.store(true);
+    bgContinuousTaskMgr_->continuousTaskInfosMap_.clear();
+    auto record1 = CreateTestTaskRecord(1, "com.test", "MainAbility", BackgroundMode::DATA_TRANSFER);
+    auto record2 = CreateTestTaskRecord(2, "com.test2", "MainAbility", BackgroundMode::AUDIO_PLAYBACK);
+    bgContinuousTaskMgr_->continuousTaskInfosMap_.emplace("key1", record1);
+    bgContinuousTaskMgr_->continuousTaskInfosMap_.emplace("key2", record2);
+
+    std::vector<int32_t> uids = {1, 2, 1, 3};
+    std::vector<std::shared_ptr<ContinuousTaskInfo>> tasks;
+    EXPECT_EQ(bgContinuousTaskMgr_->RequestGetContinuousTasksByUidsForInner(uids, tasks), ERR_OK);
+    EXPECT_EQ((int32_t)tasks.size(), 2);
+
+    EXPECT_EQ(bgContinuousTaskMgr_->ActiveContinuousTasks(operations, results), ERR_OK);
+    EXPECT_EQ((int32_t)results.size(), 2);
+    EXPECT_EQ(results[0], ERR_OK);
+    EXPECT_EQ(results[1], ERR_BGTASK_OBJECT_NOT_EXIST);
+
+    // key 与 uid 不匹配的操作不生效
+    std::vector<ContinuousTaskOperation> stopOperations;
+    stopOperations.emplace_back(1, 1, "key2");
+    EXPECT_EQ(bgContinuousTaskMgr_->StopContinuousTasks(stopOperations, results), ERR_OK);
+    EXPECT_EQ(results[0], ERR_BGTASK_OBJECT_NOT_EXIST);
+    EXPECT_EQ((int32_t)bgContinuousTaskMgr_->continuousTaskInfosMap_.size(), 2);
+    EXPECT_EQ(bgContinuousTaskMgr_->batchDepth_, 0);
+    EXPECT_TRUE(bgContinuousTaskMgr_->batchStoppedUids_.empty());
+    bgContinuousTaskMgr_->continuousTaskInfosMap_.clear();
+}
+
+/**
+ * @tc.name: BatchOperation_002
+ * @tc.desc: test subscriber callbacks inside a batch are coalesced into one delivery per subscriber.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgContinuousTaskMgrTest, BatchOperation_002, TestSize.Level1)
+{
+    bgContinuousTaskMgr_->bgTaskSubscribers_.clear();
+    TestBackgroundTaskSubscriber subscriber = TestBackgroundTaskSubscriber();
+    auto info = std::make_shared<SubscriberInfo>(subscriber.GetImpl(), TEST_NUM_ONE, TEST_NUM_ONE, false, 0);
+    bgContinuousTaskMgr_->bgTaskSubscribers_.emplace_back(info);
+    auto record1 = CreateTestTaskRecord(1, "com.test", "MainAbility", BackgroundMode::DATA_TRANSFER);
+    auto record2 = CreateTestTaskRecord(2, "com.test2", "MainAbility", BackgroundMode::AUDIO_PLAYBACK);
+    {
+        BgContinuousTaskMgr::BatchOperationScope batchScope(*bgContinuousTaskMgr_);
+        bgContinuousTaskMgr_->OnContinuousTaskChanged(record1, ContinuousTaskEventTriggerType::TASK_CANCEL);
+        bgContinuousTaskMgr_->OnContinuousTaskChanged(record2, ContinuousTaskEventTriggerType::TASK_CANCEL);
+        // 同一任务的多次更新只保留最新一次
+        bgContinuousTaskMgr_->OnContinuousTaskChanged(record1, ContinuousTaskEventTriggerType::TASK_UPDATE);
+        bgContinuousTaskMgr_->OnContinuousTaskChanged(record1, ContinuousTaskEventTriggerType::TASK_UPDATE);
+        EXPECT_EQ((int32_t)bgContinuousTaskMgr_->batchDeliveries_.size(), 1);
+        EXPECT_EQ((int32_t)bgContinuousTaskMgr_->batchDeliveries_[0].tasks_.size(), 3);
+    }
+    EXPECT_FALSE(bgContinuousTaskMgr_->isCollectingDeliveries_);
+    EXPECT_TRUE(bgContinuousTaskMgr_->batchDeliveries_.empty());
+    bgContinuousTaskMgr_->bgTaskSubscribers_.clear();
+}
+
+/**
+ * @tc.name: BatchOperationScope_001
+ * @tc.desc: test nested batch operation scope defers persistence until the outermost scope ends.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgContinuousTaskMgrTest, BatchOperationScope_001, TestSize.Level1)
+{
+    bgContinuousTaskMgr_->continuousTaskInfosMap_.clear();
+    {
+        BgContinuousTaskMgr::BatchOperationScope outerScope(*bgContinuousTaskMgr_);
+        {
+            BgContinuousTaskMgr::BatchOperationScope innerScope(*bgContinuousTaskMgr_);
+            EXPECT_EQ(bgContinuousTaskMgr_->batchDepth_, TEST_NUM_TWO);
+            EXPECT_EQ(bgContinuousTaskMgr_->RefreshTaskRecord("key1"), ERR_OK);
+            bgContinuousTaskMgr_->HandleAppContinuousTaskStop(1);
+        }
+        EXPECT_EQ(bgContinuousTaskMgr_->batchDepth_, 1);
+        EXPECT_TRUE(bgContinuousTaskMgr_->batchRecordDirty_);
+        EXPECT_EQ((int32_t)bgContinuousTaskMgr_->batchStoppedUids_.size(), 1);
+    }
+    EXPECT_EQ(bgContinuousTaskMgr_->batchDepth_, 0);
+    EXPECT_FALSE(bgContinuousTaskMgr_->batchRecordDirty_);
+    EXPECT_TRUE(bgContinuousTaskMgr_->batchStoppedUids_.empty());
+}
+
+/**
+ * @tc.name: BatchOperationScope_002
+ * @tc.desc: benchmark clearing 200 continuous tasks of inactive os accounts in one sweep.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgContinuousTaskMgrTest, BatchOperationScope_002, TestSize.Level1)
+{
+    constexpr int32_t taskCount = 200;
+    constexpr int32_t inactiveUserId = 101;
+    bgContinuousTaskMgr_->continuousTaskInfosMap_.clear();
+    for (int32_t index = 0; index < taskCount; index++) {
+        auto record = CreateTestTaskRecord(index, "com.test", "MainAbility",
+            static_cast<uint32_t>(BackgroundMode::AUDIO_PLAYBACK));
+        record->userId_ = inactiveUserId;
+        record->abilityId_ = index;
+        bgContinuousTaskMgr_->continuousTaskInfosMap_.emplace("key" + std::to_string(index), record);
+    }
+    std::vector<int32_t> activatedOsAccountIds = {DEFAULT_USERID};
+    auto startTime = std::chrono::steady_clock::now();
+    bgContinuousTaskMgr_->ClearBgOsAccountTask(activatedOsAccountIds);
+    auto costTime = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+    GTEST_LOG_(INFO) << "clear " << taskCount << " tasks of inactive account cost " << costTime << "us";
+    EXPECT_TRUE(bgContinuousTaskMgr_->continuousTaskInfosMap_.empty());
+    EXPECT_EQ(bgContinuousTaskMgr_->batchDepth_, 0);
+    EXPECT_FALSE(bgContinuousTaskMgr_->batchRecordDirty_);
+}
 }  // namespace BackgroundTaskMgr
 }  // namespace OHOS
\ No newline at end of file
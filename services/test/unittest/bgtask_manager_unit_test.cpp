@@ -551,7 +551,7 @@ HWTEST_F(BgTaskManagerUnitTest, BgTaskManagerUnitTest_043, TestSize.Level1)
         bundleName = SCB_BUNDLE_NAME;
         uid = GetUidByBundleName(bundleName, DEFAULT_USERID);
     }
-    bgTransientTaskMgr_->decisionMaker_->foregroundUidPidMap_[uid].insert(1);
+    bgTransientTaskMgr_->decisionMaker_->appStateTable_.UpdateForegroundPid(uid, 1, true);
     EXPECT_NE(bgTransientTaskMgr_->PauseTransientTaskTimeForInner(uid), ERR_OK);
 }
 
@@ -579,7 +579,7 @@ HWTEST_F(BgTaskManagerUnitTest, BgTaskManagerUnitTest_044, TestSize.Level1)
         bundleName = SCB_BUNDLE_NAME;
         uid = GetUidByBundleName(bundleName, DEFAULT_USERID);
     }
-    bgTransientTaskMgr_->decisionMaker_->foregroundUidPidMap_[uid].insert(1);
+    bgTransientTaskMgr_->decisionMaker_->appStateTable_.UpdateForegroundPid(uid, 1, true);
     EXPECT_NE(bgTransientTaskMgr_->StartTransientTaskTimeForInner(uid), ERR_OK);
 }
 
@@ -1192,5 +1192,37 @@ HWTEST_F(BgTaskManagerUnitTest, BgTaskManagerUnitTest_067, TestSize.Level2)
     bgTransientTaskMgr_->NotifyTransientTaskSuscriber(invalidTaskInfo2, TransientTaskEventType::APP_TASK_END);
     EXPECT_FALSE(BackgroundTaskObserver::GetInstance().CheckTransientTaskAppInfo(invalidTaskInfo2));
 }
+
+/**
+ * @tc.name: BgTaskManagerUnitTest_068
+ * @tc.desc: test ExpiredCallbackRegistry remote index.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskManagerUnitTest, BgTaskManagerUnitTest_068, TestSize.Level2)
+{
+    sptr<TestExpiredCallbackStub> expiredCallbackStub1 = sptr<TestExpiredCallbackStub>(new TestExpiredCallbackStub());
+    sptr<TestExpiredCallbackStub> expiredCallbackStub2 = sptr<TestExpiredCallbackStub>(new TestExpiredCallbackStub());
+    sptr<ExpiredCallbackProxy> proxy1 = sptr<ExpiredCallbackProxy>(
+        new ExpiredCallbackProxy(expiredCallbackStub1->AsObject()));
+    sptr<ExpiredCallbackProxy> proxy2 = sptr<ExpiredCallbackProxy>(
+        new ExpiredCallbackProxy(expiredCallbackStub2->AsObject()));
+    ExpiredCallbackRegistry registry;
+    registry.emplace(1, proxy1);
+    EXPECT_TRUE(registry.ContainsRemote(proxy1->AsObject()));
+    EXPECT_FALSE(registry.ContainsRemote(proxy2->AsObject()));
+    EXPECT_EQ(registry.FindByRemote(proxy1->AsObject())->first, 1);
+
+    EXPECT_TRUE(registry.AddPendingRemote(proxy2->AsObject()));
+    EXPECT_FALSE(registry.AddPendingRemote(proxy2->AsObject()));
+    registry.RemovePendingRemote(proxy2->AsObject());
+    EXPECT_FALSE(registry.ContainsRemote(proxy2->AsObject()));
+
+    registry[2] = proxy2;
+    EXPECT_EQ(registry.FindByRemote(proxy2->AsObject())->first, 2);
+    registry.erase(1);
+    EXPECT_TRUE(registry.FindByRemote(proxy1->AsObject()) == registry.end());
+    registry.clear();
+    EXPECT_TRUE(registry.FindByRemote(proxy2->AsObject()) == registry.end());
+}
 }
 }
@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <atomic>
 #include <functional>
 #include <chrono>
 #include <thread>
@@ -26,6 +27,7 @@
 #include "bg_efficiency_resources_mgr.h"
 #include "bundle_info.h"
 #include "bundle_manager_helper.h"
+#include "bundle_name_cache.h"
 #include "common_event_data.h"
 #include "continuous_task_record.h"
 #include "decision_maker.h"
@@ -34,6 +36,9 @@
 #include "event_info.h"
 #include "event_handler.h"
 #include "event_runner.h"
+#include "file_ex.h"
+#include "bgtask_config.h"
+#include "bg_mode_set.h"
 #include "input_manager.h"
 #include "key_info.h"
 #ifdef DISTRIBUTED_NOTIFICATION_ENABLE
@@ -43,6 +48,7 @@
 #include "task_notification_subscriber.h"
 #endif
 #include "notification_tools.h"
+#include "parameters.h"
 #include "pkg_delay_suspend_info.h"
 #include "process_data.h"
 #include "singleton.h"
@@ -50,6 +56,7 @@
 #include "suspend_controller.h"
 #include "time_provider.h"
 #include "timer_manager.h"
+#include "timer_wheel.h"
 #include "watchdog.h"
 #include "int_wrapper.h"
 #include "common_utils.h"
@@ -63,6 +70,8 @@ namespace OHOS {
 extern void SetPublishContinuousTaskNotificationFlag(int32_t flag);
 extern void SetCancelContinuousTaskNotificationFlag(int32_t flag);
 extern void SetGetAllActiveNotificationsFlag(int32_t flag);
+extern void SetPublishNotificationResult(int32_t result);
+extern int32_t GetPublishNotificationCount();
 
 namespace BackgroundTaskMgr {
 namespace {
@@ -73,6 +82,73 @@ static constexpr int32_t TEST_NUM_ONE = 1;
 #endif
 static constexpr int32_t TEST_NUM_TWO = 2;
 static constexpr int32_t MIN_ALLOW_QUOTA_TIME = 10 * MSEC_PER_SEC; // 10s
+static constexpr int32_t SOAK_STATE_MAX_SIZE = 64;
+static constexpr int32_t SOAK_DAYS = 180;
+static constexpr int32_t SOAK_APPS_PER_DAY = 40;
+static constexpr int32_t SOAK_APP_POOL_SIZE = 2000;
+static constexpr int32_t SOAK_ACTIVE_APP_INTERVAL = 10;
+static constexpr int32_t SOAK_USED_QUOTA_APP_INTERVAL = 3;
+static constexpr char SPLIT_RUNNER_PARAM[] = "persist.sys.bgtask_split_runner";
+static constexpr int32_t JITTER_TIMER_NUM = 10;
+static constexpr int64_t JITTER_TIMER_INTERVAL = 100;
+static constexpr int64_t JITTER_CHURN_TIME = 200;
+
+class BenchmarkEventHandler : public AppExecFwk::EventHandler {
+public:
+    explicit BenchmarkEventHandler(const std::shared_ptr<AppExecFwk::EventRunner> &runner)
+        : AppExecFwk::EventHandler(runner) {}
+    void ProcessEvent(const AppExecFwk::InnerEvent::Pointer &event) override
+    {
+        processCount_++;
+    }
+
+    std::atomic<int32_t> processCount_ {0};
+};
+
+class ParameterGuard {
+public:
+    ParameterGuard(const std::string &key, const std::string &defaultValue)
+        : key_(key), value_(OHOS::system::GetParameter(key, defaultValue)) {}
+    ~ParameterGuard()
+    {
+        OHOS::system::SetParameter(key_, value_);
+    }
+
+private:
+    std::string key_;
+    std::string value_;
+};
+
+// 在长时任务线程上持续模拟通知发布和持久化写入，返回短时任务到期回调的最大抖动
+int64_t MeasureExpiryJitter(const std::shared_ptr<AppExecFwk::EventRunner> &transientRunner,
+    const std::shared_ptr<AppExecFwk::EventRunner> &continuousRunner, int32_t baseId)
+{
+    auto transientHandler = std::make_shared<AppExecFwk::EventHandler>(transientRunner);
+    auto continuousHandler = std::make_shared<AppExecFwk::EventHandler>(continuousRunner);
+    for (int32_t i = 0; i <= JITTER_TIMER_NUM; i++) {
+        continuousHandler->PostTask([]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(JITTER_CHURN_TIME));
+        });
+    }
+    auto maxJitter = std::make_shared<std::atomic<int64_t>>(0);
+    auto expiredNum = std::make_shared<std::atomic<int32_t>>(0);
+    int64_t beginTime = TimeProvider::GetCurrentTime(ClockType::CLOCK_TYPE_MONOTONIC);
+    for (int32_t i = 1; i <= JITTER_TIMER_NUM; i++) {
+        int64_t expectTime = beginTime + i * JITTER_TIMER_INTERVAL;
+        auto task = [maxJitter, expiredNum, expectTime]() {
+            int64_t jitter = TimeProvider::GetCurrentTime(ClockType::CLOCK_TYPE_MONOTONIC) - expectTime;
+            if (jitter > maxJitter->load()) {
+                maxJitter->store(jitter);
+            }
+            (*expiredNum)++;
+        };
+        DelayedSingleton<TimerWheel>::GetInstance()->AddTimer(TimerWheelModule::TRANSIENT_TASK_EXPIRED,
+            baseId + i, i * JITTER_TIMER_INTERVAL, task, transientHandler);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds((JITTER_TIMER_NUM + 1) * JITTER_CHURN_TIME + SLEEP_TIME));
+    EXPECT_EQ(expiredNum->load(), JITTER_TIMER_NUM);
+    return maxJitter->load();
+}
 }
 
 class BgTaskMiscUnitTest : public testing::Test {
@@ -274,6 +350,34 @@ HWTEST_F(BgTaskMiscUnitTest, ContinuousTaskRecordTest_001, TestSize.Level2)
     EXPECT_TRUE(record4.ParseFromJson(json5));
 }
 
+/**
+ * @tc.name: ContinuousTaskRecordTest_002
+ * @tc.desc: test ContinuousTaskRecord ParseToJson.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskMiscUnitTest, ContinuousTaskRecordTest_002, TestSize.Level2)
+{
+    ContinuousTaskRecord record = ContinuousTaskRecord();
+    record.wantAgentInfo_ = std::make_shared<WantAgentInfo>();
+    record.progressInfo_ = std::make_shared<ProgressInfo>();
+    record.progressInfo_->SetTitle("title");
+    nlohmann::json json1;
+    record.ParseToJson(json1);
+    EXPECT_EQ(json1, nlohmann::json::parse(record.ParseToJsonStr(), nullptr, false));
+    ContinuousTaskRecord record2 = ContinuousTaskRecord();
+    EXPECT_TRUE(record2.ParseFromJson(json1));
+    EXPECT_NE(record2.progressInfo_, nullptr);
+
+    BannerNotificationRecord bannerRecord = BannerNotificationRecord();
+    bannerRecord.SetBundleName("bundleName");
+    nlohmann::json json2;
+    bannerRecord.ParseToJson(json2);
+    EXPECT_EQ(json2, nlohmann::json::parse(bannerRecord.ParseToJsonStr(), nullptr, false));
+    BannerNotificationRecord bannerRecord2 = BannerNotificationRecord();
+    EXPECT_TRUE(bannerRecord2.ParseFromJson(json2));
+    EXPECT_EQ(bannerRecord2.GetBundleName(), "bundleName");
+}
+
 /**
  * @tc.name: NotificationToolsTest_001
  * @tc.desc: test NotificationTools class.
@@ -395,9 +499,10 @@ HWTEST_F(BgTaskMiscUnitTest, DecisionMakerTest_001, TestSize.Level2)
 
     auto keyInfo = std::make_shared<KeyInfo>("bundleName1", 1);
     auto delayInfo = std::make_shared<DelaySuspendInfoEx>(1);
-    decisionMaker->pkgBgDurationMap_[keyInfo] = TimeProvider::GetCurrentTime() - ALLOW_REQUEST_TIME_BG - 1;
+    decisionMaker->appStateTable_.SetBgStartTime(keyInfo->GetPkg(), keyInfo->GetUid(),
+        TimeProvider::GetCurrentTime() - ALLOW_REQUEST_TIME_BG - 1);
     EXPECT_EQ(decisionMaker->Decide(keyInfo, delayInfo), ERR_BGTASK_NOT_IN_PRESET_TIME);
-    decisionMaker->pkgBgDurationMap_[keyInfo] = TimeProvider::GetCurrentTime();
+    decisionMaker->appStateTable_.SetBgStartTime(keyInfo->GetPkg(), keyInfo->GetUid(), TimeProvider::GetCurrentTime());
     EXPECT_EQ(decisionMaker->Decide(keyInfo, nullptr), ERR_BGTASK_NO_MEMORY);
 
     auto keyInfo2 = std::make_shared<KeyInfo>("bundleName2", 2);
@@ -408,12 +513,12 @@ HWTEST_F(BgTaskMiscUnitTest, DecisionMakerTest_001, TestSize.Level2)
     pkgDelaySuspendInfo->requestList_.push_back(delayInfo1);
     pkgDelaySuspendInfo->requestList_.push_back(delayInfo2);
     pkgDelaySuspendInfo->requestList_.push_back(delayInfo3);
-    decisionMaker->pkgDelaySuspendInfoMap_[keyInfo2] = pkgDelaySuspendInfo;
+    decisionMaker->appStateTable_.SetDelayInfo(keyInfo2->GetPkg(), keyInfo2->GetUid(), pkgDelaySuspendInfo);
     EXPECT_EQ(decisionMaker->Decide(keyInfo2, delayInfo1), ERR_BGTASK_EXCEEDS_THRESHOLD);
-    decisionMaker->pkgDelaySuspendInfoMap_.clear();
+    decisionMaker->appStateTable_.ClearDelayInfo();
     deviceInfoManeger->isScreenOn_ = true;
     EXPECT_EQ(decisionMaker->Decide(keyInfo, delayInfo1), ERR_OK);
-    decisionMaker->pkgDelaySuspendInfoMap_.clear();
+    decisionMaker->appStateTable_.ClearDelayInfo();
     deviceInfoManeger->isScreenOn_ = false;
     EXPECT_EQ(decisionMaker->Decide(keyInfo, delayInfo1), ERR_OK);
 }
@@ -439,21 +544,21 @@ HWTEST_F(BgTaskMiscUnitTest, DecisionMakerTest_002, TestSize.Level2)
     auto pkgDelaySuspendInfo = std::make_shared<PkgDelaySuspendInfo>("bundleName1", 1, timerManager);
     auto delayInfo1 = std::make_shared<DelaySuspendInfoEx>(1);
     pkgDelaySuspendInfo->requestList_.push_back(delayInfo1);
-    decisionMaker->pkgDelaySuspendInfoMap_[keyInfo] = pkgDelaySuspendInfo;
+    decisionMaker->appStateTable_.SetDelayInfo(keyInfo->GetPkg(), keyInfo->GetUid(), pkgDelaySuspendInfo);
     decisionMaker->RemoveRequest(keyInfo, -1);
     decisionMaker->RemoveRequest(keyInfo, 1);
 
-    decisionMaker->pkgDelaySuspendInfoMap_.clear();
+    decisionMaker->appStateTable_.ClearDelayInfo();
     EXPECT_EQ(decisionMaker->GetRemainingDelayTime(nullptr, -1), -1);
     EXPECT_EQ(decisionMaker->GetRemainingDelayTime(nullptr, -1), -1);
-    decisionMaker->pkgDelaySuspendInfoMap_[keyInfo] = pkgDelaySuspendInfo;
+    decisionMaker->appStateTable_.SetDelayInfo(keyInfo->GetPkg(), keyInfo->GetUid(), pkgDelaySuspendInfo);
     EXPECT_EQ(decisionMaker->GetRemainingDelayTime(keyInfo, -1), 0);
 
     EXPECT_EQ(decisionMaker->GetQuota(nullptr), -1);
-    decisionMaker->pkgDelaySuspendInfoMap_.clear();
+    decisionMaker->appStateTable_.ClearDelayInfo();
     EXPECT_EQ(decisionMaker->GetQuota(keyInfo), INIT_QUOTA);
     pkgDelaySuspendInfo->quota_ = -1;
-    decisionMaker->pkgDelaySuspendInfoMap_[keyInfo] = pkgDelaySuspendInfo;
+    decisionMaker->appStateTable_.SetDelayInfo(keyInfo->GetPkg(), keyInfo->GetUid(), pkgDelaySuspendInfo);
     EXPECT_EQ(decisionMaker->GetQuota(keyInfo), 0);
     EXPECT_FALSE(decisionMaker->IsFrontApp("pkgName", 1));
 
@@ -464,11 +569,11 @@ HWTEST_F(BgTaskMiscUnitTest, DecisionMakerTest_002, TestSize.Level2)
     decisionMaker->lastRequestTime_ = TimeProvider::GetCurrentTime() - 1;
     decisionMaker->ResetDayQuotaLocked();
     decisionMaker->lastRequestTime_ = TimeProvider::GetCurrentTime() - QUOTA_UPDATE - 1;
-    decisionMaker->pkgDelaySuspendInfoMap_.clear();
-    decisionMaker->pkgDelaySuspendInfoMap_[keyInfo] = pkgDelaySuspendInfo;
+    decisionMaker->appStateTable_.ClearDelayInfo();
+    decisionMaker->appStateTable_.SetDelayInfo(keyInfo->GetPkg(), keyInfo->GetUid(), pkgDelaySuspendInfo);
     auto keyInfo2 = std::make_shared<KeyInfo>("bundleName2", TEST_NUM_TWO);
     auto pkgDelaySuspendInfo2 = std::make_shared<PkgDelaySuspendInfo>("bundleName2", TEST_NUM_TWO, timerManager);
-    decisionMaker->pkgDelaySuspendInfoMap_[keyInfo2] = pkgDelaySuspendInfo2;
+    decisionMaker->appStateTable_.SetDelayInfo(keyInfo2->GetPkg(), keyInfo2->GetUid(), pkgDelaySuspendInfo2);
     decisionMaker->ResetDayQuotaLocked();
 
     EventInfo eventInfo = EventInfo();
@@ -478,7 +583,7 @@ HWTEST_F(BgTaskMiscUnitTest, DecisionMakerTest_002, TestSize.Level2)
     decisionMaker->OnInputEvent(eventInfo);
     eventInfo.eventId_ = EVENT_SCREEN_UNLOCK;
     decisionMaker->OnInputEvent(eventInfo);
-    decisionMaker->pkgDelaySuspendInfoMap_[keyInfo2] = pkgDelaySuspendInfo2;
+    decisionMaker->appStateTable_.SetDelayInfo(keyInfo2->GetPkg(), keyInfo2->GetUid(), pkgDelaySuspendInfo2);
     eventInfo.eventId_ = EVENT_SCREEN_OFF;
     decisionMaker->OnInputEvent(eventInfo);
 }
@@ -606,6 +711,43 @@ HWTEST_F(BgTaskMiscUnitTest, PkgDelaySuspendInfoTest_002, TestSize.Level2)
     EXPECT_TRUE(true);
 }
 
+/**
+ * @tc.name: PkgDelaySuspendInfoTest_003
+ * @tc.desc: test PkgDelaySuspendInfo caches exemption list membership per config version but not signature.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskMiscUnitTest, PkgDelaySuspendInfoTest_003, TestSize.Level2)
+{
+    auto bgtaskService = sptr<BackgroundTaskMgrService>(new BackgroundTaskMgrService());
+    auto timerManager =
+        std::make_shared<TimerManager>(bgtaskService, AppExecFwk::EventRunner::Create("tdd_test_handler"));
+    auto pkgDelaySuspendInfo = std::make_shared<PkgDelaySuspendInfo>("bundleName1", 1, timerManager);
+    auto config = DelayedSingleton<BgtaskConfig>::GetInstance();
+    EXPECT_EQ(pkgDelaySuspendInfo->GetExemptedQuota(), 0);
+    EXPECT_TRUE(pkgDelaySuspendInfo->exemptionResolved_);
+    EXPECT_FALSE(pkgDelaySuspendInfo->exemptionListed_);
+    EXPECT_EQ(pkgDelaySuspendInfo->exemptionVersion_, config->GetTransientConfigVersion());
+
+    // 版本未变化时名单结果走缓存，签名仍每次校验
+    pkgDelaySuspendInfo->exemptionListed_ = true;
+    pkgDelaySuspendInfo->exemptedQuota_ = 1;
+    EXPECT_EQ(pkgDelaySuspendInfo->GetExemptedQuota(), config->CheckSignature("bundleName1") ? 1 : 0);
+    EXPECT_TRUE(pkgDelaySuspendInfo->exemptionListed_);
+    EXPECT_EQ(pkgDelaySuspendInfo->exemptedQuota_, 1);
+
+    config->transientConfigVersion_++;
+    EXPECT_EQ(pkgDelaySuspendInfo->GetExemptedQuota(), 0);
+    EXPECT_FALSE(pkgDelaySuspendInfo->exemptionListed_);
+    EXPECT_EQ(pkgDelaySuspendInfo->exemptedQuota_, 0);
+    EXPECT_EQ(pkgDelaySuspendInfo->exemptionVersion_, config->GetTransientConfigVersion());
+
+    auto delayInfo = std::make_shared<DelaySuspendInfoEx>(1, 1);
+    pkgDelaySuspendInfo->AddRequest(delayInfo, 1);
+    const auto &requestList = pkgDelaySuspendInfo->GetRequestList();
+    EXPECT_EQ(&requestList, &pkgDelaySuspendInfo->requestList_);
+    EXPECT_EQ((int32_t)requestList.size(), 1);
+}
+
 /**
  * @tc.name: SuspendControllerTest_001
  * @tc.desc: test SuspendController.
@@ -640,8 +782,6 @@ HWTEST_F(BgTaskMiscUnitTest, DataStorageHelper_001, TestSize.Level2)
     std::unordered_map<std::string, std::shared_ptr<ContinuousTaskRecord>> continuousTaskInfosMap2;
     EXPECT_EQ(DelayedSingleton<DataStorageHelper>::GetInstance()->RestoreTaskRecord(continuousTaskInfosMap2),
         ERR_OK);
-    EXPECT_EQ(DelayedSingleton<DataStorageHelper>::GetInstance()->SaveJsonValueToFile("", ""),
-        ERR_BGTASK_GET_ACTUAL_FILE_ERR);
     nlohmann::json json1;
     EXPECT_EQ(DelayedSingleton<DataStorageHelper>::GetInstance()->ParseJsonValueFromFile(json1, ""),
         ERR_BGTASK_DATA_STORAGE_ERR);
@@ -666,6 +806,162 @@ HWTEST_F(BgTaskMiscUnitTest, DataStorageHelper_002, TestSize.Level2)
     EXPECT_FALSE(DelayedSingleton<DataStorageHelper>::GetInstance()->ParseFastSuspendDozeTime(file, time));
 }
 
+/**
+ * @tc.name: DataStorageHelper_003
+ * @tc.desc: test continuous task record journal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskMiscUnitTest, DataStorageHelper_003, TestSize.Level2)
+{
+    auto dataStorageHelper = DelayedSingleton<DataStorageHelper>::GetInstance();
+    std::unordered_map<std::string, std::shared_ptr<ContinuousTaskRecord>> allRecord;
+    auto record1 = std::make_shared<ContinuousTaskRecord>();
+    record1->uid_ = 1;
+    allRecord.emplace("key1", record1);
+    EXPECT_EQ(dataStorageHelper->RefreshTaskRecord(allRecord), ERR_OK);
+    EXPECT_EQ(dataStorageHelper->taskJournalCount_.load(), 0);
+
+    // 新增和删除只追加增量记录
+    auto record2 = std::make_shared<ContinuousTaskRecord>();
+    record2->uid_ = TEST_NUM_TWO;
+    allRecord.emplace("key2", record2);
+    EXPECT_EQ(dataStorageHelper->RefreshTaskRecord("key2", allRecord), ERR_OK);
+    allRecord.erase("key1");
+    EXPECT_EQ(dataStorageHelper->RefreshTaskRecord("key1", allRecord), ERR_OK);
+    EXPECT_EQ(dataStorageHelper->taskJournalCount_.load(), TEST_NUM_TWO);
+
+    // 重启后全量数据与增量记录合并
+    std::unordered_map<std::string, std::shared_ptr<ContinuousTaskRecord>> restoreRecord;
+    EXPECT_EQ(dataStorageHelper->RestoreTaskRecord(restoreRecord), ERR_OK);
+    EXPECT_EQ(restoreRecord.size(), 1);
+    EXPECT_TRUE(restoreRecord.find("key1") == restoreRecord.end());
+    EXPECT_TRUE(restoreRecord.find("key2") != restoreRecord.end());
+    EXPECT_EQ(restoreRecord["key2"]->uid_, TEST_NUM_TWO);
+
+    // 全量落盘后清空增量记录
+    EXPECT_EQ(dataStorageHelper->RefreshTaskRecord(allRecord), ERR_OK);
+    EXPECT_EQ(dataStorageHelper->taskJournalCount_.load(), 0);
+    allRecord.clear();
+    EXPECT_EQ(dataStorageHelper->RefreshTaskRecord(allRecord), ERR_OK);
+}
+
+/**
+ * @tc.name: DataStorageHelper_004
+ * @tc.desc: test binary snapshot file.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskMiscUnitTest, DataStorageHelper_004, TestSize.Level2)
+{
+    auto dataStorageHelper = DelayedSingleton<DataStorageHelper>::GetInstance();
+    std::string filePath = "/data/local/tmp/bgtask_snapshot_test";
+    nlohmann::json root;
+    root["key"] = "value";
+    EXPECT_EQ(dataStorageHelper->SaveSnapshotToFile(root, filePath), ERR_OK);
+    nlohmann::json value;
+    EXPECT_EQ(dataStorageHelper->ParseSnapshotFromFile(value, filePath), ERR_OK);
+    EXPECT_EQ(value, root);
+    std::string jsonStr;
+    EXPECT_EQ(dataStorageHelper->ExportSnapshotToJson(filePath, jsonStr), ERR_OK);
+    EXPECT_EQ(nlohmann::json::parse(jsonStr, nullptr, false), root);
+
+    // 数据损坏时校验失败
+    std::string data;
+    EXPECT_TRUE(LoadStringFromFile(filePath, data));
+    data.back() ^= 0xFF;
+    EXPECT_TRUE(SaveStringToFile(filePath, data));
+    EXPECT_EQ(dataStorageHelper->ParseSnapshotFromFile(value, filePath), ERR_BGTASK_DATA_STORAGE_ERR);
+
+    // 兼容旧版本JSON格式文件
+    EXPECT_TRUE(SaveStringToFile(filePath, root.dump(CommonUtils::jsonFormat_)));
+    value.clear();
+    EXPECT_EQ(dataStorageHelper->ParseSnapshotFromFile(value, filePath), ERR_OK);
+    EXPECT_EQ(value, root);
+    remove(filePath.c_str());
+
+    std::vector<std::string> dumpInfo;
+    dataStorageHelper->DumpPersistenceData(dumpInfo);
+    EXPECT_FALSE(dumpInfo.empty());
+}
+
+/**
+ * @tc.name: DataStorageHelper_005
+ * @tc.desc: test persistence data coalescing and flush.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskMiscUnitTest, DataStorageHelper_005, TestSize.Level2)
+{
+    auto dataStorageHelper = DelayedSingleton<DataStorageHelper>::GetInstance();
+    std::unordered_map<int32_t, std::shared_ptr<ResourceApplicationRecord>> appRecord;
+    std::unordered_map<int32_t, std::shared_ptr<ResourceApplicationRecord>> processRecord;
+    EXPECT_EQ(dataStorageHelper->RefreshResourceRecord(appRecord, processRecord), ERR_OK);
+    appRecord.emplace(1, std::make_shared<ResourceApplicationRecord>());
+    EXPECT_EQ(dataStorageHelper->RefreshResourceRecord(appRecord, processRecord), ERR_OK);
+    {
+        std::lock_guard<std::mutex> lock(dataStorageHelper->pendingMutex_);
+        // 合并窗口内的多次修改只保留最新数据
+        EXPECT_EQ(dataStorageHelper->pendingSnapshots_.size(), 1);
+    }
+    dataStorageHelper->FlushPersistenceData();
+    {
+        std::lock_guard<std::mutex> lock(dataStorageHelper->pendingMutex_);
+        EXPECT_TRUE(dataStorageHelper->pendingSnapshots_.empty());
+        EXPECT_FALSE(dataStorageHelper->persistFlushScheduled_);
+    }
+    std::unordered_map<int32_t, std::shared_ptr<ResourceApplicationRecord>> restoreAppRecord;
+    std::unordered_map<int32_t, std::shared_ptr<ResourceApplicationRecord>> restoreProcessRecord;
+    EXPECT_EQ(dataStorageHelper->RestoreResourceRecord(restoreAppRecord, restoreProcessRecord), ERR_OK);
+    EXPECT_EQ(restoreAppRecord.size(), 1);
+    appRecord.clear();
+    dataStorageHelper->RefreshResourceRecord(appRecord, processRecord);
+    dataStorageHelper->FlushPersistenceData();
+}
+
+/**
+ * @tc.name: DataStorageHelper_006
+ * @tc.desc: test failed task snapshot is requeued with the journal entries queued after it.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskMiscUnitTest, DataStorageHelper_006, TestSize.Level2)
+{
+    auto dataStorageHelper = DelayedSingleton<DataStorageHelper>::GetInstance();
+    dataStorageHelper->FlushPersistenceData();
+    const std::string taskRecordPath = "/data/service/el1/public/background_task_mgr/running_task";
+    nlohmann::json failedSnapshot;
+    failedSnapshot["key1"] = 1;
+    std::vector<nlohmann::json> taskJournal = {"entry1"};
+    {
+        std::lock_guard<std::mutex> lock(dataStorageHelper->pendingMutex_);
+        dataStorageHelper->pendingTaskJournal_.emplace_back("entry2");
+        dataStorageHelper->pendingClearTaskJournal_ = false;
+    }
+    // 失败的全量数据重新入队，本次增量记录不追加到磁盘上的旧记录
+    dataStorageHelper->RequeueTaskSnapshot(std::move(failedSnapshot), taskJournal);
+    EXPECT_TRUE(taskJournal.empty());
+    {
+        std::lock_guard<std::mutex> lock(dataStorageHelper->pendingMutex_);
+        EXPECT_EQ(dataStorageHelper->pendingSnapshots_[taskRecordPath]["key1"], 1);
+        ASSERT_EQ(dataStorageHelper->pendingTaskJournal_.size(), TEST_NUM_TWO);
+        EXPECT_EQ(dataStorageHelper->pendingTaskJournal_[0], "entry1");
+        EXPECT_EQ(dataStorageHelper->pendingTaskJournal_[1], "entry2");
+        EXPECT_TRUE(dataStorageHelper->pendingClearTaskJournal_);
+    }
+
+    // 已有更新的全量数据时丢弃失败的全量数据及其增量记录
+    nlohmann::json staleSnapshot;
+    staleSnapshot["key1"] = TEST_NUM_TWO;
+    taskJournal = {"entry0"};
+    dataStorageHelper->RequeueTaskSnapshot(std::move(staleSnapshot), taskJournal);
+    EXPECT_TRUE(taskJournal.empty());
+    {
+        std::lock_guard<std::mutex> lock(dataStorageHelper->pendingMutex_);
+        EXPECT_EQ(dataStorageHelper->pendingSnapshots_[taskRecordPath]["key1"], 1);
+        EXPECT_EQ(dataStorageHelper->pendingTaskJournal_.size(), TEST_NUM_TWO);
+        dataStorageHelper->pendingSnapshots_.clear();
+        dataStorageHelper->pendingTaskJournal_.clear();
+        dataStorageHelper->pendingClearTaskJournal_ = false;
+    }
+}
+
 /**
  * @tc.name: DecisionMakerTest_004
  * @tc.desc: test PauseTransientTaskTimeForInner.
@@ -682,19 +978,19 @@ HWTEST_F(BgTaskMiscUnitTest, DecisionMakerTest_004, TestSize.Level2)
 
     std::string name = "bundleName1";
     int32_t uid = 1;
-    decisionMaker->foregroundUidPidMap_[uid].insert(1);
+    decisionMaker->appStateTable_.UpdateForegroundPid(uid, 1, true);
     EXPECT_EQ(decisionMaker->PauseTransientTaskTimeForInner(uid, name), ERR_BGTASK_FOREGROUND);
 
     auto keyInfo = std::make_shared<KeyInfo>("bundleName1", 1);
-    decisionMaker->foregroundUidPidMap_.clear();
-    decisionMaker->pkgDelaySuspendInfoMap_.clear();
+    decisionMaker->appStateTable_.ClearForeground();
+    decisionMaker->appStateTable_.ClearDelayInfo();
     EXPECT_EQ(decisionMaker->PauseTransientTaskTimeForInner(uid, name), ERR_BGTASK_NOREQUEST_TASK);
     
     auto keyInfo1 = std::make_shared<KeyInfo>("bundleName1", 1);
     auto pkgDelaySuspendInfo = std::make_shared<PkgDelaySuspendInfo>("bundleName1", 1, timerManager);
     auto delayInfo = std::make_shared<DelaySuspendInfoEx>(1);
     pkgDelaySuspendInfo->requestList_.push_back(delayInfo);
-    decisionMaker->pkgDelaySuspendInfoMap_[keyInfo1] = pkgDelaySuspendInfo;
+    decisionMaker->appStateTable_.SetDelayInfo(keyInfo1->GetPkg(), keyInfo1->GetUid(), pkgDelaySuspendInfo);
     EXPECT_EQ(decisionMaker->PauseTransientTaskTimeForInner(uid, name), ERR_OK);
 }
 
@@ -714,20 +1010,20 @@ HWTEST_F(BgTaskMiscUnitTest, DecisionMakerTest_005, TestSize.Level2)
 
     std::string name = "bundleName1";
     int32_t uid = 1;
-    decisionMaker->foregroundUidPidMap_[uid].insert(1);
+    decisionMaker->appStateTable_.UpdateForegroundPid(uid, 1, true);
     EXPECT_EQ(decisionMaker->StartTransientTaskTimeForInner(uid, name), ERR_BGTASK_FOREGROUND);
 
     auto keyInfo = std::make_shared<KeyInfo>("bundleName1", 1);
-    decisionMaker->foregroundUidPidMap_.clear();
-    decisionMaker->pkgDelaySuspendInfoMap_.clear();
+    decisionMaker->appStateTable_.ClearForeground();
+    decisionMaker->appStateTable_.ClearDelayInfo();
     EXPECT_EQ(decisionMaker->StartTransientTaskTimeForInner(uid, name), ERR_BGTASK_NOREQUEST_TASK);
     
     auto keyInfo1 = std::make_shared<KeyInfo>("bundleName1", 1);
     auto pkgDelaySuspendInfo = std::make_shared<PkgDelaySuspendInfo>("bundleName1", 1, timerManager);
     auto delayInfo = std::make_shared<DelaySuspendInfoEx>(1);
     pkgDelaySuspendInfo->requestList_.push_back(delayInfo);
-    decisionMaker->pkgDelaySuspendInfoMap_[keyInfo1] = pkgDelaySuspendInfo;
-    decisionMaker->foregroundUidPidMap_.clear();
+    decisionMaker->appStateTable_.SetDelayInfo(keyInfo1->GetPkg(), keyInfo1->GetUid(), pkgDelaySuspendInfo);
+    decisionMaker->appStateTable_.ClearForeground();
     EXPECT_EQ(decisionMaker->StartTransientTaskTimeForInner(uid, name), ERR_OK);
 }
 
@@ -750,19 +1046,158 @@ HWTEST_F(BgTaskMiscUnitTest, DecisionMakerTest_006, TestSize.Level2)
     EXPECT_TRUE(requestIdList.empty());
 
     auto keyInfo = std::make_shared<KeyInfo>("bundleName", 1, 1);
-    decisionMaker->pkgDelaySuspendInfoMap_.clear();
+    decisionMaker->appStateTable_.ClearDelayInfo();
     requestIdList = decisionMaker->GetRequestIdListByKey(keyInfo);
     EXPECT_TRUE(requestIdList.empty());
 
-    decisionMaker->pkgDelaySuspendInfoMap_.clear();
+    decisionMaker->appStateTable_.ClearDelayInfo();
     auto pkgDelaySuspendInfo = std::make_shared<PkgDelaySuspendInfo>("bundleName", 1, timerManager);
     auto delayInfo1 = std::make_shared<DelaySuspendInfoEx>(1);
     pkgDelaySuspendInfo->requestList_.push_back(delayInfo1);
-    decisionMaker->pkgDelaySuspendInfoMap_[keyInfo] = pkgDelaySuspendInfo;
+    decisionMaker->appStateTable_.SetDelayInfo(keyInfo->GetPkg(), keyInfo->GetUid(), pkgDelaySuspendInfo);
     requestIdList = decisionMaker->GetRequestIdListByKey(keyInfo);
     EXPECT_FALSE(requestIdList.empty());
 }
 
+/**
+ * @tc.name: DecisionMakerTest_007
+ * @tc.desc: test quota reset lazily by quota epoch.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskMiscUnitTest, DecisionMakerTest_007, TestSize.Level2)
+{
+    auto deviceInfoManeger = std::make_shared<DeviceInfoManager>();
+    auto bgtaskService = sptr<BackgroundTaskMgrService>(new BackgroundTaskMgrService());
+    auto timerManager = std::make_shared<TimerManager>(bgtaskService,
+        AppExecFwk::EventRunner::Create("tdd_test_handler"));
+    auto decisionMaker = std::make_shared<DecisionMaker>(timerManager, deviceInfoManeger);
+
+    auto keyInfo1 = std::make_shared<KeyInfo>("bundleName1", 1);
+    auto pkgDelaySuspendInfo1 = std::make_shared<PkgDelaySuspendInfo>("bundleName1", 1, timerManager);
+    pkgDelaySuspendInfo1->requestList_.push_back(std::make_shared<DelaySuspendInfoEx>(1));
+    pkgDelaySuspendInfo1->quota_ = 0;
+    decisionMaker->appStateTable_.SetDelayInfo(keyInfo1->GetPkg(), keyInfo1->GetUid(), pkgDelaySuspendInfo1);
+    auto keyInfo2 = std::make_shared<KeyInfo>("bundleName2", TEST_NUM_TWO);
+    auto pkgDelaySuspendInfo2 = std::make_shared<PkgDelaySuspendInfo>("bundleName2", TEST_NUM_TWO, timerManager);
+    decisionMaker->appStateTable_.SetDelayInfo(keyInfo2->GetPkg(), keyInfo2->GetUid(), pkgDelaySuspendInfo2);
+
+    decisionMaker->ResetDayQuotaLocked();
+    EXPECT_EQ((int32_t)decisionMaker->quotaEpoch_, 0);
+    EXPECT_EQ(decisionMaker->GetQuota(keyInfo1), 0);
+
+    decisionMaker->lastRequestTime_ = TimeProvider::GetCurrentTime() - QUOTA_UPDATE - 1;
+    decisionMaker->ResetDayQuotaLocked();
+    EXPECT_EQ((int32_t)decisionMaker->quotaEpoch_, 1);
+    EXPECT_EQ(pkgDelaySuspendInfo1->quota_, 0);
+    EXPECT_EQ(decisionMaker->GetQuota(keyInfo1), INIT_QUOTA);
+    EXPECT_EQ((int32_t)pkgDelaySuspendInfo1->GetQuotaEpoch(), 1);
+    EXPECT_EQ(decisionMaker->GetQuota(keyInfo2), INIT_QUOTA);
+    EXPECT_EQ((int32_t)decisionMaker->appStateTable_.DelayInfoSize(), 1);
+}
+
+/**
+ * @tc.name: DecisionMakerTest_008
+ * @tc.desc: soak test of idle transient app state eviction with months of simulated app churn and lru eviction.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskMiscUnitTest, DecisionMakerTest_008, TestSize.Level2)
+{
+    auto deviceInfoManeger = std::make_shared<DeviceInfoManager>();
+    auto bgtaskService = sptr<BackgroundTaskMgrService>(new BackgroundTaskMgrService());
+    auto timerManager = std::make_shared<TimerManager>(bgtaskService,
+        AppExecFwk::EventRunner::Create("tdd_test_handler"));
+    auto decisionMaker = std::make_shared<DecisionMaker>(timerManager, deviceInfoManeger);
+    auto config = DelayedSingleton<BgtaskConfig>::GetInstance();
+    int32_t oldMaxSize = config->transientTaskStateMaxSize_;
+    config->transientTaskStateMaxSize_ = SOAK_STATE_MAX_SIZE;
+
+    int64_t simulatedTime = 0;
+    int32_t appIndex = 0;
+    std::vector<std::shared_ptr<PkgDelaySuspendInfo>> activeInfos;
+    for (int32_t day = 0; day < SOAK_DAYS; day++) {
+        // 前一天的请求结束，额度周期推进
+        for (auto &info : activeInfos) {
+            info->requestList_.clear();
+        }
+        activeInfos.clear();
+        decisionMaker->quotaEpoch_++;
+        for (int32_t i = 0; i < SOAK_APPS_PER_DAY; i++) {
+            simulatedTime += MSEC_PER_DAY / SOAK_APPS_PER_DAY;
+            int32_t uid = appIndex++ % SOAK_APP_POOL_SIZE;
+            std::string bundleName = "bundleName" + std::to_string(uid);
+            decisionMaker->EvictIdleDelayInfoLocked(simulatedTime);
+            auto info = decisionMaker->appStateTable_.FindDelayInfo(bundleName, uid);
+            if (info == nullptr) {
+                info = std::make_shared<PkgDelaySuspendInfo>(bundleName, uid, timerManager);
+                decisionMaker->appStateTable_.SetDelayInfo(bundleName, uid, info);
+            }
+            info->SyncQuotaEpoch(decisionMaker->quotaEpoch_);
+            info->SetLastAccessTime(simulatedTime);
+            if (i % SOAK_ACTIVE_APP_INTERVAL == 0) {
+                info->requestList_.push_back(std::make_shared<DelaySuspendInfoEx>(uid));
+                activeInfos.emplace_back(info);
+            } else if (i % SOAK_USED_QUOTA_APP_INTERVAL == 0) {
+                info->quota_ = INIT_QUOTA - MSEC_PER_SEC;
+            }
+            EXPECT_LE((int32_t)decisionMaker->appStateTable_.DelayInfoSize(), SOAK_STATE_MAX_SIZE);
+        }
+    }
+    for (const auto &info : activeInfos) {
+        EXPECT_EQ(decisionMaker->appStateTable_.FindDelayInfo(info->GetPkg(), info->GetUid()), info);
+    }
+    EXPECT_GT((int32_t)decisionMaker->evictedCount_, 0);
+
+    // 同一空闲周期内经 Decide 新增的应用超过上限时，按最近访问时间淘汰空闲应用
+    decisionMaker->appStateTable_.ClearDelayInfo();
+    int64_t baseTime = TimeProvider::GetCurrentTime();
+    decisionMaker->lastEvictTime_ = baseTime;
+    uint64_t evictedCount = decisionMaker->evictedCount_;
+    std::vector<std::shared_ptr<KeyInfo>> activeKeys;
+    std::vector<std::shared_ptr<KeyInfo>> usedQuotaKeys;
+    std::vector<std::shared_ptr<KeyInfo>> idleKeys;
+    std::vector<int32_t> activeRequestIds;
+    for (int32_t uid = 0; uid < SOAK_STATE_MAX_SIZE * TEST_NUM_TWO; uid++) {
+        auto keyInfo = std::make_shared<KeyInfo>("lruBundleName" + std::to_string(uid), uid);
+        auto delayInfo = std::make_shared<DelaySuspendInfoEx>(uid);
+        EXPECT_EQ(decisionMaker->Decide(keyInfo, delayInfo), ERR_OK);
+        EXPECT_LE((int32_t)decisionMaker->appStateTable_.DelayInfoSize(), SOAK_STATE_MAX_SIZE);
+        auto info = decisionMaker->appStateTable_.FindDelayInfo(keyInfo->GetPkg(), keyInfo->GetUid());
+        ASSERT_NE(info, nullptr);
+        info->SetLastAccessTime(baseTime + uid);
+        if (uid % SOAK_ACTIVE_APP_INTERVAL == 0) {
+            activeKeys.emplace_back(keyInfo);
+            activeRequestIds.emplace_back(delayInfo->GetRequestId());
+            continue;
+        }
+        decisionMaker->RemoveRequest(keyInfo, delayInfo->GetRequestId());
+        if (uid % SOAK_USED_QUOTA_APP_INTERVAL == 0) {
+            info->quota_ = INIT_QUOTA - MSEC_PER_SEC;
+            usedQuotaKeys.emplace_back(keyInfo);
+        } else {
+            info->quota_ = INIT_QUOTA;
+            idleKeys.emplace_back(keyInfo);
+        }
+    }
+    EXPECT_GT(decisionMaker->evictedCount_, evictedCount);
+    for (const auto &keyInfo : activeKeys) {
+        EXPECT_NE(decisionMaker->appStateTable_.FindDelayInfo(keyInfo->GetPkg(), keyInfo->GetUid()), nullptr);
+    }
+    for (const auto &keyInfo : usedQuotaKeys) {
+        EXPECT_NE(decisionMaker->appStateTable_.FindDelayInfo(keyInfo->GetPkg(), keyInfo->GetUid()), nullptr);
+    }
+    EXPECT_EQ(decisionMaker->appStateTable_.FindDelayInfo(idleKeys.front()->GetPkg(), idleKeys.front()->GetUid()),
+        nullptr);
+    EXPECT_NE(decisionMaker->appStateTable_.FindDelayInfo(idleKeys.back()->GetPkg(), idleKeys.back()->GetUid()),
+        nullptr);
+    for (size_t i = 0; i < activeKeys.size(); i++) {
+        decisionMaker->RemoveRequest(activeKeys[i], activeRequestIds[i]);
+    }
+    std::vector<std::string> dumpInfo;
+    decisionMaker->DumpAppState(dumpInfo);
+    EXPECT_EQ((int32_t)dumpInfo.size(), 1);
+    config->transientTaskStateMaxSize_ = oldMaxSize;
+}
+
 /**
  * @tc.name: DelaySuspendInfoEx_001
  * @tc.desc: test DelaySuspendInfoEx.
@@ -844,18 +1279,19 @@ HWTEST_F(BgTaskMiscUnitTest, OnProcessStateChanged_001, TestSize.Level2)
     auto pkgDelaySuspendInfo = std::make_shared<PkgDelaySuspendInfo>("bundleName1", 1, timerManager);
     auto delayInfo = std::make_shared<DelaySuspendInfoEx>(1);
     pkgDelaySuspendInfo->requestList_.push_back(delayInfo);
-    decisionMaker->pkgDelaySuspendInfoMap_[keyInfo1] = pkgDelaySuspendInfo;
+    decisionMaker->appStateTable_.SetDelayInfo(keyInfo1->GetPkg(), keyInfo1->GetUid(), pkgDelaySuspendInfo);
     auto keyInfo = std::make_shared<KeyInfo>("bundleName1", 1);
-    decisionMaker->pkgBgDurationMap_[keyInfo] = TimeProvider::GetCurrentTime() - ALLOW_REQUEST_TIME_BG - 1;
+    decisionMaker->appStateTable_.SetBgStartTime(keyInfo->GetPkg(), keyInfo->GetUid(),
+        TimeProvider::GetCurrentTime() - ALLOW_REQUEST_TIME_BG - 1);
     processData.state = AppExecFwk::AppProcessState::APP_STATE_FOREGROUND;
     decisionMaker->OnProcessStateChanged(processData);
 
-    decisionMaker->pkgDelaySuspendInfoMap_.clear();
+    decisionMaker->appStateTable_.ClearDelayInfo();
     processData.state = AppExecFwk::AppProcessState::APP_STATE_BACKGROUND;
     decisionMaker->OnProcessStateChanged(processData);
-    decisionMaker->pkgDelaySuspendInfoMap_[keyInfo1] = pkgDelaySuspendInfo;
+    decisionMaker->appStateTable_.SetDelayInfo(keyInfo1->GetPkg(), keyInfo1->GetUid(), pkgDelaySuspendInfo);
     decisionMaker->OnProcessStateChanged(processData);
-    EXPECT_EQ((int32_t)decisionMaker->pkgDelaySuspendInfoMap_.size(), 1);
+    EXPECT_EQ((int32_t)decisionMaker->appStateTable_.DelayInfoSize(), 1);
 }
 
 /**
@@ -883,13 +1319,56 @@ HWTEST_F(BgTaskMiscUnitTest, OnProcessDied_001, TestSize.Level2)
     auto pkgDelaySuspendInfo = std::make_shared<PkgDelaySuspendInfo>("bundleName1", processData.uid, timerManager);
     auto delayInfo = std::make_shared<DelaySuspendInfoEx>(processData.pid);
     pkgDelaySuspendInfo->requestList_.push_back(delayInfo);
-    decisionMaker->pkgDelaySuspendInfoMap_[keyInfo1] = pkgDelaySuspendInfo;
+    decisionMaker->appStateTable_.SetDelayInfo(keyInfo1->GetPkg(), keyInfo1->GetUid(), pkgDelaySuspendInfo);
 
     decisionMaker->OnProcessDied(processData);
     EXPECT_FALSE(decisionMaker->IsUidForeground(processData.uid));
     EXPECT_TRUE(pkgDelaySuspendInfo->isCounting_);
 }
 
+/**
+ * @tc.name: TransientAppStateTable_001
+ * @tc.desc: test TransientAppStateTable class.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskMiscUnitTest, TransientAppStateTable_001, TestSize.Level2)
+{
+    auto bgtaskService = sptr<BackgroundTaskMgrService>(new BackgroundTaskMgrService());
+    auto timerManager =
+        std::make_shared<TimerManager>(bgtaskService, AppExecFwk::EventRunner::Create("tdd_test_handler"));
+    TransientAppStateTable table;
+    auto info1 = std::make_shared<PkgDelaySuspendInfo>("bundleName1", 1, timerManager);
+    auto info2 = std::make_shared<PkgDelaySuspendInfo>("bundleName2", 1, timerManager);
+    table.SetDelayInfo("bundleName1", 1, info1);
+    table.SetDelayInfo("bundleName2", 1, info2);
+    table.SetDelayInfo("bundleName1", 1, info1);
+    EXPECT_EQ((int32_t)table.DelayInfoSize(), TEST_NUM_TWO);
+    EXPECT_EQ(table.FindDelayInfo("bundleName2", 1), info2);
+    EXPECT_EQ(table.FindDelayInfo("bundleName1", TEST_NUM_TWO), nullptr);
+
+    int64_t bgStartTime = 0;
+    EXPECT_FALSE(table.GetBgStartTime("bundleName1", 1, bgStartTime));
+    table.SetBgStartTime("bundleName1", 1, 1);
+    EXPECT_TRUE(table.GetBgStartTime("bundleName1", 1, bgStartTime));
+    EXPECT_EQ(bgStartTime, 1);
+    table.ClearBgStartTime("bundleName1", 1);
+    EXPECT_FALSE(table.GetBgStartTime("bundleName1", 1, bgStartTime));
+
+    table.UpdateForegroundPid(1, 1, true);
+    table.UpdateForegroundPid(1, TEST_NUM_TWO, true);
+    table.UpdateForegroundPid(1, 1, false);
+    EXPECT_TRUE(table.IsUidForeground(1));
+    table.UpdateForegroundPid(1, TEST_NUM_TWO, false);
+    EXPECT_FALSE(table.IsUidForeground(1));
+
+    table.EraseDelayInfoIf([&info1](const std::shared_ptr<PkgDelaySuspendInfo> &info) { return info == info1; });
+    EXPECT_EQ((int32_t)table.DelayInfoSize(), 1);
+    EXPECT_EQ(table.FindDelayInfo("bundleName1", 1), nullptr);
+    table.SetDelayInfo("bundleName2", 1, nullptr);
+    EXPECT_EQ((int32_t)table.DelayInfoSize(), 0);
+    EXPECT_TRUE(table.uidStates_.empty());
+}
+
 /**
  * @tc.name: TaskNotificationSubscriber_003
  * @tc.desc: test TaskNotificationSubscriber class.
@@ -1148,6 +1627,36 @@ HWTEST_F(BgTaskMiscUnitTest, SubModeNotification_001, TestSize.Level2)
     EXPECT_EQ(workOutValue, "正在运行运动任务，删除通知后任务将停止");
 }
 
+/**
+ * @tc.name: BgTaskResMgrCache_001
+ * @tc.desc: test resource manager and merge notification text cache of BgContinuousTaskMgr.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskMiscUnitTest, BgTaskResMgrCache_001, TestSize.Level2)
+{
+    auto bgContinuousTaskMgr = BgContinuousTaskMgr::GetInstance();
+    bgContinuousTaskMgr->GetNotificationPrompt();
+    auto resourceManager = bgContinuousTaskMgr->GetBgTaskResMgr();
+    EXPECT_NE(resourceManager, nullptr);
+    EXPECT_EQ(bgContinuousTaskMgr->GetBgTaskResMgr(), resourceManager);
+
+    std::vector<uint32_t> checkModes = {1, TEST_NUM_TWO};
+    std::vector<std::tuple<Global::Resource::ResourceManager::NapiValueType, std::string>> jsParams;
+    jsParams.emplace_back(Global::Resource::ResourceManager::NapiValueType::NAPI_STRING, "mode1");
+    jsParams.emplace_back(Global::Resource::ResourceManager::NapiValueType::NAPI_STRING, "mode2");
+    std::string notificationText {""};
+    EXPECT_EQ(bgContinuousTaskMgr->FormatNotificationText(notificationText, checkModes, "", jsParams), ERR_OK);
+    EXPECT_EQ((int32_t)bgContinuousTaskMgr->mergeNotificationTextCache_.size(), 1);
+    std::string cachedText {""};
+    EXPECT_EQ(bgContinuousTaskMgr->FormatNotificationText(cachedText, checkModes, "", jsParams), ERR_OK);
+    EXPECT_EQ(cachedText, notificationText);
+    EXPECT_EQ((int32_t)bgContinuousTaskMgr->mergeNotificationTextCache_.size(), 1);
+
+    bgContinuousTaskMgr->ResetBgTaskResMgr();
+    EXPECT_EQ(bgContinuousTaskMgr->bgTaskResMgr_, nullptr);
+    EXPECT_TRUE(bgContinuousTaskMgr->mergeNotificationTextCache_.empty());
+}
+
 /**
  * @tc.name: DialogEventObserver_001
  * @tc.desc: test DialogEventObserver class.
@@ -1203,5 +1712,377 @@ HWTEST_F(BgTaskMiscUnitTest, NotificationToolsTest_005, TestSize.Level2)
         "prompt", 0, bannerNotificationBtn), ERR_BGTASK_NOTIFICATION_ERR);
 #endif
 }
+
+/**
+ * @tc.name: NotificationToolsTest_006
+ * @tc.desc: test NotificationTools defers and merges cancel requests during batch operation.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskMiscUnitTest, NotificationToolsTest_006, TestSize.Level2)
+{
+#ifdef DISTRIBUTED_NOTIFICATION_ENABLE
+    auto notificationTools = NotificationTools::GetInstance();
+    notificationTools->BeginBatchOperation();
+    notificationTools->BeginBatchOperation();
+    EXPECT_EQ(notificationTools->CancelNotification("label", 0), ERR_OK);
+    EXPECT_EQ(notificationTools->CancelNotification("label", 0), ERR_OK);
+    EXPECT_EQ(notificationTools->CancelNotification("label1", 1), ERR_OK);
+    EXPECT_EQ(notificationTools->CancelNotification("", -1), ERR_OK);
+    EXPECT_EQ((int32_t)notificationTools->pendingCancels_.size(), TEST_NUM_TWO);
+    notificationTools->DropPendingCancel("label1", 1);
+    EXPECT_EQ((int32_t)notificationTools->pendingCancels_.size(), TEST_NUM_ONE);
+    notificationTools->EndBatchOperation();
+    EXPECT_EQ((int32_t)notificationTools->pendingCancels_.size(), TEST_NUM_ONE);
+    notificationTools->EndBatchOperation();
+    EXPECT_TRUE(notificationTools->pendingCancels_.empty());
+    EXPECT_EQ(notificationTools->batchDepth_, 0);
+    notificationTools->EndBatchOperation();
+    EXPECT_EQ(notificationTools->batchDepth_, 0);
+#endif
+}
+
+/**
+ * @tc.name: NotificationToolsTest_007
+ * @tc.desc: test NotificationTools skips republish when notification fingerprint is unchanged.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskMiscUnitTest, NotificationToolsTest_007, TestSize.Level2)
+{
+    auto notificationTools = NotificationTools::GetInstance();
+    uint64_t skippedCount = notificationTools->skippedCount_.load();
+    EXPECT_FALSE(notificationTools->SkipUnchangedNotification(0, 0));
+    EXPECT_FALSE(notificationTools->SkipUnchangedNotification(TEST_NUM_TWO, 0));
+    EXPECT_TRUE(notificationTools->SkipUnchangedNotification(TEST_NUM_TWO, TEST_NUM_TWO));
+    EXPECT_EQ(notificationTools->skippedCount_.load(), skippedCount + 1);
+
+    auto taskRecord = std::make_shared<ContinuousTaskRecord>();
+    taskRecord->notificationFingerprint_ = TEST_NUM_TWO;
+    taskRecord->subNotificationFingerprint_ = TEST_NUM_TWO;
+    taskRecord->ResetNotificationFingerprint();
+    EXPECT_EQ((int32_t)taskRecord->notificationFingerprint_, 0);
+    EXPECT_EQ((int32_t)taskRecord->subNotificationFingerprint_, 0);
+
+    std::vector<std::string> dumpInfo;
+    notificationTools->ShellDump(dumpInfo);
+    EXPECT_EQ((int32_t)dumpInfo.size(), 1);
+}
+
+/**
+ * @tc.name: NotificationToolsTest_008
+ * @tc.desc: test PublishNotification skips ANS for an unchanged record but never for data transfer.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskMiscUnitTest, NotificationToolsTest_008, TestSize.Level2)
+{
+#ifdef DISTRIBUTED_NOTIFICATION_ENABLE
+    auto notificationTools = NotificationTools::GetInstance();
+    SetPublishNotificationResult(ERR_OK);
+    auto taskRecord = std::make_shared<ContinuousTaskRecord>();
+    taskRecord->AddBgModeId(BackgroundMode::AUDIO_PLAYBACK);
+    taskRecord->wantAgentInfo_ = std::make_shared<WantAgentInfo>();
+    taskRecord->wantAgentInfo_->bundleName_ = "bundleName";
+    taskRecord->wantAgentInfo_->abilityName_ = "abilityName";
+    int32_t publishCount = GetPublishNotificationCount();
+    uint64_t skippedCount = notificationTools->skippedCount_.load();
+    EXPECT_EQ(notificationTools->PublishNotification(taskRecord, "appName", "prompt", 1), ERR_OK);
+    EXPECT_EQ(GetPublishNotificationCount(), publishCount + 1);
+    EXPECT_EQ(notificationTools->PublishNotification(taskRecord, "appName", "prompt", 1), ERR_OK);
+    EXPECT_EQ(GetPublishNotificationCount(), publishCount + 1);
+    EXPECT_EQ(notificationTools->skippedCount_.load(), skippedCount + 1);
+
+    taskRecord->wantAgentInfo_->abilityName_ = "otherAbilityName";
+    EXPECT_EQ(notificationTools->PublishNotification(taskRecord, "appName", "prompt", 1), ERR_OK);
+    EXPECT_EQ(GetPublishNotificationCount(), publishCount + TEST_NUM_TWO);
+
+    auto dataTransferRecord = std::make_shared<ContinuousTaskRecord>();
+    dataTransferRecord->AddBgModeId(BackgroundMode::DATA_TRANSFER);
+    publishCount = GetPublishNotificationCount();
+    EXPECT_EQ(notificationTools->PublishNotification(dataTransferRecord, "appName", "prompt", 1), ERR_OK);
+    EXPECT_EQ(notificationTools->PublishNotification(dataTransferRecord, "appName", "prompt", 1), ERR_OK);
+    EXPECT_EQ(GetPublishNotificationCount(), publishCount + TEST_NUM_TWO);
+    EXPECT_EQ(notificationTools->skippedCount_.load(), skippedCount + 1);
+    SetPublishNotificationResult(-1);
+#endif
+}
+
+/**
+ * @tc.name: BundleNameCacheTest_001
+ * @tc.desc: test BundleNameCache lru eviction, invalidation and dump.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskMiscUnitTest, BundleNameCacheTest_001, TestSize.Level2)
+{
+    auto cache = DelayedSingleton<BundleNameCache>::GetInstance();
+    cache->Clear();
+    std::string bundleName;
+    EXPECT_FALSE(cache->GetBundleName(1, bundleName));
+    EXPECT_TRUE(cache->entries_.empty());
+
+    const int32_t maxCacheSize = 512;
+    for (int32_t uid = 0; uid <= maxCacheSize; uid++) {
+        cache->PutLocked(uid, "bundleName" + std::to_string(uid));
+    }
+    EXPECT_EQ((int32_t)cache->entries_.size(), maxCacheSize);
+    EXPECT_TRUE(cache->entries_.find(0) == cache->entries_.end());
+    uint64_t hitCount = cache->hitCount_;
+    EXPECT_TRUE(cache->GetBundleName(1, bundleName));
+    EXPECT_EQ(bundleName, "bundleName1");
+    EXPECT_EQ(cache->hitCount_, hitCount + 1);
+    EXPECT_EQ(cache->lruList_.front(), 1);
+
+    cache->Invalidate(1);
+    EXPECT_TRUE(cache->entries_.find(1) == cache->entries_.end());
+    std::vector<std::string> dumpInfo;
+    cache->ShellDump(dumpInfo);
+    EXPECT_EQ((int32_t)dumpInfo.size(), 1);
+    cache->Clear();
+    EXPECT_TRUE(cache->lruList_.empty());
+}
+
+/**
+ * @tc.name: BundleNameCacheTest_002
+ * @tc.desc: test BundleNameCache drops a query result when the uid is invalidated during the query.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskMiscUnitTest, BundleNameCacheTest_002, TestSize.Level2)
+{
+    auto cache = DelayedSingleton<BundleNameCache>::GetInstance();
+    cache->Clear();
+    // 模拟查询前记录的版本号，查询期间应用被卸载
+    uint64_t generation = cache->generation_;
+    cache->Invalidate(1);
+    EXPECT_FALSE(cache->FillLocked(1, "bundleName1", generation));
+    EXPECT_TRUE(cache->entries_.find(1) == cache->entries_.end());
+    EXPECT_EQ(cache->staleFillCount_, (uint64_t)1);
+
+    EXPECT_TRUE(cache->FillLocked(1, "bundleName1", cache->generation_));
+    std::string bundleName;
+    EXPECT_TRUE(cache->GetBundleName(1, bundleName));
+    EXPECT_EQ(bundleName, "bundleName1");
+    generation = cache->generation_;
+    cache->Clear();
+    EXPECT_FALSE(cache->FillLocked(1, "bundleName1", generation));
+    cache->staleFillCount_ = 0;
+}
+
+/**
+ * @tc.name: TimerWheelTest_001
+ * @tc.desc: benchmark TimerWheel against per request InnerEvent timers under 10k timers.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskMiscUnitTest, TimerWheelTest_001, TestSize.Level2)
+{
+    const int32_t baseId = 100000;
+    const int32_t timerNum = 10000;
+    const int32_t cancelNum = 1000;
+    const int64_t maxDelayTime = 1000;
+
+    // 旧方案：每个请求一个 InnerEvent，事件队列深度等于定时器个数，每个到期事件单独唤醒一次
+    auto eventHandler = std::make_shared<BenchmarkEventHandler>(
+        AppExecFwk::EventRunner::Create("tdd_timer_benchmark"));
+    int64_t beginTime = TimeProvider::GetCurrentTime(ClockType::CLOCK_TYPE_MONOTONIC);
+    for (int32_t i = 0; i < timerNum; i++) {
+        eventHandler->SendEvent(AppExecFwk::InnerEvent::Get(baseId + i), (i * 7919) % maxDelayTime);
+    }
+    for (int32_t i = 0; i < cancelNum; i++) {
+        eventHandler->RemoveEvent(baseId + i);
+    }
+    int64_t eventApplyCost = TimeProvider::GetCurrentTime(ClockType::CLOCK_TYPE_MONOTONIC) - beginTime;
+    int32_t eventQueueDepth = timerNum - cancelNum;
+    std::this_thread::sleep_for(std::chrono::milliseconds(maxDelayTime + SLEEP_TIME));
+    EXPECT_EQ(eventHandler->processCount_.load(), timerNum - cancelNum);
+
+    // 新方案：时间轮按 100ms 刻度合并唤醒，事件队列中只保留最近一次唤醒
+    auto timerWheel = DelayedSingleton<TimerWheel>::GetInstance();
+    auto expiredNum = std::make_shared<std::atomic<int32_t>>(0);
+    auto task = [expiredNum]() {
+        (*expiredNum)++;
+    };
+    uint64_t wakeupCount = timerWheel->wakeupCount_;
+    beginTime = TimeProvider::GetCurrentTime(ClockType::CLOCK_TYPE_MONOTONIC);
+    for (int32_t i = 0; i < timerNum; i++) {
+        EXPECT_TRUE(timerWheel->AddTimer(TimerWheelModule::EFFICIENCY_PROC_TIMEOUT, baseId + i,
+            (i * 7919) % maxDelayTime, task, nullptr));
+    }
+    for (int32_t i = 0; i < cancelNum; i++) {
+        timerWheel->AddTimer(TimerWheelModule::EFFICIENCY_PROC_TIMEOUT, baseId + i, maxDelayTime, task, nullptr);
+    }
+    EXPECT_TRUE(timerWheel->HasTimer(TimerWheelModule::EFFICIENCY_PROC_TIMEOUT, baseId));
+    for (int32_t i = 0; i < cancelNum; i++) {
+        timerWheel->RemoveTimer(TimerWheelModule::EFFICIENCY_PROC_TIMEOUT, baseId + i);
+    }
+    int64_t wheelApplyCost = TimeProvider::GetCurrentTime(ClockType::CLOCK_TYPE_MONOTONIC) - beginTime;
+    size_t wheelQueueDepth = 0;
+    {
+        std::lock_guard<std::mutex> lock(timerWheel->wheelMutex_);
+        wheelQueueDepth = timerWheel->pendingWakeups_.size();
+    }
+    EXPECT_FALSE(timerWheel->HasTimer(TimerWheelModule::EFFICIENCY_PROC_TIMEOUT, baseId));
+    std::this_thread::sleep_for(std::chrono::milliseconds(maxDelayTime + SLEEP_TIME));
+    EXPECT_EQ(expiredNum->load(), timerNum - cancelNum);
+    EXPECT_FALSE(timerWheel->HasTimer(TimerWheelModule::EFFICIENCY_PROC_TIMEOUT, baseId + timerNum - 1));
+    uint64_t wheelWakeups = timerWheel->wakeupCount_ - wakeupCount;
+    GTEST_LOG_(INFO) << "timers: " << timerNum - cancelNum << "\n"
+        << "InnerEvent apply cost: " << eventApplyCost << "ms, queue depth: " << eventQueueDepth
+        << ", wakeups: " << eventHandler->processCount_.load() << "\n"
+        << "TimerWheel apply cost: " << wheelApplyCost << "ms, queue depth: " << wheelQueueDepth
+        << ", wakeups: " << wheelWakeups;
+    std::vector<std::string> dumpInfo;
+    timerWheel->ShellDump(dumpInfo);
+    EXPECT_EQ((int32_t)dumpInfo.size(), 1);
+}
+
+/**
+ * @tc.name: TimerWheelTest_002
+ * @tc.desc: test expiry already posted to the target thread is dropped after cancel or reschedule.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskMiscUnitTest, TimerWheelTest_002, TestSize.Level2)
+{
+    auto timerWheel = DelayedSingleton<TimerWheel>::GetInstance();
+    const int32_t canceledId = 300000;
+    const int32_t rescheduledId = 300001;
+    auto handler = std::make_shared<AppExecFwk::EventHandler>(AppExecFwk::EventRunner::Create("tdd_timer_target"));
+    auto expiredNum = std::make_shared<std::atomic<int32_t>>(0);
+    auto task = [expiredNum]() {
+        (*expiredNum)++;
+    };
+    // 阻塞目标线程，使到期回调停留在队列中
+    auto blocked = std::make_shared<std::atomic<bool>>(true);
+    handler->PostTask([blocked]() {
+        while (blocked->load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+    EXPECT_TRUE(timerWheel->AddTimer(TimerWheelModule::TRANSIENT_TASK_EXPIRED, canceledId, 0, task, handler));
+    EXPECT_TRUE(timerWheel->AddTimer(TimerWheelModule::TRANSIENT_TASK_WATCHDOG, rescheduledId, 0, task, handler));
+    std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_TIME));
+    EXPECT_FALSE(timerWheel->HasTimer(TimerWheelModule::TRANSIENT_TASK_EXPIRED, canceledId));
+    timerWheel->RemoveTimer(TimerWheelModule::TRANSIENT_TASK_EXPIRED, canceledId);
+    EXPECT_TRUE(timerWheel->AddTimer(TimerWheelModule::TRANSIENT_TASK_WATCHDOG, rescheduledId, SLEEP_TIME, task,
+        handler));
+    blocked->store(false);
+    std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_TIME / TEST_NUM_TWO));
+    // 取消和重新设置前已投递的回调都不再执行
+    EXPECT_EQ(expiredNum->load(), 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_TIME));
+    EXPECT_EQ(expiredNum->load(), 1);
+}
+
+/**
+ * @tc.name: RunnerIsolationTest_001
+ * @tc.desc: test transient expiry jitter on split runners stays below shared runner while continuous tasks churn.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskMiscUnitTest, RunnerIsolationTest_001, TestSize.Level2)
+{
+    // 用例结束或断言失败时都恢复拆分开关
+    ParameterGuard guard(SPLIT_RUNNER_PARAM, "true");
+    ASSERT_TRUE(OHOS::system::SetParameter(SPLIT_RUNNER_PARAM, "true"));
+    auto splitService = sptr<BackgroundTaskMgrService>(new BackgroundTaskMgrService());
+    splitService->CreateRunners();
+    ASSERT_NE(splitService->runner_, nullptr);
+    EXPECT_NE(splitService->efficiencyRunner_, splitService->runner_);
+    EXPECT_NE(splitService->continuousRunner_, splitService->runner_);
+    EXPECT_NE(splitService->efficiencyRunner_, splitService->continuousRunner_);
+
+    // 关闭拆分开关后三个子系统回退到同一线程
+    ASSERT_TRUE(OHOS::system::SetParameter(SPLIT_RUNNER_PARAM, "false"));
+    auto sharedService = sptr<BackgroundTaskMgrService>(new BackgroundTaskMgrService());
+    sharedService->CreateRunners();
+    ASSERT_NE(sharedService->runner_, nullptr);
+    EXPECT_EQ(sharedService->efficiencyRunner_, sharedService->runner_);
+    EXPECT_EQ(sharedService->continuousRunner_, sharedService->runner_);
+
+    const int32_t baseId = 200000;
+    int64_t splitJitter = MeasureExpiryJitter(splitService->runner_, splitService->continuousRunner_, baseId);
+    int64_t sharedJitter = MeasureExpiryJitter(sharedService->runner_, sharedService->continuousRunner_,
+        baseId + JITTER_TIMER_NUM);
+    GTEST_LOG_(INFO) << "transient expiry max jitter while continuous runner busy, split: " << splitJitter
+        << "ms, shared: " << sharedJitter << "ms";
+    // 共享线程上到期回调排在长时任务之后，拆分后的抖动只来自时间轮刻度
+    EXPECT_LT(splitJitter, sharedJitter);
+}
+
+/**
+ * @tc.name: BgModeSetTest_001
+ * @tc.desc: test BgModeSet bitmask and CommonUtils mode checks based on it.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskMiscUnitTest, BgModeSetTest_001, TestSize.Level2)
+{
+    static_assert(BgModeSet::FromBits(1ULL << BackgroundMode::AUDIO_PLAYBACK).Contains(BackgroundMode::AUDIO_PLAYBACK),
+        "BgModeSet should be usable in constant expressions");
+    BgModeSet modes({BackgroundMode::LOCATION, BackgroundMode::DATA_TRANSFER, BackgroundMode::LOCATION});
+    EXPECT_EQ((int32_t)modes.Size(), TEST_NUM_TWO);
+    EXPECT_TRUE(modes.Contains(BackgroundMode::DATA_TRANSFER));
+    EXPECT_FALSE(modes.Contains(BackgroundMode::VOIP));
+    std::vector<uint32_t> modeIds = modes.ToVector();
+    EXPECT_EQ((int32_t)modeIds.size(), TEST_NUM_TWO);
+    EXPECT_EQ((int32_t)modeIds[0], (int32_t)BackgroundMode::DATA_TRANSFER);
+    modes.Remove(BackgroundMode::LOCATION);
+    EXPECT_FALSE(modes.Contains(BackgroundMode::LOCATION));
+    BgModeSet overflowModes(std::vector<uint32_t>{BgModeSet::MAX_MODE_ID + 1});
+    EXPECT_FALSE(overflowModes.IsRepresentable());
+    EXPECT_FALSE(overflowModes.IsEmpty());
+
+    EXPECT_TRUE(CommonUtils::CheckModesSame({1, 2, 2}, {2, 1}));
+    EXPECT_FALSE(CommonUtils::CheckModesSame({1, 2}, {1, 3}));
+    EXPECT_TRUE(CommonUtils::CheckApplyMode({1, 2}, {2, 1, 4}));
+    EXPECT_FALSE(CommonUtils::CheckApplyMode({1, 100}, {1, 2}));
+    EXPECT_TRUE(CommonUtils::CheckExistOtherMode({1, 3}, 1, {1, 3, 8}));
+    EXPECT_FALSE(CommonUtils::CheckExistOtherMode({1, 2}, 1, {1, 3, 8}));
+    std::vector<uint32_t> sortModes = {BackgroundMode::VOIP, BackgroundMode::LOCATION, BackgroundMode::DATA_TRANSFER};
+    CommonUtils::SortMode(sortModes);
+    std::vector<uint32_t> expectModes = {BackgroundMode::DATA_TRANSFER, BackgroundMode::LOCATION,
+        BackgroundMode::VOIP};
+    EXPECT_EQ(sortModes, expectModes);
+
+    auto bgContinuousTaskMgr = BgContinuousTaskMgr::GetInstance();
+    EXPECT_EQ((int32_t)bgContinuousTaskMgr->GetModeNumByTypeIds({BackgroundMode::DATA_TRANSFER,
+        BackgroundMode::VOIP}), (1 << 0) | (1 << 7));
+}
+
+/**
+ * @tc.name: BgModeSetTest_002
+ * @tc.desc: test ContinuousTaskRecord keeps its cached mode sets in sync with the mode vectors.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BgTaskMiscUnitTest, BgModeSetTest_002, TestSize.Level2)
+{
+    constexpr uint32_t carKeySubMode = 1;
+    auto record = std::make_shared<ContinuousTaskRecord>("bundleName", "abilityName", 1, 1,
+        BackgroundMode::DATA_TRANSFER, true, std::vector<uint32_t>{BackgroundMode::DATA_TRANSFER,
+        BackgroundMode::LOCATION});
+    EXPECT_EQ(record->GetBgModeSet(), BgModeSet(record->bgModeIds_));
+    record->AddBgModeId(BackgroundMode::VOIP);
+    record->AddBgSubModeId(carKeySubMode);
+    EXPECT_TRUE(record->GetBgModeSet().Contains(BackgroundMode::VOIP));
+    EXPECT_TRUE(record->GetBgSubModeSet().Contains(carKeySubMode));
+    record->SetBgModeIds({BackgroundMode::AUDIO_PLAYBACK});
+    record->SetBgSubModeIds({});
+    EXPECT_EQ(record->GetBgModeSet(), BgModeSet(record->bgModeIds_));
+    EXPECT_TRUE(record->GetBgSubModeSet().IsEmpty());
+
+    // 从持久化数据恢复时同步重建缓存
+    record->SetBgModeIds({BackgroundMode::DATA_TRANSFER, BackgroundMode::AUDIO_RECORDING});
+    record->SetBgSubModeIds({carKeySubMode});
+    nlohmann::json root;
+    record->ParseToJson(root);
+    auto restoredRecord = std::make_shared<ContinuousTaskRecord>();
+    EXPECT_TRUE(restoredRecord->ParseFromJson(root));
+    EXPECT_EQ(restoredRecord->GetBgModeSet(), record->GetBgModeSet());
+    EXPECT_EQ(restoredRecord->GetBgSubModeSet(), record->GetBgSubModeSet());
+
+    BgModeSet modes = record->GetBgModeSet();
+    EXPECT_TRUE(CommonUtils::CheckModesSame(modes, BgModeSet({BackgroundMode::AUDIO_RECORDING,
+        BackgroundMode::DATA_TRANSFER})));
+    EXPECT_TRUE(CommonUtils::CheckApplyMode(modes, BgModeSet({BackgroundMode::DATA_TRANSFER,
+        BackgroundMode::AUDIO_RECORDING, BackgroundMode::VOIP})));
+    EXPECT_FALSE(CommonUtils::CheckExistOtherMode(modes, BackgroundMode::DATA_TRANSFER, {BackgroundMode::LOCATION}));
+    std::vector<uint32_t> sortModes = {BackgroundMode::AUDIO_RECORDING, BackgroundMode::DATA_TRANSFER};
+    CommonUtils::SortMode(sortModes, modes);
+    EXPECT_EQ(sortModes[0], (uint32_t)BackgroundMode::DATA_TRANSFER);
+}
 }
 }
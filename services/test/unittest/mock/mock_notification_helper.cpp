@@ -22,6 +22,8 @@ namespace {
 int32_t g_publishContinuousTaskNotificationFlag = 0;
 int32_t g_cancelContinuousTaskNotificationFlag = 0;
 int32_t g_getAllActiveNotificationsFlag = 0;
+int32_t g_publishNotificationResult = -1;
+int32_t g_publishNotificationCount = 0;
 }
 
 void SetPublishContinuousTaskNotificationFlag(int32_t flag)
@@ -39,6 +41,16 @@ void SetGetAllActiveNotificationsFlag(int32_t flag)
     g_getAllActiveNotificationsFlag = flag;
 }
 
+void SetPublishNotificationResult(int32_t result)
+{
+    g_publishNotificationResult = result;
+}
+
+int32_t GetPublishNotificationCount()
+{
+    return g_publishNotificationCount;
+}
+
 namespace Notification {
 namespace {
 constexpr int32_t TEST_NUM_ONE = 1;
@@ -53,6 +65,12 @@ ErrCode NotificationHelper::PublishContinuousTaskNotification(const Notification
     return 0;
 }
 
+ErrCode NotificationHelper::PublishNotification(const NotificationRequest &request, const std::string &instanceKey)
+{
+    g_publishNotificationCount++;
+    return g_publishNotificationResult;
+}
+
 ErrCode NotificationHelper::CancelContinuousTaskNotification(const std::string &label, int32_t notificationId)
 {
     if (g_cancelContinuousTaskNotificationFlag == 1) {
@@ -64,6 +64,17 @@ void NotificationTools::RefreshBannerNotifications(const std::vector<std::string
     const std::map<std::string, std::pair<std::string, std::string>> &newPromptInfos,
     const std::shared_ptr<BannerNotificationRecord> bannerNotification, int32_t serviceUid) {}
 
+void NotificationTools::RefreshBannerNotifications(const std::vector<std::string> &bannerNotificationBtn,
+    const std::map<std::string, std::pair<std::string, std::string>> &newPromptInfos,
+    const std::map<std::string, std::shared_ptr<BannerNotificationRecord>> &bannerNotifications,
+    int32_t serviceUid) {}
+
+void NotificationTools::BeginBatchOperation() {}
+
+void NotificationTools::EndBatchOperation() {}
+
+void NotificationTools::ShellDump(std::vector<std::string> &dumpInfo) {}
+
 std::string NotificationTools::CreateBannerNotificationLabel(const std::string &bundleName, int32_t userId,
     int32_t appIndex)
 {
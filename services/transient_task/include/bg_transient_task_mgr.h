@@ -34,6 +34,7 @@
 #include "device_info_manager.h"
 #include "event_handler.h"
 #include "event_info.h"
+#include "expired_callback_registry.h"
 #include "ibackground_task_mgr.h"
 #include "iexpired_callback.h"
 #include "ibackground_task_subscriber.h"
@@ -67,6 +68,7 @@ public:
     ErrCode UnsubscribeBackgroundTask(const sptr<IBackgroundTaskSubscriber>& subscriber);
     ErrCode GetTransientTaskApps(std::vector<std::shared_ptr<TransientTaskAppInfo>> &list);
     ErrCode PauseTransientTaskTimeForInner(int32_t uid);
+    ErrCode PauseTransientTaskTimesForInner(const std::vector<int32_t> &uids, std::vector<int32_t> &results);
     ErrCode StartTransientTaskTimeForInner(int32_t uid);
     ErrCode SetBgTaskConfig(const std::string &configData, int32_t sourceType);
     ErrCode ShellDump(const std::vector<std::string> &dumpOption, std::vector<std::string> &dumpInfo);
@@ -82,6 +84,7 @@ public:
     void OnAppCacheStateChanged(int32_t uid, int32_t pid, const std::string &bundleName);
     std::set<int32_t>& GetTransientPauseUid();
     std::shared_ptr<DecisionMaker> GetDecisionMaker();
+    std::shared_ptr<AppExecFwk::EventHandler> GetHandler() const;
 
 private:
     ErrCode IsCallingInfoLegal(int32_t uid, int32_t pid, std::string &name,
@@ -90,6 +93,7 @@ private:
     bool VerifyCallingInfo(int32_t uid, int32_t pid);
     bool VerifyRequestIdLocked(const std::string& name, int32_t uid, int32_t requestId);
     bool CheckProcessName();
+    ErrCode HandlePauseTransientTaskTime(int32_t uid);
     ErrCode CancelSuspendDelayLocked(int32_t requestId);
     void NotifyTransientTaskSuscriber(const shared_ptr<TransientTaskAppInfo>& appInfo,
         const TransientTaskEventType type);
@@ -103,7 +107,7 @@ private:
     std::mutex suscriberLock_;
     sptr<SubscriberDeathRecipient> susriberDeathRecipient_ {nullptr};
     std::mutex expiredCallbackLock_;
-    std::map<int32_t, sptr<IExpiredCallback>> expiredCallbackMap_;
+    ExpiredCallbackRegistry expiredCallbackMap_;
     std::map<int32_t, std::shared_ptr<KeyInfo>> keyInfoMap_;
     sptr<ExpiredCallbackDeathRecipient> callbackDeathRecipient_ {nullptr};
     std::list<sptr<IBackgroundTaskSubscriber>> subscriberList_;
@@ -35,6 +35,7 @@
 #include "pkg_delay_suspend_info.h"
 #include "suspend_controller.h"
 #include "timer_manager.h"
+#include "transient_app_state_table.h"
 
 namespace OHOS {
 namespace BackgroundTaskMgr {
@@ -55,6 +56,7 @@ public:
     void OnProcessDied(const AppExecFwk::ProcessData &processData);
     bool IsUidForeground(int32_t uid);
     void HandleStateChange(const std::string &bundleName, int32_t uid, bool isForeground, bool isBackground);
+    void DumpAppState(std::vector<std::string> &dumpInfo);
 
 private:
     int32_t NewDelaySuspendRequestId();
@@ -67,8 +69,11 @@ private:
 
     bool GetAppMgrProxy();
     void ResetDayQuotaLocked();
+    std::shared_ptr<PkgDelaySuspendInfo> FindDelayInfoLocked(const std::string &pkg, int32_t uid);
+    void EvictIdleDelayInfoLocked(int64_t currentTime);
     bool IsAfterOneDay(int64_t lastRequestTime, int64_t currentTime);
     bool CanStartAccountingLocked(const std::shared_ptr<PkgDelaySuspendInfo>& pkgInfo);
+    bool IsUidForegroundLocked(int32_t uid);
     int GetAllowRequestTime();
     ErrCode CheckQuotaTime(const std::shared_ptr<PkgDelaySuspendInfo>& pkgInfo, const std::string &name,
         int32_t uid, const std::shared_ptr<KeyInfo>& key, bool& needSetTime);
@@ -78,14 +83,16 @@ private:
     const int32_t initRequestId_ = 1;
     int32_t requestId_ {initRequestId_};
     std::mutex lock_;
+    // 当前额度周期的起始时间及周期序号，跨周期后各应用在下次访问时惰性重置额度
     int64_t lastRequestTime_ {0};
+    uint64_t quotaEpoch_ {0};
+    int64_t lastEvictTime_ {0};
+    uint64_t evictedCount_ {0};
     SuspendController suspendController_;
     std::shared_ptr<TimerManager> timerManager_ {nullptr};
     std::shared_ptr<DeviceInfoManager> deviceInfoManager_ {nullptr};
-    std::map<std::shared_ptr<KeyInfo>, std::shared_ptr<PkgDelaySuspendInfo>, KeyInfoComp> pkgDelaySuspendInfoMap_;
-    std::map<std::shared_ptr<KeyInfo>, int32_t, KeyInfoComp> pkgBgDurationMap_;
-    std::recursive_mutex recMutex_;
-    std::map<int32_t, std::set<int32_t>> foregroundUidPidMap_;
+    // 短时任务信息、进入后台时间及前台进程均由 lock_ 保护
+    TransientAppStateTable appStateTable_;
 };
 }  // namespace BackgroundTaskMgr
 }  // namespace OHOS
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_TRANSIENT_TASK_INCLUDE_EXPIRED_CALLBACK_REGISTRY_H
+#define FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_TRANSIENT_TASK_INCLUDE_EXPIRED_CALLBACK_REGISTRY_H
+
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <iremote_object.h>
+
+#include "iexpired_callback.h"
+
+namespace OHOS {
+namespace BackgroundTaskMgr {
+/**
+ * 短时任务回调表，以 requestId 为键，同时维护远端对象到 requestId 的反向索引，
+ * 用于重复回调校验和回调死亡处理。
+ */
+class ExpiredCallbackRegistry {
+public:
+    using CallbackMap = std::map<int32_t, sptr<IExpiredCallback>>;
+    using iterator = CallbackMap::iterator;
+    using const_iterator = CallbackMap::const_iterator;
+
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+    bool empty() const;
+    size_t size() const;
+    iterator find(int32_t requestId);
+    sptr<IExpiredCallback> &operator[](int32_t requestId);
+    void emplace(int32_t requestId, const sptr<IExpiredCallback> &callback);
+    iterator erase(iterator iter);
+    size_t erase(int32_t requestId);
+    void clear();
+
+    iterator FindByRemote(const wptr<IRemoteObject> &remote);
+    bool ContainsRemote(const sptr<IRemoteObject> &remote);
+    bool AddPendingRemote(const sptr<IRemoteObject> &remote);
+    void RemovePendingRemote(const sptr<IRemoteObject> &remote);
+
+private:
+    void AddIndex(int32_t requestId, const sptr<IExpiredCallback> &callback);
+    void RemoveIndex(int32_t requestId);
+    void CheckAndRebuildIndex();
+
+private:
+    CallbackMap callbacks_ {};
+    std::unordered_map<IRemoteObject *, int32_t> remoteIndex_ {};
+    std::unordered_map<int32_t, IRemoteObject *> indexedRemotes_ {};
+    // 已通过重复校验、正在决策中的回调
+    std::unordered_set<IRemoteObject *> pendingRemotes_ {};
+    bool indexDirty_ {false};
+};
+}  // namespace BackgroundTaskMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_TRANSIENT_TASK_INCLUDE_EXPIRED_CALLBACK_REGISTRY_H
@@ -43,6 +43,8 @@ public:
     void StopAccounting(const int32_t requestId);
     void StopAccountingAll();
     void UpdateQuota(bool reset = false);
+    void SyncQuotaEpoch(uint64_t epoch);
+    bool IsIdle(uint64_t epoch) const;
 
     inline const string& GetPkg() const
     {
@@ -69,13 +71,29 @@ public:
         return quota_;
     }
 
-    inline vector<shared_ptr<DelaySuspendInfoEx>> GetRequestList() const
+    inline uint64_t GetQuotaEpoch() const
+    {
+        return quotaEpoch_;
+    }
+
+    inline int64_t GetLastAccessTime() const
+    {
+        return lastAccessTime_;
+    }
+
+    inline void SetLastAccessTime(int64_t time)
+    {
+        lastAccessTime_ = time;
+    }
+
+    inline const vector<shared_ptr<DelaySuspendInfoEx>>& GetRequestList() const
     {
         return requestList_;
     }
 
 private:
     int32_t GetModifiedTime();
+    int32_t GetExemptedQuota();
 
 private:
     string pkg_ {""};
@@ -84,6 +102,13 @@ private:
     int32_t spendTime_ {0};
     int32_t baseTime_ {0};
     bool isCounting_ {false};
+    uint64_t quotaEpoch_ {0};
+    int64_t lastAccessTime_ {0};
+    // 按包缓存豁免名单归属及额度，配置版本变化时重新解析；签名不缓存
+    bool exemptionResolved_ {false};
+    uint64_t exemptionVersion_ {0};
+    bool exemptionListed_ {false};
+    int32_t exemptedQuota_ {0};
     shared_ptr<TimerManager> timerManager_ {nullptr};
     vector<shared_ptr<DelaySuspendInfoEx>> requestList_;
 };
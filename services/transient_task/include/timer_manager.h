@@ -34,6 +34,8 @@ public:
     void ProcessEvent(const AppExecFwk::InnerEvent::Pointer& event) override;
 
 private:
+    void HandleTimeout(int32_t requestId);
+
     wptr<BackgroundTaskMgrService> service_;
 };
 }  // namespace BackgroundTaskMgr
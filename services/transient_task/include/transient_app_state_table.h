@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_TRANSIENT_TASK_INCLUDE_TRANSIENT_APP_STATE_TABLE_H
+#define FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_TRANSIENT_TASK_INCLUDE_TRANSIENT_APP_STATE_TABLE_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "pkg_delay_suspend_info.h"
+
+namespace OHOS {
+namespace BackgroundTaskMgr {
+struct PkgTransientState {
+    std::string pkg_ {""};
+    std::shared_ptr<PkgDelaySuspendInfo> delayInfo_ {nullptr};
+    // 进入后台的时间，小于 0 表示未记录
+    int64_t bgStartTime_ {-1};
+};
+
+/**
+ * 短时任务决策使用的应用状态表，以 uid 为键，包名内联存储在 uid 桶内，
+ * 同时记录 uid 的前台进程，查找时无需构造 KeyInfo。
+ */
+class TransientAppStateTable {
+public:
+    using DelayInfoVisitor = std::function<void(const std::shared_ptr<PkgDelaySuspendInfo> &)>;
+    using DelayInfoPredicate = std::function<bool(const std::shared_ptr<PkgDelaySuspendInfo> &)>;
+
+    std::shared_ptr<PkgDelaySuspendInfo> FindDelayInfo(const std::string &pkg, int32_t uid) const;
+    void SetDelayInfo(const std::string &pkg, int32_t uid, const std::shared_ptr<PkgDelaySuspendInfo> &delayInfo);
+    void ForEachDelayInfo(const DelayInfoVisitor &visitor) const;
+    void EraseDelayInfoIf(const DelayInfoPredicate &predicate);
+    size_t DelayInfoSize() const;
+    void ClearDelayInfo();
+
+    bool GetBgStartTime(const std::string &pkg, int32_t uid, int64_t &bgStartTime) const;
+    void SetBgStartTime(const std::string &pkg, int32_t uid, int64_t bgStartTime);
+    void ClearBgStartTime(const std::string &pkg, int32_t uid);
+
+    void UpdateForegroundPid(int32_t uid, int32_t pid, bool isForeground);
+    bool IsUidForeground(int32_t uid) const;
+    void ClearForeground();
+
+private:
+    struct UidState {
+        std::vector<PkgTransientState> pkgs_;
+        std::vector<int32_t> foregroundPids_;
+    };
+
+    const PkgTransientState *FindPkg(const std::string &pkg, int32_t uid) const;
+    PkgTransientState *FindPkg(const std::string &pkg, int32_t uid);
+    PkgTransientState &EmplacePkg(const std::string &pkg, int32_t uid);
+    void Prune(int32_t uid);
+
+private:
+    std::unordered_map<int32_t, UidState> uidStates_ {};
+    size_t delayInfoCount_ {0};
+};
+}  // namespace BackgroundTaskMgr
+}  // namespace OHOS
+#endif  // FOUNDATION_RESOURCESCHEDULE_BACKGROUND_TASK_MGR_SERVICES_TRANSIENT_TASK_INCLUDE_TRANSIENT_APP_STATE_TABLE_H
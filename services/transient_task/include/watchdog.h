@@ -39,6 +39,7 @@ public:
     void ProcessEvent(const AppExecFwk::InnerEvent::Pointer& event) override;
 
 private:
+    void HandleWatchdog(int32_t requestId, const std::shared_ptr<KeyInfo>& info);
 
     wptr<BackgroundTaskMgrService> service_;
     std::unique_ptr<AppExecFwk::AppMgrClient> appMgrClient_;
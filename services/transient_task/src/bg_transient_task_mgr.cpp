@@ -32,11 +32,13 @@
 
 #include "background_task_mgr_service.h"
 #include "bgtask_hitrace_chain.h"
+#include "bundle_name_cache.h"
 #include "bgtaskmgr_inner_errors.h"
 #include "time_provider.h"
 #include "transient_task_log.h"
 #include "hitrace_meter.h"
 #include "background_task_observer.h"
+#include "subscriber_delivery_queue.h"
 
 using namespace std;
 
@@ -49,6 +51,7 @@ static const std::string OKAY_BATTARY_OPTION = "BATTARY_OKAY";
 static const std::string CANCEL_DUMP_OPTION = "DUMP_CANCEL";
 static const std::string PAUSE_DUMP_OPTION = "PAUSE";
 static const std::string START_DUMP_OPTION = "START";
+static const std::string STATE_DUMP_OPTION = "STATE";
 static const int32_t DUMP_PARAM_INDEX_TWO = 2;
 
 constexpr int32_t BG_INVALID_REMAIN_TIME = -1;
@@ -126,25 +129,7 @@ void BgTransientTaskMgr::InitNecessaryState(const std::shared_ptr<AppExecFwk::Ev
 
 bool BgTransientTaskMgr::GetBundleNamesForUid(int32_t uid, std::string &bundleName)
 {
-    sptr<ISystemAbilityManager> systemMgr = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
-    if (systemMgr == nullptr) {
-        BGTASK_LOGE("Fail to get system ability mgr");
-        return false;
-    }
-
-    sptr<IRemoteObject> remoteObject = systemMgr->GetSystemAbility(BUNDLE_MGR_SERVICE_SYS_ABILITY_ID);
-    if (remoteObject == nullptr) {
-        BGTASK_LOGE("Fail to get bundle manager proxy");
-        return false;
-    }
-
-    sptr<OHOS::AppExecFwk::IBundleMgr> bundleMgrProxy = iface_cast<OHOS::AppExecFwk::IBundleMgr>(remoteObject);
-    if (bundleMgrProxy == nullptr) {
-        BGTASK_LOGE("Bundle mgr proxy is nullptr");
-        return false;
-    }
-
-    if (bundleMgrProxy->GetNameForUid(uid, bundleName) != ERR_OK) {
+    if (!DelayedSingleton<BundleNameCache>::GetInstance()->GetBundleName(uid, bundleName)) {
         BGTASK_LOGE("Get bundle name failed");
         return false;
     }
@@ -201,26 +186,26 @@ ErrCode BgTransientTaskMgr::RequestSuspendDelay(const std::u16string& reason,
     auto infoEx = make_shared<DelaySuspendInfoEx>(pid);
     delayInfo = infoEx;
     auto remote = callback->AsObject();
-    lock_guard<mutex> lock(expiredCallbackLock_);
-    auto findCallback = [&callback](const auto& callbackMap) {
-        return callback->AsObject() == callbackMap.second->AsObject();
-    };
-
-    auto callbackIter = find_if(expiredCallbackMap_.begin(), expiredCallbackMap_.end(), findCallback);
-    if (callbackIter != expiredCallbackMap_.end()) {
-        BGTASK_LOGI("%{public}s request suspend failed, callback is already exists.", name.c_str());
-        return ERR_BGTASK_CALLBACK_EXISTS;
+    {
+        lock_guard<mutex> lock(expiredCallbackLock_);
+        if (!expiredCallbackMap_.AddPendingRemote(remote)) {
+            BGTASK_LOGI("%{public}s request suspend failed, callback is already exists.", name.c_str());
+            return ERR_BGTASK_CALLBACK_EXISTS;
+        }
     }
 
+    // 决策由 DecisionMaker 自身加锁，回调已被标记为待定，无需持有 expiredCallbackLock_
     auto keyInfo = make_shared<KeyInfo>(name, uid, pid);
     ret = decisionMaker_->Decide(keyInfo, infoEx);
+    lock_guard<mutex> lock(expiredCallbackLock_);
+    expiredCallbackMap_.RemovePendingRemote(remote);
     if (ret != ERR_OK) {
         BGTASK_LOGI("%{public}s request suspend failed.", name.c_str());
         return ret;
     }
     BGTASK_LOGI("request suspend success, pkg : %{public}s, uid : %{public}d, pid : %{public}d, requestId: %{public}d,"
         "delayTime: %{public}d", name.c_str(), uid, pid, infoEx->GetRequestId(), infoEx->GetActualDelayTime());
-    expiredCallbackMap_[infoEx->GetRequestId()] = callback;
+    expiredCallbackMap_.emplace(infoEx->GetRequestId(), callback);
     keyInfoMap_[infoEx->GetRequestId()] = keyInfo;
     if (callbackDeathRecipient_ != nullptr) {
         (void)remote->AddDeathRecipient(callbackDeathRecipient_);
@@ -250,7 +235,30 @@ ErrCode BgTransientTaskMgr::PauseTransientTaskTimeForInner(int32_t uid)
     if (!CheckProcessName()) {
         return ERR_BGTASK_INVALID_PROCESS_NAME;
     }
+    return HandlePauseTransientTaskTime(uid);
+}
+
+ErrCode BgTransientTaskMgr::PauseTransientTaskTimesForInner(const std::vector<int32_t> &uids,
+    std::vector<int32_t> &results)
+{
+    results.assign(uids.size(), ERR_BGTASK_SYS_NOT_READY);
+    if (!isReady_.load()) {
+        BGTASK_LOGW("Transient task manager is not ready.");
+        return ERR_BGTASK_SYS_NOT_READY;
+    }
 
+    if (!CheckProcessName()) {
+        results.assign(uids.size(), ERR_BGTASK_INVALID_PROCESS_NAME);
+        return ERR_BGTASK_INVALID_PROCESS_NAME;
+    }
+    for (size_t i = 0; i < uids.size(); i++) {
+        results[i] = HandlePauseTransientTaskTime(uids[i]);
+    }
+    return ERR_OK;
+}
+
+ErrCode BgTransientTaskMgr::HandlePauseTransientTaskTime(int32_t uid)
+{
     if (uid < 0) {
         BGTASK_LOGE("PauseTransientTaskTimeForInner uid is invalid.");
         return ERR_BGTASK_INVALID_PID_OR_UID;
@@ -325,40 +333,44 @@ void BgTransientTaskMgr::NotifyTransientTaskSuscriber(const shared_ptr<Transient
         BGTASK_LOGE("NotifyTransientTaskSuscriber failed, appInfo is null.");
         return;
     }
-    const TransientTaskAppInfo& appInfoRef = *appInfo;
+    SubscriberDeliveryQueue::DeliveryTask task;
     switch (type) {
         case TransientTaskEventType::TASK_START:
             BackgroundTaskObserver::GetInstance().OnTransientTaskStart(appInfo);
-            for (auto iter = subscriberList_.begin(); iter != subscriberList_.end(); iter++) {
-                (*iter)->OnTransientTaskStart(appInfoRef);
-            }
+            task = [appInfo](const sptr<IBackgroundTaskSubscriber> &subscriber) {
+                subscriber->OnTransientTaskStart(*appInfo);
+            };
             break;
         case TransientTaskEventType::TASK_END:
             BackgroundTaskObserver::GetInstance().OnTransientTaskEnd(appInfo);
-            for (auto iter = subscriberList_.begin(); iter != subscriberList_.end(); iter++) {
-                (*iter)->OnTransientTaskEnd(appInfoRef);
-            }
+            task = [appInfo](const sptr<IBackgroundTaskSubscriber> &subscriber) {
+                subscriber->OnTransientTaskEnd(*appInfo);
+            };
             break;
         case TransientTaskEventType::TASK_ERR:
             BackgroundTaskObserver::GetInstance().OnTransientTaskErr(appInfo);
-            for (auto iter = subscriberList_.begin(); iter != subscriberList_.end(); iter++) {
-                (*iter)->OnTransientTaskErr(appInfoRef);
-            }
+            task = [appInfo](const sptr<IBackgroundTaskSubscriber> &subscriber) {
+                subscriber->OnTransientTaskErr(*appInfo);
+            };
             break;
         case TransientTaskEventType::APP_TASK_START:
             BackgroundTaskObserver::GetInstance().OnAppTransientTaskStart(appInfo);
-            for (auto iter = subscriberList_.begin(); iter != subscriberList_.end(); iter++) {
-                (*iter)->OnAppTransientTaskStart(appInfoRef);
-            }
+            task = [appInfo](const sptr<IBackgroundTaskSubscriber> &subscriber) {
+                subscriber->OnAppTransientTaskStart(*appInfo);
+            };
             break;
         case TransientTaskEventType::APP_TASK_END:
             BackgroundTaskObserver::GetInstance().OnAppTransientTaskEnd(appInfo);
-            for (auto iter = subscriberList_.begin(); iter != subscriberList_.end(); iter++) {
-                (*iter)->OnAppTransientTaskEnd(appInfoRef);
-            }
+            task = [appInfo](const sptr<IBackgroundTaskSubscriber> &subscriber) {
+                subscriber->OnAppTransientTaskEnd(*appInfo);
+            };
             break;
         default:
-            break;
+            return;
+    }
+    auto deliveryQueue = DelayedSingleton<SubscriberDeliveryQueue>::GetInstance();
+    for (auto iter = subscriberList_.begin(); iter != subscriberList_.end(); iter++) {
+        deliveryQueue->Deliver(DeliveryModule::TRANSIENT_TASK, *iter, task);
     }
 }
 
@@ -528,11 +540,7 @@ void BgTransientTaskMgr::HandleExpiredCallbackDeath(const wptr<IRemoteObject>& r
     }
 
     lock_guard<mutex> lock(expiredCallbackLock_);
-    auto findCallback = [&remote](const auto& callbackMap) {
-        return callbackMap.second->AsObject() == remote;
-    };
-
-    auto callbackIter = find_if(expiredCallbackMap_.begin(), expiredCallbackMap_.end(), findCallback);
+    auto callbackIter = expiredCallbackMap_.FindByRemote(remote);
     if (callbackIter == expiredCallbackMap_.end()) {
         BGTASK_LOGE("expiredCallback death, remote in callback not found.");
         return;
@@ -570,6 +578,8 @@ void BgTransientTaskMgr::HandleSubscriberDeath(const wptr<IRemoteObject>& remote
         }
 
         subscriberList_.erase(subscriberIter);
+        DelayedSingleton<SubscriberDeliveryQueue>::GetInstance()->RemoveSubscriber(
+            DeliveryModule::TRANSIENT_TASK, remote);
         BGTASK_LOGI("suscriber death, remove it.");
     });
 }
@@ -648,6 +658,8 @@ ErrCode BgTransientTaskMgr::UnsubscribeBackgroundTask(const sptr<IBackgroundTask
         }
         remote->RemoveDeathRecipient(susriberDeathRecipient_);
         subscriberList_.erase(subscriberIter);
+        DelayedSingleton<SubscriberDeliveryQueue>::GetInstance()->RemoveSubscriber(
+            DeliveryModule::TRANSIENT_TASK, remote);
         BGTASK_LOGI("unsubscribe transient task success.");
     });
     return ERR_OK;
@@ -723,6 +735,9 @@ ErrCode BgTransientTaskMgr::ShellDump(const std::vector<std::string> &dumpOption
     } else if (dumpOption[1] == START_DUMP_OPTION) {
         DumpTaskTime(dumpOption, false, dumpInfo);
         result = true;
+    } else if (dumpOption[1] == STATE_DUMP_OPTION) {
+        decisionMaker_->DumpAppState(dumpInfo);
+        result = true;
     } else {
         dumpInfo.push_back("Error transient dump command!\n");
     }
@@ -922,5 +937,10 @@ std::shared_ptr<DecisionMaker> BgTransientTaskMgr::GetDecisionMaker()
 {
     return decisionMaker_;
 }
+
+std::shared_ptr<AppExecFwk::EventHandler> BgTransientTaskMgr::GetHandler() const
+{
+    return handler_;
+}
 }  // namespace BackgroundTaskMgr
 }  // namespace OHOS
\ No newline at end of file
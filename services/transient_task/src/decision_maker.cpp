@@ -15,7 +15,10 @@
 
 #include "decision_maker.h"
 
+#include <algorithm>
+#include <cinttypes>
 #include <climits>
+#include <sstream>
 
 #include "bg_transient_task_mgr.h"
 #include "bgtask_common.h"
@@ -40,6 +43,7 @@ DecisionMaker::DecisionMaker(const shared_ptr<TimerManager>& timerManager, const
     lock_guard<mutex> lock(lock_);
     timerManager_ = timerManager;
     deviceInfoManager_ = device;
+    lastRequestTime_ = TimeProvider::GetCurrentTime();
 }
 
 DecisionMaker::~DecisionMaker() {}
@@ -68,15 +72,14 @@ void DecisionMaker::OnProcessDied(const AppExecFwk::ProcessData &processData)
 ErrCode DecisionMaker::TryStartAccounting(int32_t uid, const std::string &bundleName)
 {
     lock_guard<mutex> lock(lock_);
-    auto key = std::make_shared<KeyInfo>(bundleName, uid);
-    auto it = pkgDelaySuspendInfoMap_.find(key);
-    if (it == pkgDelaySuspendInfoMap_.end()) {
+    auto pkgInfo = FindDelayInfoLocked(bundleName, uid);
+    if (pkgInfo == nullptr) {
         BGTASK_LOGD("pkgname: %{public}s, uid: %{public}d not request transient task.", bundleName.c_str(), uid);
         return ERR_BGTASK_NOREQUEST_TASK;
     }
-    if (CanStartAccountingLocked(it->second)) {
+    if (CanStartAccountingLocked(pkgInfo)) {
         BGTASK_LOGD("pkgname: %{public}s, uid: %{public}d start accounting", bundleName.c_str(), uid);
-        it->second->StartAccounting();
+        pkgInfo->StartAccounting();
         return ERR_OK;
     } else {
         BGTASK_LOGD("pkgname: %{public}s, uid: %{public}d can't start accounting", bundleName.c_str(), uid);
@@ -86,55 +89,45 @@ ErrCode DecisionMaker::TryStartAccounting(int32_t uid, const std::string &bundle
 
 void DecisionMaker::UpdateForegroundUidPidMap(int32_t uid, int32_t pid, bool isForeground)
 {
-    lock_guard<recursive_mutex> lock(recMutex_);
-    set<int32_t>& pids = foregroundUidPidMap_[uid];
-    if (isForeground) {
-        pids.insert(pid);
-    } else {
-        pids.erase(pid);
-        if (pids.empty()) {
-            foregroundUidPidMap_.erase(uid);
-        }
-    }
+    lock_guard<mutex> lock(lock_);
+    appStateTable_.UpdateForegroundPid(uid, pid, isForeground);
 }
 
 bool DecisionMaker::IsUidForeground(int32_t uid)
 {
-    lock_guard<recursive_mutex> lock(recMutex_);
-    return foregroundUidPidMap_.count(uid) != 0;
+    lock_guard<mutex> lock(lock_);
+    return IsUidForegroundLocked(uid);
+}
+
+bool DecisionMaker::IsUidForegroundLocked(int32_t uid)
+{
+    return appStateTable_.IsUidForeground(uid);
 }
 
 void DecisionMaker::HandleStateChange(
     const std::string &bundleName, int32_t uid, bool isForeground, bool isBackground)
 {
     lock_guard<mutex> lock(lock_);
-    auto key = std::make_shared<KeyInfo>(bundleName, uid);
-
     if (isForeground) {
-        auto it = pkgDelaySuspendInfoMap_.find(key);
-        if (it != pkgDelaySuspendInfoMap_.end()) {
-            auto pkgInfo = it->second;
+        auto pkgInfo = FindDelayInfoLocked(bundleName, uid);
+        if (pkgInfo != nullptr) {
             BGTASK_LOGD("pkgname: %{public}s, uid: %{public}d is foreground, stop accounting",
                 bundleName.c_str(), uid);
             pkgInfo->StopAccountingAll();
         }
-        auto itBg = pkgBgDurationMap_.find(key);
-        if (itBg != pkgBgDurationMap_.end()) {
-            pkgBgDurationMap_.erase(itBg);
-        }
+        appStateTable_.ClearBgStartTime(bundleName, uid);
     } else if (isBackground) {
-        auto it = pkgDelaySuspendInfoMap_.find(key);
-        if (it == pkgDelaySuspendInfoMap_.end()) {
+        auto pkgInfo = FindDelayInfoLocked(bundleName, uid);
+        if (pkgInfo == nullptr) {
             BGTASK_LOGD("pkgname: %{public}s, uid: %{public}d is not in delay suspend list",
                 bundleName.c_str(), uid);
             return;
         }
-        auto pkgInfo = it->second;
         if (CanStartAccountingLocked(pkgInfo)) {
             BGTASK_LOGD("pkgname: %{public}s, uid: %{public}d is background, start accounting",
                 bundleName.c_str(), uid);
             pkgInfo->StartAccounting();
-            pkgBgDurationMap_[key] = TimeProvider::GetCurrentTime();
+            appStateTable_.SetBgStartTime(bundleName, uid, TimeProvider::GetCurrentTime());
         }
     }
 }
@@ -184,22 +177,24 @@ ErrCode DecisionMaker::Decide(const std::shared_ptr<KeyInfo>& key, const std::sh
         return ERR_BGTASK_NO_MEMORY;
     }
 
-    ResetDayQuotaLocked();
-    auto findBgDurationIt = pkgBgDurationMap_.find(key);
-    if (findBgDurationIt != pkgBgDurationMap_.end()) {
-        if (TimeProvider::GetCurrentTime() - findBgDurationIt->second > GetAllowRequestTime()) {
-            BGTASK_LOGI("Request not allow after entering background for a valid duration, %{public}s",
-                key->ToString().c_str());
-            return ERR_BGTASK_NOT_IN_PRESET_TIME;
-        }
-    }
     const string &name = key->GetPkg();
     int32_t uid = key->GetUid();
-    auto findInfoIt = pkgDelaySuspendInfoMap_.find(key);
-    if (findInfoIt == pkgDelaySuspendInfoMap_.end()) {
-        pkgDelaySuspendInfoMap_[key] = make_shared<PkgDelaySuspendInfo>(name, uid, timerManager_);
+    int64_t bgStartTime = 0;
+    if (appStateTable_.GetBgStartTime(name, uid, bgStartTime) &&
+        TimeProvider::GetCurrentTime() - bgStartTime > GetAllowRequestTime()) {
+        BGTASK_LOGI("Request not allow after entering background for a valid duration, %{public}s",
+            key->ToString().c_str());
+        return ERR_BGTASK_NOT_IN_PRESET_TIME;
+    }
+    auto pkgInfo = FindDelayInfoLocked(name, uid);
+    if (pkgInfo == nullptr) {
+        int64_t currentTime = TimeProvider::GetCurrentTime();
+        EvictIdleDelayInfoLocked(currentTime);
+        pkgInfo = make_shared<PkgDelaySuspendInfo>(name, uid, timerManager_);
+        pkgInfo->SyncQuotaEpoch(quotaEpoch_);
+        pkgInfo->SetLastAccessTime(currentTime);
+        appStateTable_.SetDelayInfo(name, uid, pkgInfo);
     }
-    auto pkgInfo = pkgDelaySuspendInfoMap_[key];
     bool needSetTime = false;
     ErrCode ret = CheckQuotaTime(pkgInfo, name, uid, key, needSetTime);
     if (ret != ERR_OK) {
@@ -233,13 +228,11 @@ ErrCode DecisionMaker::PauseTransientTaskTimeForInner(int32_t uid, const std::st
         return ERR_BGTASK_FOREGROUND;
     }
     lock_guard<mutex> lock(lock_);
-    auto key = std::make_shared<KeyInfo>(name, uid);
-    auto it = pkgDelaySuspendInfoMap_.find(key);
-    if (it == pkgDelaySuspendInfoMap_.end()) {
+    auto pkgInfo = FindDelayInfoLocked(name, uid);
+    if (pkgInfo == nullptr) {
         BGTASK_LOGE("pkgname: %{public}s, uid: %{public}d not request transient task.", name.c_str(), uid);
         return ERR_BGTASK_NOREQUEST_TASK;
     }
-    auto pkgInfo = it->second;
     pkgInfo->StopAccountingAll();
     return ERR_OK;
 }
@@ -266,9 +259,8 @@ void DecisionMaker::RemoveRequest(const std::shared_ptr<KeyInfo>& key, const int
         return;
     }
 
-    auto findInfoIt = pkgDelaySuspendInfoMap_.find(key);
-    if (findInfoIt != pkgDelaySuspendInfoMap_.end()) {
-        auto pkgInfo = findInfoIt->second;
+    auto pkgInfo = FindDelayInfoLocked(key->GetPkg(), key->GetUid());
+    if (pkgInfo != nullptr) {
         pkgInfo->RemoveRequest(requestId);
         auto appInfo = make_shared<TransientTaskAppInfo>(key->GetPkg(), key->GetUid(), key->GetPid());
         DelayedSingleton<BgTransientTaskMgr>::GetInstance()
@@ -294,9 +286,8 @@ int32_t DecisionMaker::GetRemainingDelayTime(const std::shared_ptr<KeyInfo>& key
         return -1;
     }
 
-    auto it = pkgDelaySuspendInfoMap_.find(key);
-    if (it != pkgDelaySuspendInfoMap_.end()) {
-        auto pkgInfo = it->second;
+    auto pkgInfo = FindDelayInfoLocked(key->GetPkg(), key->GetUid());
+    if (pkgInfo != nullptr) {
         return pkgInfo->GetRemainDelayTime(requestId);
     }
     return -1;
@@ -310,9 +301,8 @@ vector<int32_t> DecisionMaker::GetRequestIdListByKey(const std::shared_ptr<KeyIn
         BGTASK_LOGE("GetRequestListByKey, key is null.");
         return requestIdList;
     }
-    auto it = pkgDelaySuspendInfoMap_.find(key);
-    if (it != pkgDelaySuspendInfoMap_.end()) {
-        auto pkgInfo = it->second;
+    auto pkgInfo = FindDelayInfoLocked(key->GetPkg(), key->GetUid());
+    if (pkgInfo != nullptr) {
         for (const auto &task : pkgInfo->GetRequestList()) {
             requestIdList.emplace_back(task->GetRequestId());
         }
@@ -331,9 +321,8 @@ int32_t DecisionMaker::GetQuota(const std::shared_ptr<KeyInfo>& key)
         return -1;
     }
 
-    auto it = pkgDelaySuspendInfoMap_.find(key);
-    if (it != pkgDelaySuspendInfoMap_.end()) {
-        auto pkgInfo = it->second;
+    auto pkgInfo = FindDelayInfoLocked(key->GetPkg(), key->GetUid());
+    if (pkgInfo != nullptr) {
         pkgInfo->UpdateQuota();
         return pkgInfo->GetQuota();
     }
@@ -364,7 +353,7 @@ bool DecisionMaker::CanStartAccountingLocked(const std::shared_ptr<PkgDelaySuspe
             uid, bundleName.c_str());
         return true;
     }
-    return !IsUidForeground(uid);
+    return !IsUidForegroundLocked(uid);
 }
 
 int32_t DecisionMaker::GetDelayTime()
@@ -386,16 +375,81 @@ void DecisionMaker::ResetDayQuotaLocked()
     if (!IsAfterOneDay(lastRequestTime_, currentTime)) {
         return;
     }
-    for (auto iter = pkgDelaySuspendInfoMap_.begin(); iter != pkgDelaySuspendInfoMap_.end();) {
-        auto pkgInfo = iter->second;
-        if (pkgInfo->IsRequestEmpty()) {
-            iter = pkgDelaySuspendInfoMap_.erase(iter);
-        } else {
-            pkgInfo->UpdateQuota(true);
-            iter++;
+    quotaEpoch_++;
+    lastRequestTime_ = currentTime;
+    BGTASK_LOGI("quota epoch advance to %{public}" PRIu64, quotaEpoch_);
+}
+
+std::shared_ptr<PkgDelaySuspendInfo> DecisionMaker::FindDelayInfoLocked(const std::string &pkg, int32_t uid)
+{
+    ResetDayQuotaLocked();
+    auto pkgInfo = appStateTable_.FindDelayInfo(pkg, uid);
+    if (pkgInfo == nullptr) {
+        return nullptr;
+    }
+    pkgInfo->SetLastAccessTime(TimeProvider::GetCurrentTime());
+    if (pkgInfo->GetQuotaEpoch() == quotaEpoch_) {
+        return pkgInfo;
+    }
+    // 跨额度周期且无请求的应用直接移除，下次申请时按初始额度重建
+    if (pkgInfo->IsRequestEmpty()) {
+        appStateTable_.SetDelayInfo(pkg, uid, nullptr);
+        evictedCount_++;
+        return nullptr;
+    }
+    pkgInfo->SyncQuotaEpoch(quotaEpoch_);
+    return pkgInfo;
+}
+
+void DecisionMaker::EvictIdleDelayInfoLocked(int64_t currentTime)
+{
+    auto config = DelayedSingleton<BgtaskConfig>::GetInstance();
+    size_t maxSize = static_cast<size_t>(config->GetTransientTaskStateMaxSize());
+    int64_t idleTime = config->GetTransientTaskStateIdleTime();
+    size_t size = appStateTable_.DelayInfoSize();
+    bool overSize = size >= maxSize;
+    if (!overSize && currentTime - lastEvictTime_ < idleTime) {
+        return;
+    }
+    lastEvictTime_ = currentTime;
+    int64_t evictBefore = currentTime - idleTime;
+    if (overSize) {
+        // 超出上限时按最近访问时间淘汰最久未用的空闲应用，为新应用腾出空间
+        std::vector<int64_t> idleAccessTimes;
+        appStateTable_.ForEachDelayInfo([this, &idleAccessTimes](const std::shared_ptr<PkgDelaySuspendInfo> &pkgInfo) {
+            if (pkgInfo->IsIdle(quotaEpoch_)) {
+                idleAccessTimes.emplace_back(pkgInfo->GetLastAccessTime());
+            }
+        });
+        if (!idleAccessTimes.empty()) {
+            size_t index = std::min(size - maxSize, idleAccessTimes.size() - 1);
+            std::nth_element(idleAccessTimes.begin(), idleAccessTimes.begin() + index, idleAccessTimes.end());
+            evictBefore = std::max(evictBefore, idleAccessTimes[index]);
         }
     }
-    lastRequestTime_ = currentTime;
+    appStateTable_.EraseDelayInfoIf([this, evictBefore](const std::shared_ptr<PkgDelaySuspendInfo> &pkgInfo) {
+        return pkgInfo->IsIdle(quotaEpoch_) && pkgInfo->GetLastAccessTime() <= evictBefore;
+    });
+    size_t evicted = size - appStateTable_.DelayInfoSize();
+    evictedCount_ += evicted;
+    if (evicted > 0) {
+        BGTASK_LOGI("evict %{public}zu idle transient app state, remain %{public}zu", evicted,
+            appStateTable_.DelayInfoSize());
+    }
+}
+
+void DecisionMaker::DumpAppState(std::vector<std::string> &dumpInfo)
+{
+    lock_guard<mutex> lock(lock_);
+    auto config = DelayedSingleton<BgtaskConfig>::GetInstance();
+    std::stringstream stream;
+    stream << "Transient app state:\n";
+    stream << "\tSize: " << appStateTable_.DelayInfoSize() << "\n";
+    stream << "\tMaxSize: " << config->GetTransientTaskStateMaxSize() << "\n";
+    stream << "\tIdleTime: " << config->GetTransientTaskStateIdleTime() << "\n";
+    stream << "\tEvicted: " << evictedCount_ << "\n";
+    stream << "\tQuotaEpoch: " << quotaEpoch_ << "\n";
+    dumpInfo.push_back(stream.str());
 }
 
 bool DecisionMaker::IsAfterOneDay(int64_t lastRequestTime, int64_t currentTime)
@@ -433,10 +487,8 @@ void DecisionMaker::HandleScreenOn()
         return;
     }
     for (auto fgApp : fgAppList) {
-        auto key = std::make_shared<KeyInfo>(fgApp.bundleName, fgApp.uid);
-        auto it = pkgDelaySuspendInfoMap_.find(key);
-        if (it != pkgDelaySuspendInfoMap_.end()) {
-            auto pkgInfo = it->second;
+        auto pkgInfo = FindDelayInfoLocked(fgApp.bundleName, fgApp.uid);
+        if (pkgInfo != nullptr) {
             BGTASK_LOGI("screen is on and uid: %{public}d is foreground app, stop accounting", fgApp.uid);
             pkgInfo->StopAccountingAll();
         }
@@ -446,23 +498,24 @@ void DecisionMaker::HandleScreenOn()
 void DecisionMaker::HandleScreenOff()
 {
     lock_guard<mutex> lock(lock_);
+    ResetDayQuotaLocked();
     std::set<int32_t> &transientPauseUid = DelayedSingleton<BgTransientTaskMgr>::GetInstance()
         ->GetTransientPauseUid();
-    for (const auto &p : pkgDelaySuspendInfoMap_) {
-        auto pkgInfo = p.second;
+    appStateTable_.ForEachDelayInfo([this, &transientPauseUid](const std::shared_ptr<PkgDelaySuspendInfo> &pkgInfo) {
         auto findUid = [&pkgInfo](const auto &target) {
             return pkgInfo->GetUid() == target;
         };
         auto findUidIter = find_if(transientPauseUid.begin(), transientPauseUid.end(), findUid);
         if (findUidIter != transientPauseUid.end()) {
             BGTASK_LOGI("uid: %{public}d transient task freeze, not can start.", pkgInfo->GetUid());
-            continue;
+            return;
         }
         if (CanStartAccountingLocked(pkgInfo)) {
             BGTASK_LOGI("screen is off and uid: %{public}d is not freeze, start accounting", pkgInfo->GetUid());
+            pkgInfo->SyncQuotaEpoch(quotaEpoch_);
             pkgInfo->StartAccounting();
         }
-    }
+    });
 }
 }  // namespace BackgroundTaskMgr
 }  // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "expired_callback_registry.h"
+
+namespace OHOS {
+namespace BackgroundTaskMgr {
+ExpiredCallbackRegistry::iterator ExpiredCallbackRegistry::begin()
+{
+    return callbacks_.begin();
+}
+
+ExpiredCallbackRegistry::iterator ExpiredCallbackRegistry::end()
+{
+    return callbacks_.end();
+}
+
+ExpiredCallbackRegistry::const_iterator ExpiredCallbackRegistry::begin() const
+{
+    return callbacks_.begin();
+}
+
+ExpiredCallbackRegistry::const_iterator ExpiredCallbackRegistry::end() const
+{
+    return callbacks_.end();
+}
+
+bool ExpiredCallbackRegistry::empty() const
+{
+    return callbacks_.empty();
+}
+
+size_t ExpiredCallbackRegistry::size() const
+{
+    return callbacks_.size();
+}
+
+ExpiredCallbackRegistry::iterator ExpiredCallbackRegistry::find(int32_t requestId)
+{
+    return callbacks_.find(requestId);
+}
+
+sptr<IExpiredCallback> &ExpiredCallbackRegistry::operator[](int32_t requestId)
+{
+    // 返回的引用可能被直接赋值，索引延迟到下次查询时重建
+    indexDirty_ = true;
+    return callbacks_[requestId];
+}
+
+void ExpiredCallbackRegistry::emplace(int32_t requestId, const sptr<IExpiredCallback> &callback)
+{
+    if (!indexDirty_) {
+        RemoveIndex(requestId);
+    }
+    callbacks_[requestId] = callback;
+    if (!indexDirty_) {
+        AddIndex(requestId, callback);
+    }
+}
+
+ExpiredCallbackRegistry::iterator ExpiredCallbackRegistry::erase(iterator iter)
+{
+    if (!indexDirty_) {
+        RemoveIndex(iter->first);
+    }
+    return callbacks_.erase(iter);
+}
+
+size_t ExpiredCallbackRegistry::erase(int32_t requestId)
+{
+    auto iter = callbacks_.find(requestId);
+    if (iter == callbacks_.end()) {
+        return 0;
+    }
+    erase(iter);
+    return 1;
+}
+
+void ExpiredCallbackRegistry::clear()
+{
+    callbacks_.clear();
+    remoteIndex_.clear();
+    indexedRemotes_.clear();
+    indexDirty_ = false;
+}
+
+ExpiredCallbackRegistry::iterator ExpiredCallbackRegistry::FindByRemote(const wptr<IRemoteObject> &remote)
+{
+    CheckAndRebuildIndex();
+    auto iter = remoteIndex_.find(remote.GetRefPtr());
+    if (iter == remoteIndex_.end()) {
+        return callbacks_.end();
+    }
+    return callbacks_.find(iter->second);
+}
+
+bool ExpiredCallbackRegistry::ContainsRemote(const sptr<IRemoteObject> &remote)
+{
+    if (pendingRemotes_.find(remote.GetRefPtr()) != pendingRemotes_.end()) {
+        return true;
+    }
+    return FindByRemote(remote) != callbacks_.end();
+}
+
+bool ExpiredCallbackRegistry::AddPendingRemote(const sptr<IRemoteObject> &remote)
+{
+    if (ContainsRemote(remote)) {
+        return false;
+    }
+    pendingRemotes_.insert(remote.GetRefPtr());
+    return true;
+}
+
+void ExpiredCallbackRegistry::RemovePendingRemote(const sptr<IRemoteObject> &remote)
+{
+    pendingRemotes_.erase(remote.GetRefPtr());
+}
+
+void ExpiredCallbackRegistry::AddIndex(int32_t requestId, const sptr<IExpiredCallback> &callback)
+{
+    if (callback == nullptr || callback->AsObject() == nullptr) {
+        return;
+    }
+    IRemoteObject *remote = callback->AsObject().GetRefPtr();
+    remoteIndex_[remote] = requestId;
+    indexedRemotes_[requestId] = remote;
+}
+
+void ExpiredCallbackRegistry::RemoveIndex(int32_t requestId)
+{
+    auto iter = indexedRemotes_.find(requestId);
+    if (iter == indexedRemotes_.end()) {
+        return;
+    }
+    auto remoteIter = remoteIndex_.find(iter->second);
+    if (remoteIter != remoteIndex_.end() && remoteIter->second == requestId) {
+        remoteIndex_.erase(remoteIter);
+    }
+    indexedRemotes_.erase(iter);
+}
+
+void ExpiredCallbackRegistry::CheckAndRebuildIndex()
+{
+    if (!indexDirty_) {
+        return;
+    }
+    remoteIndex_.clear();
+    indexedRemotes_.clear();
+    for (const auto &callback : callbacks_) {
+        AddIndex(callback.first, callback.second);
+    }
+    indexDirty_ = false;
+}
+}  // namespace BackgroundTaskMgr
+}  // namespace OHOS
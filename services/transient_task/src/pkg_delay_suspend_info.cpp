@@ -151,17 +151,43 @@ void PkgDelaySuspendInfo::UpdateQuota(bool reset)
         uid_, quota_, spendTime_, isCounting_);
 }
 
-int32_t PkgDelaySuspendInfo::GetModifiedTime()
+void PkgDelaySuspendInfo::SyncQuotaEpoch(uint64_t epoch)
 {
-    bool isExemptedApp = DelayedSingleton<BgtaskConfig>::GetInstance()->
-        IsTransientTaskExemptedQuatoApp(pkg_);
-    int32_t exempted_quota = 0;
-    if (isExemptedApp) {
-        exempted_quota = DelayedSingleton<BgtaskConfig>::GetInstance()->GetTransientTaskExemptedQuato();
+    if (quotaEpoch_ == epoch) {
+        return;
     }
-    BGTASK_LOGD("bundleName: %{public}s exempted: %{public}d exempted_quota: %{public}d",
-        pkg_.c_str(), isExemptedApp, exempted_quota);
-    int32_t time = static_cast<int32_t>(TimeProvider::GetCurrentTime()) - baseTime_ - exempted_quota;
+    UpdateQuota(true);
+    quotaEpoch_ = epoch;
+}
+
+bool PkgDelaySuspendInfo::IsIdle(uint64_t epoch) const
+{
+    // 无请求且额度已满(或已跨额度周期)，移除后重建与保留等价
+    return requestList_.empty() && !isCounting_ && (quota_ >= INIT_QUOTA || quotaEpoch_ != epoch);
+}
+
+int32_t PkgDelaySuspendInfo::GetExemptedQuota()
+{
+    auto config = DelayedSingleton<BgtaskConfig>::GetInstance();
+    uint64_t version = config->GetTransientConfigVersion();
+    if (!exemptionResolved_ || exemptionVersion_ != version) {
+        exemptionListed_ = config->IsTransientTaskExemptedQuatoListed(pkg_);
+        exemptedQuota_ = exemptionListed_ ? config->GetTransientTaskExemptedQuato() : 0;
+        exemptionVersion_ = version;
+        exemptionResolved_ = true;
+        BGTASK_LOGD("bundleName: %{public}s listed: %{public}d exempted_quota: %{public}d",
+            pkg_.c_str(), exemptionListed_, exemptedQuota_);
+    }
+    // 签名随应用安装更新而变化，与配置版本无关，名单内应用每次重新校验
+    if (!exemptionListed_ || !config->CheckSignature(pkg_)) {
+        return 0;
+    }
+    return exemptedQuota_;
+}
+
+int32_t PkgDelaySuspendInfo::GetModifiedTime()
+{
+    int32_t time = static_cast<int32_t>(TimeProvider::GetCurrentTime()) - baseTime_ - GetExemptedQuota();
     return (time < 0) ? 0 : time;
 }
 
@@ -16,6 +16,7 @@
 #include "timer_manager.h"
 
 #include "background_task_mgr_service.h"
+#include "timer_wheel.h"
 #include "transient_task_log.h"
 
 namespace OHOS {
@@ -32,13 +33,23 @@ TimerManager::TimerManager(const wptr<BackgroundTaskMgrService>& service,
 bool TimerManager::AddTimer(int32_t requestId, int32_t interval)
 {
     BGTASK_LOGI("Add request id: %{public}d", requestId);
-    return SendEvent(requestId, 0, interval);
+    std::weak_ptr<TimerManager> weak = std::static_pointer_cast<TimerManager>(shared_from_this());
+    auto task = [weak, requestId]() {
+        auto timerManager = weak.lock();
+        if (timerManager == nullptr) {
+            return;
+        }
+        timerManager->HandleTimeout(requestId);
+    };
+    return DelayedSingleton<TimerWheel>::GetInstance()->AddTimer(TimerWheelModule::TRANSIENT_TASK_EXPIRED,
+        requestId, interval, task, shared_from_this());
 }
 
 void TimerManager::RemoveTimer(int32_t requestId)
 {
     BGTASK_LOGI("Remove request id: %{public}d", requestId);
-    return RemoveEvent(requestId);
+    // 已到期但尚未执行的回调同样由时间轮取消
+    DelayedSingleton<TimerWheel>::GetInstance()->RemoveTimer(TimerWheelModule::TRANSIENT_TASK_EXPIRED, requestId);
 }
 
 void TimerManager::ProcessEvent(const AppExecFwk::InnerEvent::Pointer& event)
@@ -46,7 +57,11 @@ void TimerManager::ProcessEvent(const AppExecFwk::InnerEvent::Pointer& event)
     if (event == nullptr) {
         return;
     }
-    int32_t requestId = event->GetInnerEventId();
+    HandleTimeout(event->GetInnerEventId());
+}
+
+void TimerManager::HandleTimeout(int32_t requestId)
+{
     auto bgTask = service_.promote();
     if (bgTask == nullptr) {
         return;
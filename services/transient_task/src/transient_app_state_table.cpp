@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "transient_app_state_table.h"
+
+#include <algorithm>
+
+namespace OHOS {
+namespace BackgroundTaskMgr {
+namespace {
+    constexpr int64_t INVALID_BG_START_TIME = -1;
+
+    bool IsPkgStateEmpty(const PkgTransientState &state)
+    {
+        return state.delayInfo_ == nullptr && state.bgStartTime_ < 0;
+    }
+}
+
+const PkgTransientState *TransientAppStateTable::FindPkg(const std::string &pkg, int32_t uid) const
+{
+    auto iter = uidStates_.find(uid);
+    if (iter == uidStates_.end()) {
+        return nullptr;
+    }
+    for (const auto &state : iter->second.pkgs_) {
+        if (state.pkg_ == pkg) {
+            return &state;
+        }
+    }
+    return nullptr;
+}
+
+PkgTransientState *TransientAppStateTable::FindPkg(const std::string &pkg, int32_t uid)
+{
+    return const_cast<PkgTransientState *>(static_cast<const TransientAppStateTable *>(this)->FindPkg(pkg, uid));
+}
+
+PkgTransientState &TransientAppStateTable::EmplacePkg(const std::string &pkg, int32_t uid)
+{
+    auto &pkgs = uidStates_[uid].pkgs_;
+    for (auto &state : pkgs) {
+        if (state.pkg_ == pkg) {
+            return state;
+        }
+    }
+    pkgs.emplace_back();
+    pkgs.back().pkg_ = pkg;
+    return pkgs.back();
+}
+
+void TransientAppStateTable::Prune(int32_t uid)
+{
+    auto iter = uidStates_.find(uid);
+    if (iter == uidStates_.end()) {
+        return;
+    }
+    auto &pkgs = iter->second.pkgs_;
+    pkgs.erase(std::remove_if(pkgs.begin(), pkgs.end(), IsPkgStateEmpty), pkgs.end());
+    if (pkgs.empty() && iter->second.foregroundPids_.empty()) {
+        uidStates_.erase(iter);
+    }
+}
+
+std::shared_ptr<PkgDelaySuspendInfo> TransientAppStateTable::FindDelayInfo(const std::string &pkg,
+    int32_t uid) const
+{
+    const PkgTransientState *state = FindPkg(pkg, uid);
+    return state == nullptr ? nullptr : state->delayInfo_;
+}
+
+void TransientAppStateTable::SetDelayInfo(const std::string &pkg, int32_t uid,
+    const std::shared_ptr<PkgDelaySuspendInfo> &delayInfo)
+{
+    if (delayInfo == nullptr) {
+        PkgTransientState *state = FindPkg(pkg, uid);
+        if (state != nullptr && state->delayInfo_ != nullptr) {
+            state->delayInfo_ = nullptr;
+            delayInfoCount_--;
+            Prune(uid);
+        }
+        return;
+    }
+    PkgTransientState &state = EmplacePkg(pkg, uid);
+    if (state.delayInfo_ == nullptr) {
+        delayInfoCount_++;
+    }
+    state.delayInfo_ = delayInfo;
+}
+
+void TransientAppStateTable::ForEachDelayInfo(const DelayInfoVisitor &visitor) const
+{
+    for (const auto &uidState : uidStates_) {
+        for (const auto &state : uidState.second.pkgs_) {
+            if (state.delayInfo_ != nullptr) {
+                visitor(state.delayInfo_);
+            }
+        }
+    }
+}
+
+void TransientAppStateTable::EraseDelayInfoIf(const DelayInfoPredicate &predicate)
+{
+    for (auto iter = uidStates_.begin(); iter != uidStates_.end();) {
+        auto &pkgs = iter->second.pkgs_;
+        for (auto &state : pkgs) {
+            if (state.delayInfo_ != nullptr && predicate(state.delayInfo_)) {
+                state.delayInfo_ = nullptr;
+                delayInfoCount_--;
+            }
+        }
+        pkgs.erase(std::remove_if(pkgs.begin(), pkgs.end(), IsPkgStateEmpty), pkgs.end());
+        if (pkgs.empty() && iter->second.foregroundPids_.empty()) {
+            iter = uidStates_.erase(iter);
+        } else {
+            iter++;
+        }
+    }
+}
+
+size_t TransientAppStateTable::DelayInfoSize() const
+{
+    return delayInfoCount_;
+}
+
+void TransientAppStateTable::ClearDelayInfo()
+{
+    EraseDelayInfoIf([](const std::shared_ptr<PkgDelaySuspendInfo> &) { return true; });
+}
+
+bool TransientAppStateTable::GetBgStartTime(const std::string &pkg, int32_t uid, int64_t &bgStartTime) const
+{
+    const PkgTransientState *state = FindPkg(pkg, uid);
+    if (state == nullptr || state->bgStartTime_ < 0) {
+        return false;
+    }
+    bgStartTime = state->bgStartTime_;
+    return true;
+}
+
+void TransientAppStateTable::SetBgStartTime(const std::string &pkg, int32_t uid, int64_t bgStartTime)
+{
+    EmplacePkg(pkg, uid).bgStartTime_ = bgStartTime;
+}
+
+void TransientAppStateTable::ClearBgStartTime(const std::string &pkg, int32_t uid)
+{
+    PkgTransientState *state = FindPkg(pkg, uid);
+    if (state == nullptr || state->bgStartTime_ < 0) {
+        return;
+    }
+    state->bgStartTime_ = INVALID_BG_START_TIME;
+    Prune(uid);
+}
+
+void TransientAppStateTable::UpdateForegroundPid(int32_t uid, int32_t pid, bool isForeground)
+{
+    if (isForeground) {
+        auto &pids = uidStates_[uid].foregroundPids_;
+        if (std::find(pids.begin(), pids.end(), pid) == pids.end()) {
+            pids.emplace_back(pid);
+        }
+        return;
+    }
+    auto iter = uidStates_.find(uid);
+    if (iter == uidStates_.end()) {
+        return;
+    }
+    auto &pids = iter->second.foregroundPids_;
+    pids.erase(std::remove(pids.begin(), pids.end(), pid), pids.end());
+    Prune(uid);
+}
+
+bool TransientAppStateTable::IsUidForeground(int32_t uid) const
+{
+    auto iter = uidStates_.find(uid);
+    return iter != uidStates_.end() && !iter->second.foregroundPids_.empty();
+}
+
+void TransientAppStateTable::ClearForeground()
+{
+    for (auto iter = uidStates_.begin(); iter != uidStates_.end();) {
+        iter->second.foregroundPids_.clear();
+        if (iter->second.pkgs_.empty()) {
+            iter = uidStates_.erase(iter);
+        } else {
+            iter++;
+        }
+    }
+}
+}  // namespace BackgroundTaskMgr
+}  // namespace OHOS
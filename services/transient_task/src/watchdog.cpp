@@ -20,6 +20,7 @@
 
 #include "background_task_mgr_service.h"
 #include "hisysevent.h"
+#include "timer_wheel.h"
 #include "transient_task_log.h"
 
 using namespace std;
@@ -38,13 +39,22 @@ Watchdog::Watchdog(const wptr<BackgroundTaskMgrService>& service, const std::sha
 bool Watchdog::AddWatchdog(int32_t requestId, const std::shared_ptr<KeyInfo>& info, int32_t interval)
 {
     BGTASK_LOGI("AddWatchdog %{public}d", requestId);
-    return SendEvent(requestId, info, interval);
+    std::weak_ptr<Watchdog> weak = std::static_pointer_cast<Watchdog>(shared_from_this());
+    auto task = [weak, requestId, info]() {
+        auto watchdog = weak.lock();
+        if (watchdog == nullptr) {
+            return;
+        }
+        watchdog->HandleWatchdog(requestId, info);
+    };
+    return DelayedSingleton<TimerWheel>::GetInstance()->AddTimer(TimerWheelModule::TRANSIENT_TASK_WATCHDOG,
+        requestId, interval, task, shared_from_this());
 }
 
 void Watchdog::RemoveWatchdog(int32_t requestId)
 {
     BGTASK_LOGI("RemoveWatchdog %{public}d", requestId);
-    RemoveEvent(requestId);
+    DelayedSingleton<TimerWheel>::GetInstance()->RemoveTimer(TimerWheelModule::TRANSIENT_TASK_WATCHDOG, requestId);
 }
 
 void Watchdog::ProcessEvent(const AppExecFwk::InnerEvent::Pointer& event)
@@ -52,8 +62,11 @@ void Watchdog::ProcessEvent(const AppExecFwk::InnerEvent::Pointer& event)
     if (event == nullptr) {
         return;
     }
-    int32_t requestId = event->GetInnerEventId();
-    const shared_ptr<KeyInfo>& info = event->GetSharedObject<KeyInfo>();
+    HandleWatchdog(event->GetInnerEventId(), event->GetSharedObject<KeyInfo>());
+}
+
+void Watchdog::HandleWatchdog(int32_t requestId, const std::shared_ptr<KeyInfo>& info)
+{
     if (info == nullptr) {
         return;
     }
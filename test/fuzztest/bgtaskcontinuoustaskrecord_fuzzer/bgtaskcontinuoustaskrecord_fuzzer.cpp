@@ -45,7 +45,7 @@ namespace BackgroundTaskMgr {
         continuousTaskRecord->pid_ = 1;
         continuousTaskRecord->bgModeId_ = 1;
         continuousTaskRecord->isBatchApi_ = true;
-        continuousTaskRecord->bgModeIds_ = {1};
+        continuousTaskRecord->SetBgModeIds({1});
         continuousTaskRecord->abilityId_ = 1;
         continuousTaskRecord->GetBundleName();
         continuousTaskRecord->GetAbilityName();
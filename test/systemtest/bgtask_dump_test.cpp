@@ -162,8 +162,8 @@ HWTEST_F(BgtaskDumpTest, BgtaskDumpTest_ShellDump_006, Function | MediumTest | L
     continuousTaskRecord1->abilityName_ = "abilityName";
     continuousTaskRecord1->uid_ = 20020056;
     continuousTaskRecord1->bgModeId_ = 2;
-    continuousTaskRecord1->bgModeIds_.push_back(2);
-    continuousTaskRecord1->bgSubModeIds_.push_back(2);
+    continuousTaskRecord1->AddBgModeId(2);
+    continuousTaskRecord1->AddBgSubModeId(2);
     continuousTaskRecord1->notificationId_ = 1;
     continuousTaskRecord1->continuousTaskId_ = 1;
     continuousTaskRecord1->abilityId_ = 1;